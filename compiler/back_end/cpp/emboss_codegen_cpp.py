@@ -21,13 +21,14 @@ the result.
 from __future__ import print_function
 
 import argparse
-import os
 import sys
 
 from compiler.back_end.cpp import header_generator
 from compiler.util import error
 from compiler.util import ir_data
+from compiler.util import ir_data_binary
 from compiler.util import ir_data_utils
+from compiler.util import pass_profiler
 
 
 def _parse_command_line(argv):
@@ -35,7 +36,11 @@ def _parse_command_line(argv):
     parser = argparse.ArgumentParser(
         description="Emboss compiler C++ back end.", prog=argv[0]
     )
-    parser.add_argument("--input-file", type=str, help=".emb.ir file to compile.")
+    parser.add_argument(
+        "--input-file",
+        type=str,
+        help=".emb.ir file to compile, in either JSON or binary format.",
+    )
     parser.add_argument(
         "--output-file",
         type=str,
@@ -63,7 +68,7 @@ def _show_errors(errors, ir, color_output):
     for module in ir.module:
         source_codes[module.source_file_name] = module.source_text
     use_color = color_output == "always" or (
-        color_output in ("auto", "if_tty") and os.isatty(sys.stderr.fileno())
+        color_output in ("auto", "if_tty") and sys.stderr.isatty()
     )
     print(error.format_errors(errors, source_codes, use_color), file=sys.stderr)
 
@@ -79,20 +84,28 @@ def generate_headers_and_log_errors(ir, color_output, config: header_generator.C
     Returns:
       A tuple of (header, errors)
     """
-    header, errors = header_generator.generate_header(ir, config)
+    with pass_profiler.measure("header_generator.generate_header"):
+        header, errors = header_generator.generate_header(ir, config)
     if errors:
         _show_errors(errors, ir, color_output)
     return (header, errors)
 
 
+def _read_ir(serialized_ir):
+    """Deserializes IR written by the front end in either format."""
+    if ir_data_binary.is_binary_ir(serialized_ir):
+        return ir_data_binary.from_binary(ir_data.EmbossIr, serialized_ir)
+    return ir_data_utils.IrDataSerializer.from_json(
+        ir_data.EmbossIr, serialized_ir.decode("utf-8")
+    )
+
+
 def main(flags):
     if flags.input_file:
-        with open(flags.input_file) as f:
-            ir = ir_data_utils.IrDataSerializer.from_json(ir_data.EmbossIr, f.read())
+        with open(flags.input_file, "rb") as f:
+            ir = _read_ir(f.read())
     else:
-        ir = ir_data_utils.IrDataSerializer.from_json(
-            ir_data.EmbossIr, sys.stdin.read()
-        )
+        ir = _read_ir(sys.stdin.buffer.read())
     config = header_generator.Config(include_enum_traits=flags.cc_enum_traits)
     header, errors = generate_headers_and_log_errors(ir, flags.color_output, config)
     if errors:
@@ -1330,6 +1330,502 @@ def _cpp_field_name(name):
         return name
 
 
+def _generate_decode_field_dispatch(field_names):
+    """Renders the field-name dispatch for a structure's UpdateFromTextStream.
+
+    Rather than comparing the parsed name against every field name in turn, the
+    generated code switches on the length of the name, then on its first
+    character, and only then compares the (usually one) remaining candidate.
+
+    Arguments:
+      field_names: The names of the fields which can be set from text format, in
+        the order in which they should be tested.
+
+    Returns:
+      A string of C++ code which `continue`s the enclosing loop if the field was
+      found and successfully decoded, `return`s false if the field was found but
+      could not be decoded, and otherwise falls through.
+    """
+    if not field_names:
+        return ""
+    names_by_length = collections.OrderedDict()
+    for field_name in sorted(field_names, key=len):
+        names_by_first_character = names_by_length.setdefault(
+            len(field_name), collections.OrderedDict()
+        )
+        names_by_first_character.setdefault(field_name[0], []).append(field_name)
+    length_cases = []
+    for length, names_by_first_character in names_by_length.items():
+        first_character_cases = []
+        for first_character, names in sorted(names_by_first_character.items()):
+            first_character_cases.append(
+                code_template.format_template(
+                    _TEMPLATES.decode_field_first_character_case,
+                    first_character=first_character,
+                    decode_fields="".join(
+                        code_template.format_template(
+                            _TEMPLATES.decode_field, field_name=name
+                        )
+                        for name in names
+                    ),
+                )
+            )
+        length_cases.append(
+            code_template.format_template(
+                _TEMPLATES.decode_field_length_case,
+                length=length,
+                first_character_cases="".join(first_character_cases),
+            )
+        )
+    return code_template.format_template(
+        _TEMPLATES.decode_fields_by_length, length_cases="".join(length_cases)
+    )
+
+
+def _generate_field_visitor_methods(type_ir):
+    """Renders VisitFields() and the field descriptors for a structure.
+
+    Arguments:
+      type_ir: The IR for the struct or bits definition.
+
+    Returns:
+      A string containing the VisitFields(), FieldCount(), and
+      FieldDescriptorAt() methods, suitable for inclusion in an Emboss View
+      class.
+    """
+    visit_fields = []
+    field_descriptors = []
+    for field in type_ir.structure.field:
+        # Anonymous fields are private, and $-prefixed fields (like
+        # $size_in_bytes) are only exposed under special C++ names.
+        if field.name.is_anonymous or field.name.name.text.startswith("$"):
+            continue
+        field_name = field.name.canonical_name.object_path[-1]
+        visit_fields.append(
+            code_template.format_template(_TEMPLATES.visit_field, field_name=field_name)
+        )
+        field_descriptors.append(
+            code_template.format_template(
+                _TEMPLATES.field_descriptor,
+                index=len(field_descriptors),
+                field_name=field_name,
+                is_virtual=_cpp_bool(ir_util.field_is_virtual(field)),
+                is_read_only=_cpp_bool(ir_util.field_is_read_only(field)),
+            )
+        )
+    return code_template.format_template(
+        _TEMPLATES.struct_field_visitor_methods,
+        visit_fields="".join(visit_fields),
+        field_count=len(field_descriptors),
+        field_descriptors="".join(field_descriptors),
+    )
+
+
+def _native_scalar_type(type_ir, size_in_bits, ir):
+    """Returns the native C++ type with the same representation as an atomic type.
+
+    Arguments:
+      type_ir: The IR of an atomic (non-array) type.
+      size_in_bits: The size of the field, in bits.
+      ir: The full IR; used for type lookups.
+
+    Returns:
+      A tuple of (C++ type name, kind), where kind is "UInt", "Int", "Float", or
+      "enum", or (None, None) if there is no native C++ type which is
+      bit-for-bit identical to the Emboss type.
+    """
+    type_definition = ir_util.find_object(type_ir.atomic_type.reference, ir)
+    if type_definition.has_field("enumeration"):
+        max_bits = ir_util.get_integer_attribute(
+            type_definition.attribute, "maximum_bits"
+        )
+        is_signed = ir_util.get_boolean_attribute(
+            type_definition.attribute, "is_signed"
+        )
+        # The enum's storage type must be exactly as wide as the field.
+        if size_in_bits not in (8, 16, 32, 64) or _cpp_integer_type_for_enum(
+            max_bits, is_signed
+        ) != _cpp_integer_type_for_enum(size_in_bits, is_signed):
+            return None, None
+        enum_type = _get_fully_qualified_name(type_definition.name.canonical_name, ir)
+        return enum_type, "enum"
+    canonical_name = type_definition.name.canonical_name
+    if canonical_name.module_file or len(canonical_name.object_path) != 1:
+        return None, None
+    kind = canonical_name.object_path[0]
+    if kind in ("UInt", "Int") and size_in_bits in (8, 16, 32, 64):
+        return _cpp_integer_type_for_enum(size_in_bits, kind == "Int"), kind
+    if kind == "Float" and size_in_bits in (32, 64):
+        return {32: "float", 64: "double"}[size_in_bits], kind
+    return None, None
+
+
+def _generate_native_layout(type_ir, ir):
+    """Generates the native struct equivalent to a structure, if there is one.
+
+    A structure has a native equivalent if it is a fixed-size, byte-oriented
+    struct whose fields are all naturally-aligned integers, floats, enums, or
+    arrays thereof, which do not overlap, and whose multibyte fields all have
+    the same byte order.
+
+    Arguments:
+      type_ir: The IR for the struct or bits definition.
+      ir: The full IR; used for type lookups.
+
+    Returns:
+      A tuple of (native struct definition, native layout methods), suitable for
+      insertion before and into the View class, respectively.
+    """
+    no_native_layout = (
+        "",
+        code_template.format_template(_TEMPLATES.no_native_layout_methods),
+    )
+    size_attr = ir_util.get_attribute(type_ir.attribute, "fixed_size_in_bits")
+    if (
+        type_ir.addressable_unit != ir_data.AddressableUnit.BYTE
+        or type_ir.runtime_parameter
+        or not size_attr
+    ):
+        return no_native_layout
+    size_in_bytes = ir_util.constant_value(size_attr.expression) // 8
+    type_name = type_ir.name.name.text
+    fields = []
+    byte_orders = set()
+    kinds = set()
+    for field in type_ir.structure.field:
+        if ir_util.field_is_virtual(field):
+            continue
+        if (
+            field.name.is_anonymous
+            or not ir_util.is_constant(field.location.start)
+            or not ir_util.is_constant(field.location.size)
+            or ir_util.constant_value(field.existence_condition) is not True
+        ):
+            return no_native_layout
+        dimensions = []
+        base_type = field.type
+        while base_type.has_field("array_type"):
+            if not ir_util.is_constant(base_type.array_type.element_count):
+                return no_native_layout
+            dimensions.append(
+                ir_util.constant_value(base_type.array_type.element_count)
+            )
+            base_type = base_type.array_type.base_type
+        offset = ir_util.constant_value(field.location.start)
+        size = ir_util.constant_value(field.location.size)
+        element_size = size
+        for dimension in dimensions:
+            element_size //= dimension
+        cpp_type, kind = _native_scalar_type(base_type, element_size * 8, ir)
+        if cpp_type is None or offset % element_size:
+            return no_native_layout
+        if element_size > 1:
+            byte_orders.add(
+                ir_util.get_attribute(
+                    field.attribute, "byte_order"
+                ).string_constant.text
+            )
+        kinds.add(kind)
+        fields.append((offset, size, element_size, cpp_type, field, dimensions))
+    if not fields or len(byte_orders) > 1:
+        return no_native_layout
+    fields.sort(key=lambda f: f[0])
+    alignment = max(f[2] for f in fields)
+    if size_in_bytes % alignment:
+        return no_native_layout
+    native_fields = []
+    offset_checks = []
+    next_offset = 0
+    for offset, size, element_size, cpp_type, field, dimensions in fields:
+        if offset < next_offset:
+            # Overlapping fields cannot be represented by a plain struct.
+            return no_native_layout
+        if offset > next_offset:
+            native_fields.append(_native_padding_field(next_offset, offset))
+        field_name = field.name.name.text
+        native_fields.append(
+            code_template.format_template(
+                _TEMPLATES.native_field,
+                cpp_type=cpp_type,
+                name=field_name,
+                dimensions="".join("[{}]".format(d) for d in dimensions),
+            )
+        )
+        offset_checks.append(
+            code_template.format_template(
+                _TEMPLATES.native_field_offset_check,
+                struct_name=type_name,
+                name=field_name,
+                offset=offset,
+            )
+        )
+        next_offset = offset + size
+    if next_offset > size_in_bytes:
+        return no_native_layout
+    if next_offset < size_in_bytes:
+        native_fields.append(_native_padding_field(next_offset, size_in_bytes))
+    # Without EMBOSS_MAY_ALIAS, accessing the backing storage through the native
+    # struct would violate strict aliasing.
+    host_checks = ["EMBOSS_HAS_MAY_ALIAS"]
+    if "LittleEndian" in byte_orders:
+        host_checks.append("EMBOSS_SYSTEM_IS_LITTLE_ENDIAN")
+    elif "BigEndian" in byte_orders:
+        host_checks.append("EMBOSS_SYSTEM_IS_BIG_ENDIAN")
+    if "Int" in kinds:
+        host_checks.append("EMBOSS_SYSTEM_IS_TWOS_COMPLEMENT")
+    native_struct = code_template.format_template(
+        _TEMPLATES.native_struct,
+        name=type_name,
+        native_fields="".join(native_fields),
+        size=size_in_bytes,
+        offset_checks="".join(offset_checks),
+    )
+    native_layout_methods = code_template.format_template(
+        _TEMPLATES.native_layout_methods,
+        name=type_name,
+        has_native_layout=" && ".join(host_checks),
+    )
+    return native_struct, native_layout_methods
+
+
+def _native_padding_field(start, end):
+    """Returns a native struct member which covers bytes [start, end)."""
+    return code_template.format_template(
+        _TEMPLATES.native_field,
+        cpp_type="::std::uint8_t",
+        name="emboss_reserved_padding_{}".format(start),
+        dimensions="[{}]".format(end - start),
+    )
+
+
+def _linear_form(expression, variables):
+    """Returns `expression` as a linear combination of `variables`, or None.
+
+    Arguments:
+      expression: An integer expression from the IR.
+      variables: The names of the fields which may appear in the linear form.
+
+    Returns:
+      A dict mapping field names (and "", for the constant term) to their
+      coefficients, without any zero coefficients, or None if `expression` is
+      not a linear combination of `variables`.
+    """
+    if ir_util.is_constant(expression):
+        value = ir_util.constant_value(expression)
+        return {"": value} if value else {}
+    if expression.which_expression == "field_reference":
+        if len(expression.field_reference.path) != 1:
+            return None
+        name = expression.field_reference.path[0].canonical_name.object_path[-1]
+        return {name: 1} if name in variables else None
+    if expression.which_expression != "function":
+        return None
+    function = expression.function.function
+    args = [_linear_form(arg, variables) for arg in expression.function.args]
+    if None in args:
+        return None
+    if function == ir_data.FunctionMapping.ADDITION:
+        scales = (1, 1)
+    elif function == ir_data.FunctionMapping.SUBTRACTION:
+        scales = (1, -1)
+    elif function == ir_data.FunctionMapping.MULTIPLICATION:
+        # Only multiplication by a constant is linear.
+        if set(args[0]) <= {""}:
+            args = [args[1], args[0]]
+        if not set(args[1]) <= {""}:
+            return None
+        scales = (args[1].get("", 0), 0)
+    else:
+        return None
+    result = {}
+    for form, scale in zip(args, scales):
+        for name, coefficient in form.items():
+            result[name] = result.get(name, 0) + coefficient * scale
+    return {name: value for name, value in result.items() if value}
+
+
+def _generate_builder(type_ir, ir):
+    """Generates a forward builder class for a dynamically-sized structure.
+
+    A builder is generated for byte-oriented structs without parameters whose
+    fields are laid out back-to-back, in declaration order, and whose
+    variable-sized fields are arrays with sizes of the form `c*length + d`,
+    where each `length` is a distinct fixed-location integer field.  The builder
+    appends fields to a byte vector in order, and writes the length fields on
+    Finish().
+
+    Arguments:
+      type_ir: The IR for the struct or bits definition.
+      ir: The full IR; used for type lookups.
+
+    Returns:
+      A tuple of (forward declaration, `Builder` alias for the View class,
+      builder class definition), or a tuple of empty strings if no builder can
+      be generated for the structure.
+    """
+    no_builder = ("", "", "")
+    if type_ir.addressable_unit != ir_data.AddressableUnit.BYTE or (
+        type_ir.runtime_parameter
+    ):
+        return no_builder
+    fields = [f for f in type_ir.structure.field if not ir_util.field_is_virtual(f)]
+    length_candidates = set()
+    for field in fields:
+        if field.name.is_anonymous or (
+            ir_util.constant_value(field.existence_condition) is not True
+        ):
+            return no_builder
+        if (
+            field.type.has_field("atomic_type")
+            and ir_util.is_constant(field.location.start)
+            and ir_util.is_constant(field.location.size)
+        ):
+            _, kind = _native_scalar_type(
+                field.type, ir_util.constant_value(field.location.size) * 8, ir
+            )
+            if kind in ("UInt", "Int"):
+                length_candidates.add(field.name.name.text)
+    end = {}
+    # Each entry of `layout` is (field, element size, length field name,
+    # coefficient, constant) for variable-sized fields, or (field, size, None,
+    # None, None) for fixed-size fields.
+    layout = []
+    for field in fields:
+        start = _linear_form(field.location.start, length_candidates)
+        size = _linear_form(field.location.size, length_candidates)
+        if start != end or size is None:
+            return no_builder
+        for name, coefficient in size.items():
+            end[name] = end.get(name, 0) + coefficient
+        end = {name: value for name, value in end.items() if value}
+        variables = [name for name in size if name]
+        if not variables:
+            layout.append((field, size.get("", 0), None, None, None))
+            continue
+        if len(variables) != 1 or size[variables[0]] <= 0:
+            return no_builder
+        if not ir_util.is_array(field.type):
+            return no_builder
+        element_size = ir_util.fixed_size_of_type_in_bits(
+            field.type.array_type.base_type, ir
+        )
+        if element_size is None:
+            return no_builder
+        layout.append(
+            (
+                field,
+                element_size // 8,
+                variables[0],
+                size[variables[0]],
+                size.get("", 0),
+            )
+        )
+    length_fields = [entry[2] for entry in layout if entry[2]]
+    if not length_fields or len(set(length_fields)) != len(length_fields):
+        return no_builder
+    if any(_type_has_runtime_parameters(field.type, ir) for field in fields):
+        return no_builder
+
+    type_name = type_ir.name.name.text
+    initial_size = 0
+    append_methods = []
+    size_members = []
+    patches = []
+    pending = None
+    for field, size, length_field, coefficient, constant in layout:
+        field_name = field.name.name.text
+        if field_name in length_fields:
+            if pending is None:
+                initial_size += size
+            else:
+                pending[1] += size
+            continue
+        if length_field is None:
+            template = _TEMPLATES.builder_append_fixed_field_method
+        else:
+            template = _TEMPLATES.builder_append_array_field_method
+            size_members.append(
+                "::std::size_t {}_size_in_bytes_ = 0;".format(field_name)
+            )
+        pending = [field_name, 0, template, size]
+        append_methods.append(pending)
+    rendered_methods = []
+    for index, (field_name, trailing_size, template, size) in enumerate(append_methods):
+        rendered_methods.append(
+            code_template.format_template(
+                template,
+                name=type_name,
+                field=field_name,
+                index=index,
+                size=size,
+                trailing_size=" + {}".format(trailing_size) if trailing_size else "",
+            )
+        )
+    for field, size, length_field, coefficient, constant in layout:
+        if length_field is None:
+            continue
+        length_field_ir = [f for f in fields if f.name.name.text == length_field][0]
+        value = "static_cast</**/ ::std::int64_t>({}_size_in_bytes_)".format(
+            field.name.name.text
+        )
+        if constant > 0:
+            value = "({} - {})".format(value, constant)
+        elif constant < 0:
+            value = "({} + {})".format(value, -constant)
+        if coefficient != 1:
+            if size % coefficient or constant % coefficient:
+                patches.append(
+                    code_template.format_template(
+                        _TEMPLATES.builder_divisibility_check,
+                        value=value,
+                        divisor=coefficient,
+                    )
+                )
+            value = "{} / {}".format(value, coefficient)
+        patches.append(
+            code_template.format_template(
+                _TEMPLATES.builder_write_length_field,
+                name=type_name,
+                field=length_field,
+                offset=ir_util.constant_value(length_field_ir.location.start),
+                size=ir_util.constant_value(length_field_ir.location.size),
+                value=value,
+            )
+        )
+    builder_class = code_template.format_template(
+        _TEMPLATES.structure_builder_class,
+        name=type_name,
+        initial_size=initial_size,
+        append_methods="\n".join(rendered_methods),
+        field_count=len(append_methods),
+        write_length_fields="".join(patches),
+        size_members="\n  ".join(size_members),
+    )
+    return (
+        code_template.format_template(
+            _TEMPLATES.structure_builder_declaration, name=type_name
+        ),
+        code_template.format_template(
+            _TEMPLATES.structure_builder_alias, name=type_name
+        ),
+        builder_class,
+    )
+
+
+def _type_has_runtime_parameters(type_ir, ir):
+    """Returns True if the (base) type of `type_ir` takes runtime parameters."""
+    base_type = ir_util.get_base_type(type_ir)
+    if base_type.atomic_type.runtime_parameter:
+        return True
+    type_definition = ir_util.find_object(base_type.atomic_type.reference, ir)
+    return bool(type_definition.runtime_parameter)
+
+
+def _cpp_bool(value):
+    """Returns the C++ literal for the Python bool value."""
+    return "true" if value else "false"
+
+
 def _generate_structure_definition(type_ir, ir, config: Config):
     """Generates C++ for an Emboss structure (struct or bits).
 
@@ -1351,7 +1847,7 @@ def _generate_structure_definition(type_ir, ir, config: Config):
     field_method_declarations = []
     field_method_definitions = []
     virtual_field_type_definitions = []
-    decode_field_clauses = []
+    decodable_field_names = []
     write_field_clauses = []
     ok_method_clauses = []
     equals_method_clauses = []
@@ -1451,12 +1947,7 @@ def _generate_structure_definition(type_ir, ir, config: Config):
         field_method_declarations.append(declaration)
         if not field.name.is_anonymous and not ir_util.field_is_read_only(field):
             # As above, read-only fields cannot be decoded from text format.
-            decode_field_clauses.append(
-                code_template.format_template(
-                    _TEMPLATES.decode_field,
-                    field_name=field.name.canonical_name.object_path[-1],
-                )
-            )
+            decodable_field_names.append(field.name.canonical_name.object_path[-1])
         text_output_attr = ir_util.get_attribute(field.attribute, "text_output")
         if not text_output_attr or text_output_attr.string_constant == "Emit":
             if ir_util.field_is_read_only(field):
@@ -1484,14 +1975,20 @@ def _generate_structure_definition(type_ir, ir, config: Config):
     if config.include_enum_traits:
         text_stream_methods = code_template.format_template(
             _TEMPLATES.struct_text_stream,
-            decode_fields="\n".join(decode_field_clauses),
+            decode_fields=_generate_decode_field_dispatch(decodable_field_names),
             write_fields="\n".join(write_field_clauses),
         )
     else:
         text_stream_methods = ""
 
-    class_forward_declarations = code_template.format_template(
-        _TEMPLATES.structure_view_declaration, name=type_name
+    native_struct, native_layout_methods = _generate_native_layout(type_ir, ir)
+    builder_declaration, builder_alias, builder_class = _generate_builder(type_ir, ir)
+
+    class_forward_declarations = (
+        code_template.format_template(
+            _TEMPLATES.structure_view_declaration, name=type_name
+        )
+        + builder_declaration
     )
     class_bodies = code_template.format_template(
         _TEMPLATES.structure_view_class,
@@ -1505,6 +2002,10 @@ def _generate_structure_definition(type_ir, ir, config: Config):
         unchecked_equals_method_body="\n".join(unchecked_equals_method_clauses),
         enum_usings="\n".join(enum_using_statements),
         text_stream_methods=text_stream_methods,
+        field_visitor_methods=_generate_field_visitor_methods(type_ir),
+        native_struct=native_struct,
+        native_layout_methods=native_layout_methods,
+        builder_alias=builder_alias,
         parameter_fields="\n".join(parameter_fields),
         constructor_parameters="".join(constructor_parameters),
         forwarded_parameters="".join(forwarded_parameters),
@@ -1521,7 +2022,10 @@ def _generate_structure_definition(type_ir, ir, config: Config):
         early_virtual_field_types
         + subtype_forward_declarations
         + class_forward_declarations,
-        all_field_helper_type_definitions + subtype_bodies + class_bodies,
+        all_field_helper_type_definitions
+        + subtype_bodies
+        + class_bodies
+        + builder_class,
         subtype_method_definitions + method_definitions,
     )
 
@@ -1627,6 +2131,7 @@ def _generate_enum_definition(type_ir, include_traits=True):
                         enum=type_ir.name.name.text,
                         value=enum_value_name,
                         name=value.name.name.text,
+                        name_size=len(value.name.name.text),
                     )
                 )
 
@@ -156,6 +156,87 @@ TEST(MessageView, MakeFromPointerArrayIterator) {
   }
 }
 
+// MessageWriter::Builder appends fields in order and fills in the length
+// fields.
+TEST(MessageBuilder, BuildsPaddedMessage) {
+  ::std::vector</**/ ::std::uint8_t> output;
+  MessageWriter::Builder builder(&output);
+  auto padding = builder.append_padding(4);
+  for (int i = 0; i < 4; ++i) {
+    padding[i].Write(i + 1);
+  }
+  auto message = builder.append_message(4);
+  for (int i = 0; i < 4; ++i) {
+    message[i].Write(i + 5);
+  }
+  builder.append_crc32().Write(0x0c0b0a09);
+  EXPECT_EQ(14U, builder.Finish());
+  EXPECT_EQ(::std::vector</**/ ::std::uint8_t>(kPaddedMessage.begin(),
+                                               kPaddedMessage.begin() + 14),
+            output);
+}
+
+// A writer backed by a VectorBackedBuffer grows its vector as fields are
+// written, including fields whose location depends on earlier writes.
+TEST(MessageView, WriterOverVectorBackedBuffer) {
+  ::std::vector</**/ ::std::uint8_t> output;
+  using Buffer = ::emboss::support::VectorBackedBuffer<>;
+  auto writer = GenericMessageView<Buffer>(Buffer(&output));
+  writer.header_length().Write(2);
+  writer.message_length().Write(6);
+  EXPECT_EQ(2U, output.size());
+  for (int i = 0; i < 6; ++i) {
+    writer.message()[i].Write(i + 1);
+  }
+  writer.crc32().Write(0x0a090807);
+  EXPECT_EQ(::std::vector</**/ ::std::uint8_t>(kMessage.begin(),
+                                               kMessage.begin() + 12),
+            output);
+  EXPECT_TRUE(writer.Ok());
+}
+
+// MessageWriter::Builder appends to the end of its output, so that several
+// messages can be built into the same buffer.
+TEST(MessageBuilder, AppendsToExistingOutput) {
+  ::std::vector</**/ ::std::uint8_t> output = {0xff};
+  MessageWriter::Builder builder(&output);
+  builder.append_padding(0);
+  auto message = builder.append_message(6);
+  for (int i = 0; i < 6; ++i) {
+    message[i].Write(i + 1);
+  }
+  builder.append_crc32().Write(0x0a090807);
+  EXPECT_EQ(12U, builder.Finish());
+  ASSERT_EQ(13U, output.size());
+  EXPECT_EQ(0xff, output[0]);
+  EXPECT_EQ(::std::vector</**/ ::std::uint8_t>(kMessage.begin(),
+                                               kMessage.begin() + 12),
+            ::std::vector</**/ ::std::uint8_t>(output.begin() + 1,
+                                               output.end()));
+  auto view = MessageView(output.data() + 1, output.size() - 1);
+  EXPECT_TRUE(view.Ok());
+}
+
+// Finish() returns 0 if a length does not fit in its length field.
+TEST(MessageBuilder, FinishFailsIfLengthDoesNotFit) {
+  ::std::vector</**/ ::std::uint8_t> output;
+  MessageView::Builder builder(&output);
+  builder.append_padding(0);
+  // message_length is only 8 bits, so it cannot hold 256.
+  builder.append_message(256);
+  builder.append_crc32();
+  EXPECT_EQ(0U, builder.Finish());
+}
+
+#if EMBOSS_CHECK_ABORTS
+TEST(MessageBuilder, FieldsMustBeAppendedInOrder) {
+  ::std::vector</**/ ::std::uint8_t> output;
+  MessageWriter::Builder builder(&output);
+  EXPECT_DEATH(builder.append_message(1), "");
+  EXPECT_DEATH(builder.Finish(), "");
+}
+#endif  // EMBOSS_CHECK_ABORTS
+
 static const ::std::uint8_t kThreeByFiveImage[46] = {
     0x03,              // 0:1  size
     0x01, 0x02, 0x03,  // pixels[0][0]
@@ -210,6 +291,28 @@ TEST(ImageView, WritePixels) {
       ::std::vector</**/ ::std::uint8_t>(buffer, buffer + sizeof buffer));
 }
 
+// The length field of ImageWriter::Builder is derived from the size of each
+// element of pixels().
+TEST(ImageBuilder, BuildsImage) {
+  ::std::vector</**/ ::std::uint8_t> output;
+  ImageWriter::Builder builder(&output);
+  auto pixels = builder.append_pixels(3);
+  int counter = 1;
+  for (int x = 0; x < 3; ++x) {
+    for (int y = 0; y < 5; ++y) {
+      for (int channel = 0; channel < 3; ++channel) {
+        pixels[x][y][channel].Write(counter);
+        ++counter;
+      }
+    }
+  }
+  EXPECT_EQ(sizeof kThreeByFiveImage, builder.Finish());
+  EXPECT_EQ(
+      ::std::vector</**/ ::std::uint8_t>(
+          kThreeByFiveImage, kThreeByFiveImage + sizeof kThreeByFiveImage),
+      output);
+}
+
 static const ::std::uint8_t kTwoRegionsAFirst[10] = {
     0x04,                    // 0:1   a_start
     0x02,                    // 1:2   a_size
@@ -275,6 +275,15 @@ TEST(Kind, NameToEnum) {
   EXPECT_EQ(Kind::WIDGET, result);
 }
 
+TEST(Kind, SizedNameToEnum) {
+  Kind result = Kind::WIDGET;
+  EXPECT_TRUE(TryToGetEnumFromName("SPROCKET, WIDGET", 8, &result));
+  EXPECT_EQ(Kind::SPROCKET, result);
+  EXPECT_FALSE(TryToGetEnumFromName("SPROCKET", 7, &result));
+  EXPECT_FALSE(TryToGetEnumFromName("SPROCKET", 0, &result));
+  EXPECT_EQ(Kind::SPROCKET, result);
+}
+
 TEST(Kind, Type) {
   EXPECT_TRUE((::std::is_same</**/ ::std::uint64_t,
                               ::std::underlying_type<Kind>::type>::value));
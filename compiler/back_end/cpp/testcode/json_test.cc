@@ -0,0 +1,136 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Tests for JSON output of generated views (WriteToJson()).
+
+#include <stdint.h>
+
+#include <limits>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "runtime/cpp/emboss_json_util.h"
+#include "testdata/native_layout.emb.h"
+#include "testdata/nested_structure.emb.h"
+
+namespace emboss {
+namespace test {
+namespace {
+
+// Fills in a NativeRecord with some easily-recognizable values.
+void WriteSampleRecord(NativeRecordWriter writer) {
+  writer.id().Write(7);
+  writer.delta().Write(-2);
+  writer.kind().Write(Kind::BANANA);
+  writer.value().Write(2.5);
+  for (int i = 0; i < 4; ++i) writer.tag()[i].Write(i == 3 ? 0xff : i + 1);
+  writer.flags().Write(0x8001);
+  for (int i = 0; i < 4; ++i) writer.samples()[i].Write(1000 * i);
+  writer.timestamp().Write(77);
+  writer.sequence().Write(78);
+}
+
+TEST(WriteToJson, WritesScalarsAndArrays) {
+  ::std::uint8_t bytes[48] = {};
+  WriteSampleRecord(MakeNativeRecordView(bytes, sizeof bytes));
+  EXPECT_EQ(
+      "{\"id\":7,\"delta\":-2,\"kind\":\"BANANA\",\"value\":2.5,"
+      "\"tag\":[1,2,3,255],\"flags\":32769,\"samples\":[0,1000,2000,3000],"
+      "\"timestamp\":77,\"sequence\":78,\"timestamp_plus_one\":78}",
+      WriteToJson(MakeNativeRecordView(bytes, sizeof bytes)));
+}
+
+TEST(WriteToJson, EnumsAsNumbers) {
+  ::std::uint8_t bytes[48] = {};
+  auto writer = MakeNativeRecordView(bytes, sizeof bytes);
+  writer.kind().Write(Kind::APPLE);
+  EXPECT_NE(::std::string::npos,
+            WriteToJson(writer).find("\"kind\":\"APPLE\""));
+  EXPECT_NE(::std::string::npos,
+            WriteToJson(writer, JsonOutputOptions().WithEnumsAsNumbers(true))
+                .find("\"kind\":1,"));
+  // Values without names are always written as numbers.
+  writer.kind().Write(static_cast<Kind>(9));
+  EXPECT_NE(::std::string::npos, WriteToJson(writer).find("\"kind\":9,"));
+}
+
+TEST(WriteToJson, ByteArrayEncodings) {
+  ::std::uint8_t bytes[48] = {};
+  WriteSampleRecord(MakeNativeRecordView(bytes, sizeof bytes));
+  auto view = MakeNativeRecordView(bytes, sizeof bytes);
+  EXPECT_EQ("\"010203ff\"",
+            WriteToJson(view.tag(), JsonOutputOptions().WithByteArrayEncoding(
+                                        JsonByteArrayEncoding::kHex)));
+  EXPECT_EQ("\"AQID/w==\"",
+            WriteToJson(view.tag(), JsonOutputOptions().WithByteArrayEncoding(
+                                        JsonByteArrayEncoding::kBase64)));
+  // Only arrays of UInt:8 are affected.
+  EXPECT_EQ("[0,1000,2000,3000]",
+            WriteToJson(view.samples(),
+                        JsonOutputOptions().WithByteArrayEncoding(
+                            JsonByteArrayEncoding::kHex)));
+  // Arrays over truncated buffers are shorter, which affects base64 padding.
+  EXPECT_EQ("\"AQ==\"",
+            WriteToJson(MakeNativeRecordView(bytes, 17).tag(),
+                        JsonOutputOptions().WithByteArrayEncoding(
+                            JsonByteArrayEncoding::kBase64)));
+}
+
+TEST(WriteToJson, NonFiniteFloatsAreNull) {
+  ::std::uint8_t bytes[48] = {};
+  auto writer = MakeNativeRecordView(bytes, sizeof bytes);
+  writer.value().Write(::std::numeric_limits<double>::infinity());
+  EXPECT_NE(::std::string::npos, WriteToJson(writer).find("\"value\":null,"));
+  writer.value().Write(::std::numeric_limits<double>::quiet_NaN());
+  EXPECT_NE(::std::string::npos, WriteToJson(writer).find("\"value\":null,"));
+}
+
+TEST(WriteToJson, UnreadableFieldsAreNull) {
+  ::std::uint8_t bytes[48] = {};
+  WriteSampleRecord(MakeNativeRecordView(bytes, sizeof bytes));
+  EXPECT_EQ(
+      "{\"id\":7,\"delta\":-2,\"kind\":\"BANANA\",\"value\":2.5,"
+      "\"tag\":[1,2,3,255],\"flags\":32769,\"samples\":[0,1000],"
+      "\"timestamp\":null,\"sequence\":null,\"timestamp_plus_one\":null}",
+      WriteToJson(MakeNativeRecordView(bytes, 28)));
+}
+
+TEST(WriteToJson, NestedStructures) {
+  ::std::uint8_t bytes[44] = {};
+  auto truck = MakeTruckView(bytes, sizeof bytes);
+  truck.id().Write(1);
+  truck.cargo()[0].weight().Write(2);
+  truck.cargo()[0].important_box().id().Write(3);
+  truck.cargo()[1].other_box().count().Write(4);
+  EXPECT_EQ(
+      "{\"id\":1,\"cargo\":["
+      "{\"weight\":2,\"important_box\":{\"id\":3,\"count\":0},"
+      "\"other_box\":{\"id\":0,\"count\":0}},"
+      "{\"weight\":0,\"important_box\":{\"id\":0,\"count\":0},"
+      "\"other_box\":{\"id\":0,\"count\":4}}]}",
+      WriteToJson(truck));
+}
+
+TEST(WriteJsonToStream, WritesToTextOutputStream) {
+  ::std::uint8_t bytes[8] = {};
+  auto box = MakeBoxView(bytes, sizeof bytes);
+  box.id().Write(5);
+  support::TextOutputStream stream;
+  WriteJsonToStream(box, &stream, JsonOutputOptions());
+  EXPECT_EQ("{\"id\":5,\"count\":0}", stream.Result());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace emboss
@@ -0,0 +1,120 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Tests for the native-layout fast path (HasNativeLayout() and AsNative()).
+
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "testdata/native_layout.emb.h"
+
+namespace emboss {
+namespace test {
+namespace {
+
+TEST(NativeLayout, NativeStructsMatchEmbossSizes) {
+  EXPECT_EQ(NativeRecord::IntrinsicSizeInBytes(),
+            sizeof(NativeRecordView::Native));
+  EXPECT_EQ(8U, alignof(NativeRecordView::Native));
+  EXPECT_EQ(BigEndianNativeRecord::IntrinsicSizeInBytes(),
+            sizeof(BigEndianNativeRecordView::Native));
+}
+
+TEST(NativeLayout, HasNativeLayoutDependsOnHostByteOrder) {
+  EXPECT_EQ(EMBOSS_HAS_MAY_ALIAS && EMBOSS_SYSTEM_IS_LITTLE_ENDIAN &&
+                EMBOSS_SYSTEM_IS_TWOS_COMPLEMENT,
+            NativeRecordView::HasNativeLayout());
+  EXPECT_EQ(EMBOSS_HAS_MAY_ALIAS && EMBOSS_SYSTEM_IS_BIG_ENDIAN,
+            BigEndianNativeRecordView::HasNativeLayout());
+}
+
+TEST(NativeLayout, ViewsAndWritersShareNativeStruct) {
+  EXPECT_TRUE((::std::is_same<NativeRecordView::Native,
+                              NativeRecordWriter::Native>::value));
+}
+
+TEST(NativeLayout, IneligibleStructuresDoNotHaveNativeLayout) {
+  EXPECT_FALSE(MisalignedRecordView::HasNativeLayout());
+  EXPECT_FALSE(MixedEndianRecordView::HasNativeLayout());
+  EXPECT_FALSE(OverlappingRecordView::HasNativeLayout());
+}
+
+#if EMBOSS_HAS_MAY_ALIAS && EMBOSS_SYSTEM_IS_LITTLE_ENDIAN && \
+    EMBOSS_SYSTEM_IS_TWOS_COMPLEMENT
+TEST(NativeLayout, AsNativeReadsFieldsWrittenThroughView) {
+  alignas(NativeRecordView::Native) ::std::uint8_t bytes[48] = {};
+  auto writer = MakeNativeRecordView(bytes, sizeof bytes);
+  writer.id().Write(0x12345678);
+  writer.delta().Write(-2);
+  writer.kind().Write(Kind::BANANA);
+  writer.value().Write(2.5);
+  writer.tag()[3].Write(0xab);
+  writer.flags().Write(0x8001);
+  writer.samples()[1].Write(1000);
+  writer.timestamp().Write(77);
+  writer.sequence().Write(78);
+
+  const NativeRecordView::Native *native =
+      NativeRecordView(bytes, sizeof bytes).AsNative();
+  EXPECT_EQ(static_cast<const void *>(bytes),
+            static_cast<const void *>(native));
+  EXPECT_EQ(0x12345678U, native->id);
+  EXPECT_EQ(-2, native->delta);
+  EXPECT_EQ(Kind::BANANA, native->kind);
+  EXPECT_EQ(2.5, native->value);
+  EXPECT_EQ(0xab, native->tag[3]);
+  EXPECT_EQ(0x8001, native->flags);
+  EXPECT_EQ(1000, native->samples[1]);
+  EXPECT_EQ(77U, native->timestamp);
+  EXPECT_EQ(78U, native->sequence);
+}
+
+TEST(NativeLayout, AsNativeWritesAreVisibleThroughView) {
+  alignas(NativeRecordView::Native) ::std::uint8_t bytes[48] = {};
+  auto writer = MakeNativeRecordView(bytes, sizeof bytes);
+  NativeRecordView::Native *native = writer.AsNative();
+  native->id = 99;
+  native->delta = -300;
+  native->value = -0.25;
+  native->samples[3] = 0xbeef;
+  EXPECT_EQ(99U, writer.id().Read());
+  EXPECT_EQ(-300, writer.delta().Read());
+  EXPECT_EQ(-0.25, writer.value().Read());
+  EXPECT_EQ(0xbeef, writer.samples()[3].Read());
+  native->timestamp = 41;
+  EXPECT_EQ(42U, writer.timestamp_plus_one().Read());
+}
+
+TEST(NativeLayout, AsNativePreservesConstness) {
+  EXPECT_TRUE((::std::is_same<const NativeRecordView::Native *,
+                              decltype(NativeRecordView().AsNative())>::value));
+  EXPECT_TRUE((::std::is_same<NativeRecordView::Native *,
+                              decltype(NativeRecordWriter().AsNative())>::value));
+}
+
+#if EMBOSS_CHECK_ABORTS
+TEST(NativeLayout, AsNativeChecksSizeAndAlignment) {
+  alignas(NativeRecordView::Native) ::std::uint8_t bytes[49] = {};
+  EXPECT_DEATH(NativeRecordView(bytes, 47).AsNative(), "");
+  EXPECT_DEATH(NativeRecordView(bytes + 1, 48).AsNative(), "");
+}
+#endif  // EMBOSS_CHECK_ABORTS
+#endif  // EMBOSS_HAS_MAY_ALIAS && EMBOSS_SYSTEM_IS_LITTLE_ENDIAN &&
+        // EMBOSS_SYSTEM_IS_TWOS_COMPLEMENT
+
+}  // namespace
+}  // namespace test
+}  // namespace emboss
@@ -38,6 +38,17 @@ TEST(TextFormat, VanillaOutput) {
       ::emboss::WriteToString(view, ::emboss::MultilineText()));
 }
 
+TEST(TextFormat, OutputWithSizeHint) {
+  ::std::array<char, 2> values = {1, 2};
+  const auto view = MakeVanillaView(&values);
+  const ::std::string text =
+      ::emboss::WriteToString(view, ::emboss::TextOutputOptions(), 64);
+  EXPECT_EQ("{ a: 1, b: 2 }", text);
+  EXPECT_LE(64U, text.capacity());
+  EXPECT_EQ("{ a: 1, b: 2 }",
+            ::emboss::WriteToString(view, ::emboss::TextOutputOptions(), 0));
+}
+
 TEST(TextFormat, SkippedFieldOutput) {
   ::std::array<char, 3> values = {1, 2, 3};
   const auto view = MakeStructWithSkippedFieldsView(&values);
@@ -93,6 +104,24 @@ TEST(TextFormat, UpdateFromText) {
   EXPECT_EQ(view.b().Read(), 4);
 }
 
+TEST(TextFormat, UpdateFromTextWithSimilarFieldNames) {
+  ::std::array<char, 5> values{};
+  const auto view = MakeStructWithSimilarFieldNamesView(&values);
+
+  EXPECT_TRUE(::emboss::UpdateFromText(
+      view, "{ bc: 5, b: 4, abc: 3, ac: 2, ab: 1 }"));
+  EXPECT_EQ(view.ab().Read(), 1);
+  EXPECT_EQ(view.ac().Read(), 2);
+  EXPECT_EQ(view.abc().Read(), 3);
+  EXPECT_EQ(view.b().Read(), 4);
+  EXPECT_EQ(view.bc().Read(), 5);
+
+  EXPECT_FALSE(::emboss::UpdateFromText(view, "{ a: 1 }"));
+  EXPECT_FALSE(::emboss::UpdateFromText(view, "{ ad: 1 }"));
+  EXPECT_FALSE(::emboss::UpdateFromText(view, "{ abcd: 1 }"));
+  EXPECT_FALSE(::emboss::UpdateFromText(view, "{ c: 1 }"));
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace emboss
@@ -15,6 +15,7 @@
 // Tests of generated code for virtual fields.
 #include <stdint.h>
 
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -440,6 +441,55 @@ TEST(WriteTransform, CouldWriteValue) {
   EXPECT_FALSE(view.ten_minus_x_plus_ten().CouldWriteValue(21));
 }
 
+static_assert(StructureWithConditionalValueView::FieldCount() == 3,
+              "StructureWithConditionalValueView::FieldCount() == 3");
+static_assert(
+    !StructureWithConditionalValueView::FieldDescriptorAt(0).is_virtual,
+    "!StructureWithConditionalValueView::FieldDescriptorAt(0).is_virtual");
+static_assert(
+    StructureWithConditionalValueView::FieldDescriptorAt(1).is_virtual,
+    "StructureWithConditionalValueView::FieldDescriptorAt(1).is_virtual");
+static_assert(
+    StructureWithConditionalValueView::FieldDescriptorAt(1).is_read_only,
+    "StructureWithConditionalValueView::FieldDescriptorAt(1).is_read_only");
+static_assert(
+    StructureWithConditionalValueView::FieldDescriptorAt(3).name == nullptr,
+    "StructureWithConditionalValueView::FieldDescriptorAt(3).name == nullptr");
+static_assert(!ImplicitWriteBackView::FieldDescriptorAt(1).is_read_only,
+              "!ImplicitWriteBackView::FieldDescriptorAt(1).is_read_only");
+
+TEST(VisitFields, VisitsPresentFieldsInOrder) {
+  ::std::array<unsigned char, 4> values = {1, 0, 0, 0};
+  const auto view = MakeStructureWithConditionalValueView(&values);
+  ::std::vector<::std::string> names;
+  ::std::vector<::std::int64_t> field_values;
+  view.VisitFields([&](const char *name, auto field) {
+    names.push_back(name);
+    field_values.push_back(field.Read());
+  });
+  EXPECT_EQ((::std::vector<::std::string>{"x", "two_x", "x_plus_one"}), names);
+  EXPECT_EQ((::std::vector<::std::int64_t>{1, 2, 2}), field_values);
+
+  values[3] = 0x80;
+  names.clear();
+  view.VisitFields([&](const char *name, auto) { names.push_back(name); });
+  EXPECT_EQ((::std::vector<::std::string>{"x", "x_plus_one"}), names);
+}
+
+TEST(VisitFields, DescriptorsMatchVisitedFields) {
+  ::std::array<unsigned char, 4> values = {1, 0, 0, 0};
+  const auto view = MakeStructureWithConditionalValueView(&values);
+  ::std::size_t index = 0;
+  view.VisitFields([&](const char *name, auto) {
+    ASSERT_LT(index, StructureWithConditionalValueView::FieldCount());
+    EXPECT_STREQ(
+        StructureWithConditionalValueView::FieldDescriptorAt(index).name,
+        name);
+    ++index;
+  });
+  EXPECT_EQ(StructureWithConditionalValueView::FieldCount(), index);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace emboss
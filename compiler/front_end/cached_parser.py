@@ -0,0 +1,270 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Loads the pregenerated Emboss parsers from generated/cached_parser.bin.
+
+Generating the LR(1) tables for the Emboss grammar takes a long time, so the
+tables are generated ahead of time by generate_cached_parser, and stored in a
+compact binary form which can be loaded much faster than the equivalent Python
+source could be compiled and run.
+
+The file is a `marshal`ed dict (using marshal format version 2, which contains
+only plain values, so that the output does not depend on object identities),
+mapping each parser's name to its own `marshal`ed table data.  Each parser is
+only decoded when it is first requested.
+
+In the table data, grammar symbols, productions, and actions are stored once
+each, and referred to by their index.  The ACTION and GOTO tables are stored as
+packed little-endian integer arrays: for each state, a run of symbol indexes,
+and a parallel run of action indexes or target states.
+"""
+
+import array
+import marshal
+import sys
+
+from compiler.front_end import lr1
+from compiler.util import parser_types
+from compiler.util import resources
+from compiler.util import simple_memoizer
+
+# Bump this whenever the format of cached_parser.bin changes.
+FORMAT_VERSION = 1
+
+_MARSHAL_VERSION = 2
+
+# The kinds of actions in the table of distinct actions.
+_SHIFT = 0
+_REDUCE = 1
+_ACCEPT = 2
+_ERROR = 3
+
+
+def _pack(values):
+    """Packs a list of non-negative ints as a (typecode, bytes) tuple."""
+    typecode = "H" if not values or max(values) < 1 << 16 else "I"
+    packed = array.array(typecode, values)
+    if sys.byteorder != "little":
+        packed.byteswap()
+    return typecode, packed.tobytes()
+
+
+def _unpack(typecode_and_bytes):
+    typecode, data = typecode_and_bytes
+    unpacked = array.array(typecode)
+    unpacked.frombytes(data)
+    if sys.byteorder != "little":
+        unpacked.byteswap()
+    return unpacked
+
+
+def _encode_table(table, symbol_index, encode_value):
+    """Encodes a GOTO or ACTION table as packed arrays."""
+    states = sorted(table)
+    offsets = [0]
+    symbols = []
+    values = []
+    for state in states:
+        for symbol, value in sorted(table[state].items()):
+            symbols.append(symbol_index[symbol])
+            values.append(encode_value(value))
+        offsets.append(len(symbols))
+    return tuple(_pack(column) for column in (states, offsets, symbols, values))
+
+
+def _decode_table(encoded, symbols, values=None):
+    """Decodes the output of _encode_table back into a dict of dicts.
+
+    If values is given, the encoded values are indexes into it; otherwise, they
+    are used as-is.
+    """
+    states, offsets, symbol_indexes, value_indexes = (
+        _unpack(column) for column in encoded
+    )
+    symbol_list = list(map(symbols.__getitem__, symbol_indexes))
+    if values is None:
+        value_list = value_indexes.tolist()
+    else:
+        value_list = list(map(values.__getitem__, value_indexes))
+    table = {}
+    for i, state in enumerate(states):
+        start, end = offsets[i], offsets[i + 1]
+        table[state] = dict(zip(symbol_list[start:end], value_list[start:end]))
+    return table
+
+
+def encode_parser(parser):
+    """Returns the table data for parser, as bytes.
+
+    Only the data needed for parsing is kept: item sets, terminal and
+    nonterminal sets, and the items of Shift actions are discarded.
+    """
+    assert not parser.conflicts, "Parsers with conflicts cannot be cached."
+    productions = sorted(parser.productions)
+    symbols = set()
+    for production in productions:
+        symbols.add(production.lhs)
+        symbols.update(production.rhs)
+    for table in (parser.action, parser.goto):
+        for state_table in table.values():
+            symbols.update(state_table)
+    symbols = sorted(symbols)
+    symbol_index = {symbol: i for i, symbol in enumerate(symbols)}
+    production_index = {production: i for i, production in enumerate(productions)}
+
+    error_codes = sorted(
+        {
+            value.code
+            for state_table in parser.action.values()
+            for value in state_table.values()
+            if isinstance(value, lr1.Error)
+        }
+        | set(parser.default_errors.values())
+    )
+    error_code_index = {code: i for i, code in enumerate(error_codes)}
+
+    actions = []
+    action_index = {}
+
+    def encode_action(action):
+        if isinstance(action, lr1.Shift):
+            key = (_SHIFT, action.state)
+        elif isinstance(action, lr1.Reduce):
+            key = (_REDUCE, production_index[action.rule])
+        elif isinstance(action, lr1.Accept):
+            key = (_ACCEPT, 0)
+        else:
+            assert isinstance(action, lr1.Error), action
+            key = (_ERROR, error_code_index[action.code])
+        if key not in action_index:
+            action_index[key] = len(actions)
+            actions.append(key)
+        return action_index[key]
+
+    # The ACTION table is encoded first, so that the numbering of the distinct
+    # actions is deterministic.
+    action_table = _encode_table(parser.action, symbol_index, encode_action)
+    goto_table = _encode_table(parser.goto, symbol_index, lambda state: state)
+    return marshal.dumps(
+        (
+            tuple(symbols),
+            tuple(
+                (
+                    symbol_index[production.lhs],
+                    tuple(symbol_index[symbol] for symbol in production.rhs),
+                )
+                for production in productions
+            ),
+            tuple(error_codes),
+            tuple(actions),
+            action_table,
+            goto_table,
+            tuple(
+                (state, error_code_index[code])
+                for state, code in sorted(parser.default_errors.items())
+            ),
+        ),
+        _MARSHAL_VERSION,
+    )
+
+
+def decode_parser(data):
+    """Returns the lr1.Parser encoded in data by encode_parser."""
+    (
+        symbols,
+        encoded_productions,
+        error_codes,
+        encoded_actions,
+        action_table,
+        goto_table,
+        default_errors,
+    ) = marshal.loads(data)
+    productions = [
+        parser_types.Production(symbols[lhs], tuple(symbols[i] for i in rhs))
+        for lhs, rhs in encoded_productions
+    ]
+    actions = []
+    for kind, argument in encoded_actions:
+        if kind == _SHIFT:
+            actions.append(lr1.Shift(argument, ()))
+        elif kind == _REDUCE:
+            actions.append(lr1.Reduce(productions[argument]))
+        elif kind == _ACCEPT:
+            actions.append(lr1.Accept())
+        else:
+            actions.append(lr1.Error(error_codes[argument]))
+    return lr1.Parser(
+        item_sets=None,
+        goto=_decode_table(goto_table, symbols),
+        action=_decode_table(action_table, symbols, actions),
+        conflicts=set(),
+        terminals=None,
+        nonterminals=None,
+        productions=set(productions),
+        default_errors={state: error_codes[code] for state, code in default_errors},
+    )
+
+
+def encode_parsers(parsers):
+    """Returns the contents of cached_parser.bin for a dict of named parsers."""
+    data = {"format_version": FORMAT_VERSION}
+    for name, parser in parsers.items():
+        data[name] = encode_parser(parser)
+    return marshal.dumps(data, _MARSHAL_VERSION)
+
+
+@simple_memoizer.memoize
+def load_file_data():
+    """Returns the raw contents of generated/cached_parser.bin."""
+    return resources.load_bytes("compiler.front_end", "generated/cached_parser.bin")
+
+
+def read_parser_tables(file_data):
+    """Returns a dict of parser names to table data, from encode_parsers output.
+
+    Returns None if file_data was written with a different FORMAT_VERSION, or
+    cannot be read at all.  Callers should treat this the same as a cached
+    parser that does not match the grammar, and generate a fresh parser.
+    """
+    try:
+        parsers = marshal.loads(file_data)
+    except (EOFError, ValueError, TypeError):
+        return None
+    if not isinstance(parsers, dict):
+        return None
+    if parsers.pop("format_version", None) != FORMAT_VERSION:
+        return None
+    return parsers
+
+
+@simple_memoizer.memoize
+def _load_parsers():
+    return read_parser_tables(load_file_data()) or {}
+
+
+def _load_parser(name):
+    data = _load_parsers().get(name)
+    if data is None:
+        return None
+    return decode_parser(data)
+
+
+def module_parser():
+    """Returns the cached parser for Emboss modules, or None if it is stale."""
+    return _load_parser("module_parser")
+
+
+def expression_parser():
+    """Returns the cached parser for Emboss expressions, or None if it is stale."""
+    return _load_parser("expression_parser")
@@ -0,0 +1,124 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Tests for front_end.cached_parser."""
+
+import collections
+import marshal
+import unittest
+
+from compiler.front_end import cached_parser
+from compiler.front_end import lr1
+from compiler.front_end import module_ir
+from compiler.util import parser_types
+
+Token = collections.namedtuple("Token", ["symbol", "source_location"])
+
+
+def _tokenize(text):
+    """ "Tokenizes" text by making each character into a token."""
+    return [
+        Token(text[i], parser_types.SourceLocation((1, i + 1), (1, i + 2)))
+        for i in range(len(text))
+    ]
+
+
+def _make_parser():
+    # Example grammar 4.54 from Aho, Sethi, Lam, Ullman (ASLU) p263.
+    parser = lr1.Grammar(
+        "S",
+        [
+            parser_types.Production.parse(line)
+            for line in ("S -> C C", "C -> c C", "C -> d")
+        ],
+    ).parser()
+    parser.mark_error(_tokenize("cccdc"), None, "missing last d")
+    parser.mark_error([lr1.ANY_TOKEN], lr1.ANY_TOKEN, "default error")
+    return parser
+
+
+def _without_shift_items(action_table):
+    return {
+        state: {
+            symbol: (
+                lr1.Shift(action.state, ()) if isinstance(action, lr1.Shift) else action
+            )
+            for symbol, action in actions.items()
+        }
+        for state, actions in action_table.items()
+    }
+
+
+class CachedParserTest(unittest.TestCase):
+    """Tests for front_end.cached_parser."""
+
+    def test_round_trip(self):
+        parser = _make_parser()
+        decoded = cached_parser.decode_parser(cached_parser.encode_parser(parser))
+        self.assertEqual(_without_shift_items(parser.action), decoded.action)
+        self.assertEqual(parser.goto, decoded.goto)
+        self.assertEqual(set(parser.productions), decoded.productions)
+        self.assertEqual(parser.default_errors, decoded.default_errors)
+        self.assertEqual(set(), decoded.conflicts)
+        self.assertIsNone(decoded.item_sets)
+
+    def test_decoded_parser_parses(self):
+        decoded = cached_parser.decode_parser(
+            cached_parser.encode_parser(_make_parser())
+        )
+        self.assertEqual("S", decoded.parse(_tokenize("cdd")).parse_tree.symbol)
+        self.assertEqual("missing last d", decoded.parse(_tokenize("cccdc")).error.code)
+
+    def test_encoding_is_deterministic(self):
+        self.assertEqual(
+            cached_parser.encode_parser(_make_parser()),
+            cached_parser.encode_parser(_make_parser()),
+        )
+
+    def test_read_parser_tables(self):
+        parser = _make_parser()
+        tables = cached_parser.read_parser_tables(
+            cached_parser.encode_parsers({"parser": parser})
+        )
+        self.assertEqual(["parser"], list(tables))
+        self.assertEqual(
+            parser.goto, cached_parser.decode_parser(tables["parser"]).goto
+        )
+
+    def test_read_parser_tables_rejects_stale_data(self):
+        stale = marshal.dumps(
+            {
+                "format_version": cached_parser.FORMAT_VERSION - 1,
+                "parser": cached_parser.encode_parser(_make_parser()),
+            }
+        )
+        self.assertIsNone(cached_parser.read_parser_tables(stale))
+        self.assertIsNone(cached_parser.read_parser_tables(marshal.dumps({})))
+        self.assertIsNone(cached_parser.read_parser_tables(b"not marshal data"))
+
+    def test_cached_parsers_match_grammar(self):
+        productions = set(module_ir.PRODUCTIONS)
+        self.assertEqual(
+            productions
+            | {parser_types.Production(lr1.START_PRIME, (module_ir.START_SYMBOL,))},
+            cached_parser.module_parser().productions,
+        )
+        self.assertEqual(
+            productions | {parser_types.Production(lr1.START_PRIME, ("expression",))},
+            cached_parser.expression_parser().productions,
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
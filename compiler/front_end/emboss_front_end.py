@@ -23,15 +23,17 @@ prints various bits of debug info, depending on which flags are passed.
 from __future__ import print_function
 
 import argparse
-import os
 from os import path
 import sys
 
 from compiler.front_end import glue
+from compiler.front_end import module_cache
 from compiler.front_end import module_ir
 from compiler.front_end import parser
 from compiler.util import error
+from compiler.util import ir_data_binary
 from compiler.util import ir_data_utils
+from compiler.util import pass_profiler
 
 
 def _parse_command_line(argv):
@@ -84,6 +86,14 @@ def _parse_command_line(argv):
         help="Dump serialized IR to stdout.",
     )
     parser.add_argument("--output-file", type=str, help="Write serialized IR to file.")
+    parser.add_argument(
+        "--output-ir-format",
+        default="json",
+        choices=["json", "binary"],
+        help="The format of serialized IR.  Binary IR is smaller and much faster "
+        "to read and write, but can only be read by a back end from the same "
+        "version of Emboss.",
+    )
     parser.add_argument(
         "--no-debug-show-header-lines",
         dest="debug_show_header_lines",
@@ -106,6 +116,30 @@ def _parse_command_line(argv):
         "embs.  If no import_dirs are specified, the "
         "current directory will be used.",
     )
+    parser.add_argument(
+        "--ir-cache-dir",
+        type=str,
+        help="Cache the parsed form of each module in this directory, so that "
+        "modules which are imported by many .embs are only parsed once.  The "
+        "directory may be shared by concurrent compilations.",
+    )
+    parser.add_argument(
+        "--time-passes",
+        action="store_true",
+        help="Report the wall time and output size of each compiler pass.",
+    )
+    parser.add_argument(
+        "--profile-passes",
+        action="store_true",
+        help="Like --time-passes, but also report the peak memory use of each "
+        "pass.  Memory tracing slows compilation down considerably.",
+    )
+    parser.add_argument(
+        "--pass-report-file",
+        type=str,
+        help="Write the --time-passes or --profile-passes report to this file "
+        "as JSON, instead of printing it to stderr.",
+    )
     return parser.parse_args(argv[1:])
 
 
@@ -116,12 +150,12 @@ def _show_errors(errors, ir, color_output):
         for module in ir.module:
             source_codes[module.source_file_name] = module.source_text
     use_color = color_output == "always" or (
-        color_output in ("auto", "if_tty") and os.isatty(sys.stderr.fileno())
+        color_output in ("auto", "if_tty") and sys.stderr.isatty()
     )
     print(error.format_errors(errors, source_codes, use_color), file=sys.stderr)
 
 
-def _find_in_dirs_and_read(import_dirs):
+def find_in_dirs_and_read(import_dirs):
     """Returns a function which will search import_dirs for a file."""
 
     def _find_and_read(file_name):
@@ -180,13 +214,24 @@ def _warn_if_cached_parser_is_mismatched(color_output):
         )
 
 
-def parse_and_log_errors(input_file, import_dirs, color_output, stop_before_step=None):
+def parse_and_log_errors(
+    input_file,
+    import_dirs,
+    color_output,
+    stop_before_step=None,
+    ir_cache_dir=None,
+    file_reader=None,
+):
     """Fully parses an .emb and logs any errors.
 
     Arguments:
       input_file: The path of the module source file.
       import_dirs: Directories to search for imported dependencies.
       color_output: Used when logging errors: "always", "never", "if_tty", "auto"
+      stop_before_step: If set, stop processing the IR before this step.
+      ir_cache_dir: If set, a directory in which to cache module-level IR.
+      file_reader: If set, used to read source files instead of
+          find_in_dirs_and_read(import_dirs).
 
     Returns:
       (ir, debug_info, errors)
@@ -194,8 +239,9 @@ def parse_and_log_errors(input_file, import_dirs, color_output, stop_before_step
     _warn_if_cached_parser_is_mismatched(color_output)
     ir, debug_info, errors = glue.parse_emboss_file(
         input_file,
-        _find_in_dirs_and_read(import_dirs),
+        file_reader or find_in_dirs_and_read(import_dirs),
         stop_before_step=stop_before_step,
+        module_cache=module_cache.ModuleCache(ir_cache_dir) if ir_cache_dir else None,
     )
     if errors:
         _show_errors(errors, ir, color_output)
@@ -204,11 +250,40 @@ def parse_and_log_errors(input_file, import_dirs, color_output, stop_before_step
 
 
 def main(flags):
+    if not (flags.time_passes or flags.profile_passes):
+        return _main(flags)
+    pass_profiler.start()
+    try:
+        # Loading the parser tables is slow under tracemalloc, so it is done
+        # before memory tracing starts.
+        with pass_profiler.measure("parser.load_tables"):
+            parser.module_parser()
+        if flags.profile_passes:
+            pass_profiler.start_tracing_memory()
+        return _main(flags)
+    finally:
+        pass_profiler.stop().report(flags.pass_report_file)
+
+
+def _needs_parse_debug_info(flags):
+    """Returns True if flags ask for data which the IR cache does not keep."""
+    return (
+        flags.debug_show_tokenization
+        or flags.debug_show_parse_tree
+        or flags.debug_show_used_productions
+        or flags.debug_show_unused_productions
+    )
+
+
+def _main(flags):
+    # Modules loaded from the IR cache have no tokens, parse tree, or used
+    # productions, so the cache is bypassed when any of those are requested.
     ir, debug_info, errors = parse_and_log_errors(
         flags.input_file[0],
         flags.import_dirs,
         flags.color_output,
         stop_before_step=flags.debug_stop_before_step,
+        ir_cache_dir=None if _needs_parse_debug_info(flags) else flags.ir_cache_dir,
     )
     if errors:
         return 1
@@ -242,10 +317,18 @@ def main(flags):
             )
         )
     if flags.output_ir_to_stdout:
-        print(ir_data_utils.IrDataSerializer(ir).to_json())
+        if flags.output_ir_format == "binary":
+            sys.stdout.flush()
+            sys.stdout.buffer.write(ir_data_binary.to_binary(ir))
+        else:
+            print(ir_data_utils.IrDataSerializer(ir).to_json())
     if flags.output_file:
-        with open(flags.output_file, "w") as f:
-            f.write(ir_data_utils.IrDataSerializer(ir).to_json())
+        if flags.output_ir_format == "binary":
+            with open(flags.output_file, "wb") as f:
+                f.write(ir_data_binary.to_binary(ir))
+        else:
+            with open(flags.output_file, "w") as f:
+                f.write(ir_data_utils.IrDataSerializer(ir).to_json())
     return 0
 
 
@@ -37,6 +37,7 @@ from compiler.util import error
 from compiler.util import ir_data
 from compiler.util import ir_data_utils
 from compiler.util import parser_types
+from compiler.util import pass_profiler
 from compiler.util import resources
 
 _IrDebugInfo = collections.namedtuple("IrDebugInfo", ["ir", "debug_info", "errors"])
@@ -135,13 +136,30 @@ def format_production_set(productions):
 _cached_modules = {}
 
 
-def parse_module_text(source_code, file_name):
+def prune_cached_modules(live_modules):
+    """Forgets cached modules, other than the prelude, not in live_modules.
+
+    Every version of every module that has been parsed is cached, which is fine
+    for a single compilation, but lets a long-running compiler grow without bound
+    as files are edited.  Such compilers call prune_cached_modules with the
+    (source_code, file_name) pairs that they still expect to see.
+    """
+    live_modules = set(live_modules)
+    for key in list(_cached_modules):
+        source_code, file_name = key
+        if file_name and key not in live_modules:
+            del _cached_modules[key]
+
+
+def parse_module_text(source_code, file_name, module_cache=None):
     """Parses the text of a module, returning a module-level IR.
 
     Arguments:
       source_code: The text of the module to parse.
       file_name: The name of the module's source file (will be included in the
           resulting IR).
+      module_cache: An optional module_cache.ModuleCache, which is checked for
+          the module's IR before parsing, and updated after.
 
     Returns:
       A module-level intermediate representation (IR), prior to import and symbol
@@ -156,14 +174,28 @@ def parse_module_text(source_code, file_name):
     if (source_code, file_name) in _cached_modules:
         debug_info = _cached_modules[source_code, file_name]
         ir = ir_data_utils.copy(debug_info.ir)
+    elif (
+        module_cache
+        and (ir := _load_cached_module(module_cache, source_code, file_name))
+        is not None
+    ):
+        # Modules loaded from the on-disk cache have no tokenization or parse
+        # tree.  They are not added to _cached_modules, so that a later call
+        # without module_cache still gets complete debug info.
+        debug_info = ModuleDebugInfo(file_name)
+        debug_info.source_code = source_code
+        debug_info.ir = ir_data_utils.copy(ir)
     else:
         debug_info = ModuleDebugInfo(file_name)
         debug_info.source_code = source_code
-        tokens, errors = tokenizer.tokenize(source_code, file_name)
+        with pass_profiler.measure("tokenizer.tokenize") as stats:
+            tokens, errors = tokenizer.tokenize(source_code, file_name)
+        stats.set_node_count(len(tokens or ()))
         if errors:
             return _IrDebugInfo(None, debug_info, errors)
         debug_info.tokens = tokens
-        parse_result = parser.parse_module(tokens)
+        with pass_profiler.measure("parser.parse_module"):
+            parse_result = parser.parse_module(tokens)
         if parse_result.error:
             return _IrDebugInfo(
                 None,
@@ -172,16 +204,29 @@ def parse_module_text(source_code, file_name):
             )
         debug_info.parse_tree = parse_result.parse_tree
         used_productions = set()
-        ir = module_ir.build_ir(parse_result.parse_tree, used_productions)
+        with pass_profiler.measure("module_ir.build_ir") as stats:
+            ir = module_ir.build_ir(parse_result.parse_tree, used_productions)
+        stats.count_ir_nodes(ir)
         ir.source_text = source_code
         debug_info.used_productions = used_productions
         debug_info.ir = ir_data_utils.copy(ir)
         _cached_modules[source_code, file_name] = debug_info
+        if module_cache:
+            with pass_profiler.measure("module_cache.put"):
+                module_cache.put(source_code, file_name, ir)
     ir.source_file_name = file_name
     return _IrDebugInfo(ir, debug_info, [])
 
 
-def parse_module(file_name, file_reader):
+def _load_cached_module(module_cache, source_code, file_name):
+    with pass_profiler.measure("module_cache.get") as stats:
+        ir = module_cache.get(source_code, file_name)
+    if ir is not None:
+        stats.count_ir_nodes(ir)
+    return ir
+
+
+def parse_module(file_name, file_reader, module_cache=None):
     """Parses a module, returning a module-level IR.
 
     Arguments:
@@ -189,6 +234,7 @@ def parse_module(file_name, file_reader):
       file_reader: A callable that returns either:
           (file_contents, None) or
           (None, list_of_error_detail_strings)
+      module_cache: An optional module_cache.ModuleCache.
 
     Returns:
       (ir, debug_info, errors), where ir is a module-level intermediate
@@ -212,15 +258,17 @@ def parse_module(file_name, file_reader):
                 + [error.note(file_name, location, e) for e in errors]
             ],
         )
-    return parse_module_text(source_code, file_name)
+    return parse_module_text(source_code, file_name, module_cache)
 
 
-def get_prelude():
+def get_prelude(module_cache=None):
     """Returns the module IR and debug info of the Emboss Prelude."""
-    return parse_module_text(resources.load("compiler.front_end", "prelude.emb"), "")
+    return parse_module_text(
+        resources.load("compiler.front_end", "prelude.emb"), "", module_cache
+    )
 
 
-def parse_emboss_file(file_name, file_reader, stop_before_step=None):
+def parse_emboss_file(file_name, file_reader, stop_before_step=None, module_cache=None):
     """Fully parses an .emb, and returns an IR suitable for passing to a back end.
 
     parse_emboss_file is a convenience function which calls only_parse_emboss_file
@@ -233,6 +281,8 @@ def parse_emboss_file(file_name, file_reader, stop_before_step=None):
       stop_before_step: If set, parse_emboss_file will stop normalizing the IR
           just before the specified step.  This parameter should be None for
           non-test code.
+      module_cache: An optional module_cache.ModuleCache, used to avoid
+          re-parsing modules which have been parsed before.
 
     Returns:
       (ir, debug_info, errors), where ir is a complete IR, ready for consumption
@@ -241,7 +291,9 @@ def parse_emboss_file(file_name, file_reader, stop_before_step=None):
       errors is a list of tokenization or parse errors.  If errors is not an empty
       list, ir will be None.
     """
-    ir, debug_info, errors = only_parse_emboss_file(file_name, file_reader)
+    ir, debug_info, errors = only_parse_emboss_file(
+        file_name, file_reader, module_cache
+    )
     if errors:
         return _IrDebugInfo(None, debug_info, errors)
     ir, errors = process_ir(ir, stop_before_step)
@@ -250,7 +302,7 @@ def parse_emboss_file(file_name, file_reader, stop_before_step=None):
     return _IrDebugInfo(ir, debug_info, errors)
 
 
-def only_parse_emboss_file(file_name, file_reader):
+def only_parse_emboss_file(file_name, file_reader, module_cache=None):
     """Parses an .emb, and returns an IR suitable for process_ir.
 
     only_parse_emboss_file parses the given file and all of its transitive
@@ -261,6 +313,7 @@ def only_parse_emboss_file(file_name, file_reader):
       file_name: The name of the module's source file.
       file_reader: A callable that returns the contents of files, or raises
           IOError.
+      module_cache: An optional module_cache.ModuleCache.
 
     Returns:
       (ir, debug_info, errors), where ir is an intermediate representation (IR),
@@ -276,9 +329,11 @@ def only_parse_emboss_file(file_name, file_reader):
         file_to_parse = file_queue[0]
         del file_queue[0]
         if file_to_parse:
-            module, module_debug_info, errors = parse_module(file_to_parse, file_reader)
+            module, module_debug_info, errors = parse_module(
+                file_to_parse, file_reader, module_cache
+            )
         else:
-            module, module_debug_info, errors = get_prelude()
+            module, module_debug_info, errors = get_prelude(module_cache)
         if module_debug_info:
             debug_info.modules[file_to_parse] = module_debug_info
         if errors:
@@ -376,7 +431,10 @@ def process_ir(ir, stop_before_step):
     for function in passes:
         if stop_before_step == function.__name__:
             return (ir, [])
-        errors, hidden_errors = error.split_errors(function(ir))
+        pass_name = function.__module__.rsplit(".", 1)[-1] + "." + function.__name__
+        with pass_profiler.measure(pass_name) as stats:
+            errors, hidden_errors = error.split_errors(function(ir))
+        stats.count_ir_nodes(ir)
         if errors:
             return (None, errors)
         deferred_errors.extend(hidden_errors)
@@ -221,6 +221,19 @@ class FrontEndGlueTest(unittest.TestCase):
         self.assertEqual(_SPAN_SE_LOG_FILE_PATH, ir.module[0].source_file_name)
         self.assertEqual("", ir.module[1].source_file_name)
 
+    def test_prune_cached_modules(self):
+        old_reader = test_util.dict_file_reader({"m.emb": "# Old\n"})
+        new_reader = test_util.dict_file_reader({"m.emb": "# New\n"})
+        old_ir = glue.parse_module("m.emb", old_reader).ir
+        glue.parse_emboss_file("m.emb", new_reader)
+        glue.prune_cached_modules([("# New\n", "m.emb")])
+        self.assertNotIn(("# Old\n", "m.emb"), glue._cached_modules)
+        self.assertIn(("# New\n", "m.emb"), glue._cached_modules)
+        # The prelude is always kept.
+        self.assertTrue(any(file_name == "" for _, file_name in glue._cached_modules))
+        # Pruned modules are just parsed again.
+        self.assertEqual(old_ir, glue.parse_module("m.emb", old_reader).ir)
+
     def test_synthetic_error(self):
         file_name = "missing_byte_order_attribute.emb"
         ir, unused_debug_info, errors = glue.only_parse_emboss_file(
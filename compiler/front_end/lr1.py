@@ -26,6 +26,7 @@ Clients are expected to provide their own tokenizers and handle turning a raw
 parse tree into an intermediate representation on their own.
 """
 
+import array
 import collections
 
 from compiler.util import parser_types
@@ -162,7 +163,9 @@ class Reduction(
         did not include source_location.
     """
 
-    pass
+    # Parse trees have a Reduction for every nonterminal, so they should not each
+    # have a __dict__.
+    __slots__ = ()
 
 
 class Grammar(object):
@@ -553,6 +556,112 @@ ParseError = collections.namedtuple(
 ParseResult = collections.namedtuple("ParseResult", ["parse_tree", "error"])
 
 
+# The kinds of entries in a _ParseTables action table.  Each entry is an int,
+# with the kind in its low two bits, and an argument (a state, an index into
+# _ParseTables.reductions, or an index into _ParseTables.error_codes) in the
+# rest.
+_SHIFT = 0
+_REDUCE = 1
+_ACCEPT = 2
+_ERROR = 3
+
+
+class _ParseTables(object):
+    """Integer-indexed forms of a Parser's ACTION and GOTO tables.
+
+    Terminals and nonterminals are interned to small integers, and the ACTION
+    and GOTO tables are stored as flat arrays, so that the inner loop of
+    Parser.parse only does integer indexing.
+
+    Attributes:
+      terminal_ids: A dict from terminal symbol to column in the action table.
+        Symbols which are not in terminal_ids should use unknown_terminal_id.
+      unknown_terminal_id: The action table column for symbols which never have
+        a non-default action.
+      column_count: The number of columns in each row of the action table.
+      action: An array of encoded actions: the action for state s and terminal
+        id t is at action[s * column_count + t].  Entries for which the Parser
+        has no explicit action encode the state's default error.
+      error_codes: A list of error codes referenced by _ERROR actions.  Entry 0
+        is always None.
+      reductions: A list of (lhs, goto_column, rhs_length, production) tuples
+        referenced by _REDUCE actions.
+      goto_rows: An array giving the start of each state's row in goto, or -1 if
+        the state has no GOTO entries.
+      goto: An array of target states: the GOTO for state s and a nonterminal
+        with goto_column c is at goto[goto_rows[s] + c].
+    """
+
+    def __init__(self, parser):
+        terminals = set()
+        for actions in parser.action.values():
+            terminals.update(actions)
+        self.terminal_ids = {
+            symbol: i for i, symbol in enumerate(sorted(terminals, key=str))
+        }
+        self.unknown_terminal_id = len(self.terminal_ids)
+        self.column_count = self.unknown_terminal_id + 1
+
+        nonterminals = set()
+        for gotos in parser.goto.values():
+            nonterminals.update(gotos)
+        goto_columns = {
+            symbol: i for i, symbol in enumerate(sorted(nonterminals, key=str))
+        }
+
+        self.error_codes = [None]
+        error_code_ids = {None: 0}
+
+        def error(code):
+            if code not in error_code_ids:
+                error_code_ids[code] = len(self.error_codes)
+                self.error_codes.append(code)
+            return error_code_ids[code] << 2 | _ERROR
+
+        self.reductions = []
+        reduction_ids = {}
+
+        def encode(action):
+            if isinstance(action, Shift):
+                return action.state << 2 | _SHIFT
+            elif isinstance(action, Reduce):
+                if action.rule not in reduction_ids:
+                    reduction_ids[action.rule] = len(self.reductions)
+                    self.reductions.append(
+                        (
+                            action.rule.lhs,
+                            goto_columns.get(action.rule.lhs, -1),
+                            len(action.rule.rhs),
+                            action.rule,
+                        )
+                    )
+                return reduction_ids[action.rule] << 2 | _REDUCE
+            elif isinstance(action, Accept):
+                return _ACCEPT
+            else:
+                assert isinstance(action, Error), action
+                return error(action.code)
+
+        state_count = 1 + max(
+            list(parser.action) + list(parser.goto) + list(parser.default_errors)
+        )
+        self.action = array.array("i")
+        for state in range(state_count):
+            row = [error(parser.default_errors.get(state))] * self.column_count
+            for symbol, action in parser.action.get(state, {}).items():
+                row[self.terminal_ids[symbol]] = encode(action)
+            self.action.extend(row)
+
+        self.goto_rows = array.array("i", [-1]) * state_count
+        self.goto = array.array("i")
+        for state, gotos in sorted(parser.goto.items()):
+            self.goto_rows[state] = len(self.goto)
+            row = [-1] * len(goto_columns)
+            for symbol, target in gotos.items():
+                row[goto_columns[symbol]] = target
+            self.goto.extend(row)
+
+
 class Parser(object):
     """Parser is a shift-reduce LR(1) parser.
 
@@ -600,6 +709,10 @@ class Parser(object):
         self.nonterminals = nonterminals
         self.productions = productions
         self.default_errors = default_errors or {}
+        # The integer-indexed tables used by parse(), built on first use.  They
+        # must be rebuilt (by setting this to None) if goto, action, or
+        # default_errors change.
+        self._tables = None
 
     def parse(self, tokens):
         """parse implements the Shift-Reduce parsing algorithm.
@@ -608,55 +721,58 @@ class Parser(object):
         pp236-237.
 
         Arguments:
-          tokens: the list of token objects to parse.
+          tokens: an iterable of token objects to parse.
 
         Returns:
           A ParseResult.
         """
-        # The END_OF_INPUT token is explicitly added to avoid explicit "cursor <
-        # len(tokens)" checks.
-        tokens = list(tokens) + [Symbol(END_OF_INPUT)]
-
-        # Each element of stack is a parse state and a (possibly partial) parse
-        # tree.  The state at the top of the stack encodes which productions are
-        # "active" (that is, which ones the parser has seen partial input which
-        # matches some prefix of the production, in a place where that production
-        # might be valid), and, for each active production, how much of the
-        # production has been completed.
-        stack = [(0, None)]
-
-        def state():
-            return stack[-1][0]
-
+        if self._tables is None:
+            self._tables = _ParseTables(self)
+        tables = self._tables
+        action = tables.action
+        column_count = tables.column_count
+        terminal_id = tables.terminal_ids.get
+        unknown_terminal_id = tables.unknown_terminal_id
+        reductions = tables.reductions
+        goto = tables.goto
+        goto_rows = tables.goto_rows
+
+        # The END_OF_INPUT token is returned once the input is exhausted, to avoid
+        # explicit end-of-input checks.
+        end_of_input = Symbol(END_OF_INPUT)
+        token_iterator = iter(tokens)
+        token = next(token_iterator, end_of_input)
         cursor = 0
 
+        # Each entry of states is a parse state, and the corresponding entry of
+        # trees is a (possibly partial) parse tree.  The state at the top of the
+        # stack encodes which productions are "active" (that is, which ones the
+        # parser has seen partial input which matches some prefix of the
+        # production, in a place where that production might be valid), and, for
+        # each active production, how much of the production has been completed.
+        states = [0]
+        trees = [None]
+
         # On each iteration, look at the next symbol and the current state, and
-        # perform the corresponding action.
+        # perform the corresponding action.  Most state/symbol entries would be
+        # Errors, so rather than exhaustively listing error entries, the tables
+        # fill each state's missing entries with its default error.
         while True:
-            if tokens[cursor].symbol not in self.action.get(state(), {}):
-                # Most state/symbol entries would be Errors, so rather than exhaustively
-                # adding error entries, we just check here.
-                if state() in self.default_errors:
-                    next_action = Error(self.default_errors[state()])
-                else:
-                    next_action = Error(None)
-            else:
-                next_action = self.action[state()][tokens[cursor].symbol]
+            next_action = action[
+                states[-1] * column_count
+                + terminal_id(token.symbol, unknown_terminal_id)
+            ]
+            kind = next_action & 3
 
-            if isinstance(next_action, Shift):
+            if kind == _SHIFT:
                 # Shift means that there are no "complete" productions on the stack,
                 # and so the current token should be shifted onto the stack, with a new
                 # state indicating the new set of "active" productions.
-                stack.append((next_action.state, tokens[cursor]))
+                states.append(next_action >> 2)
+                trees.append(token)
                 cursor += 1
-            elif isinstance(next_action, Accept):
-                # Accept means that parsing is over, successfully.
-                assert len(stack) == 2, "Accepted incompletely-reduced input."
-                assert tokens[cursor].symbol == END_OF_INPUT, (
-                    "Accepted parse before " "end of input."
-                )
-                return ParseResult(stack[-1][1], None)
-            elif isinstance(next_action, Reduce):
+                token = next(token_iterator, end_of_input)
+            elif kind == _REDUCE:
                 # Reduce means that there is a complete production on the stack, and
                 # that the next symbol implies that the completed production is the
                 # correct production.
@@ -670,55 +786,56 @@ class Parser(object):
                 # Here, we attach a new partial parse tree, with the production lhs as
                 # the "name" of the tree, and the popped trees as the "children" of the
                 # new tree.
-                children = [
-                    item[1] for item in stack[len(stack) - len(next_action.rule.rhs) :]
-                ]
+                lhs, goto_column, rhs_length, rule = reductions[next_action >> 2]
+                if rhs_length:
+                    children = trees[-rhs_length:]
+                    del trees[-rhs_length:]
+                    del states[-rhs_length:]
+                else:
+                    children = []
                 # Attach source_location, if known.  The source location will not be
                 # known if the reduction consumes no symbols (empty rhs) or if the
                 # client did not specify source_locations for tokens.
                 #
-                # It is necessary to loop in order to handle cases like:
+                # merge_source_locations skips children without source locations,
+                # in order to handle cases like:
                 #
                 # C -> c D
                 # D ->
                 #
                 # The D child of the C reduction will not have a source location
-                # (because it is not produced from any source), so it is necessary to
-                # scan backwards through C's children to find the end position.  The
-                # opposite is required in the case where initial children have no
-                # source.
-                #
-                # These loops implicitly handle the case where the reduction has no
-                # children, setting the source_location to None in that case.
-                start_position = None
-                end_position = None
+                # (because it is not produced from any source), so the end position
+                # of C comes from c.
                 source_location = parser_types.merge_source_locations(*children)
-                reduction = Reduction(
-                    next_action.rule.lhs, children, next_action.rule, source_location
+                trees.append(Reduction(lhs, children, rule, source_location))
+                states.append(goto[goto_rows[states[-1]] + goto_column])
+            elif kind == _ACCEPT:
+                # Accept means that parsing is over, successfully.
+                assert len(states) == 2, "Accepted incompletely-reduced input."
+                assert token.symbol == END_OF_INPUT, (
+                    "Accepted parse before " "end of input."
                 )
-                del stack[len(stack) - len(next_action.rule.rhs) :]
-                stack.append((self.goto[state()][next_action.rule.lhs], reduction))
-            elif isinstance(next_action, Error):
+                return ParseResult(trees[-1], None)
+            else:
                 # Error means that the parse is impossible.  For typical grammars and
                 # texts, this usually happens within a few tokens after the mistake in
                 # the input stream, which is convenient (though imperfect) for error
                 # reporting.
+                state = states[-1]
                 return ParseResult(
                     None,
                     ParseError(
-                        next_action.code,
+                        tables.error_codes[next_action >> 2],
                         cursor,
-                        tokens[cursor],
-                        state(),
+                        token,
+                        state,
                         set(
                             k
-                            for k in self.action[state()].keys()
-                            if not isinstance(self.action[state()][k], Error)
+                            for k in self.action[state].keys()
+                            if not isinstance(self.action[state][k], Error)
                         ),
                     ),
                 )
-            else:
-                assert False, "Shouldn't be here."
 
     def mark_error(self, tokens, error_token, error_code):
         """Marks an error state with the given error code.
@@ -783,6 +900,7 @@ class Parser(object):
                     )
             else:
                 self.default_errors[result.error.state] = error_code
+                self._tables = None
                 return None
         else:
             if error_symbol in self.action.get(result.error.state, {}):
@@ -802,5 +920,6 @@ class Parser(object):
                     )
             else:
                 self.action[result.error.state][error_symbol] = Error(error_code)
+                self._tables = None
                 return None
         assert False, "All other paths should lead to return."
@@ -353,6 +353,27 @@ class Lr1Test(unittest.TestCase):
         self.assertEqual("missing last C", parser.parse(_tokenize("ccccd")).error.code)
         self.assertEqual(None, parser.parse(_tokenize("ccc")).error.code)
 
+    def test_mark_error_after_parse(self):
+        parser = _alsu_grammar.parser()
+        self.assertEqual(None, parser.parse(_tokenize("d")).error.code)
+        self.assertIsNone(parser.mark_error(_tokenize("d"), None, "missing last C"))
+        self.assertEqual("missing last C", parser.parse(_tokenize("d")).error.code)
+        self.assertEqual(None, parser.parse(_tokenize("z")).error.code)
+        self.assertIsNone(
+            parser.mark_error([lr1.ANY_TOKEN], lr1.ANY_TOKEN, "default error")
+        )
+        self.assertEqual("default error", parser.parse(_tokenize("z")).error.code)
+
+    def test_parse_from_iterator(self):
+        parser = _alsu_grammar.parser()
+        self.assertEqual(
+            parser.parse(_tokenize("cdd")).parse_tree,
+            parser.parse(iter(_tokenize("cdd"))).parse_tree,
+        )
+        error = parser.parse(iter(_tokenize("cdc"))).error
+        self.assertEqual(3, error.index)
+        self.assertEqual("$", error.token.symbol)
+
     def test_grammar_with_empty_rhs(self):
         grammar = lr1.Grammar(
             "S",
@@ -0,0 +1,135 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""On-disk cache of module-level IR.
+
+Tokenizing, parsing, and building the module-level IR of a module depends only
+on the module's source text, its file name, and the compiler itself.  A
+ModuleCache stores the module-level IR of each module it sees in a directory,
+under a key derived from all three, so that a module which is imported by many
+.embs only has to be parsed once.
+
+The cache directory may be shared by concurrent compiler invocations: entries
+are written to a temporary file and then atomically renamed into place, so a
+reader sees either a complete entry or no entry at all.  Unreadable entries are
+treated as cache misses.
+"""
+
+import hashlib
+import os
+import sys
+import tempfile
+
+from compiler.front_end import cached_parser
+from compiler.front_end import lr1
+from compiler.front_end import module_ir
+from compiler.front_end import parser
+from compiler.front_end import tokenizer
+from compiler.util import ir_data
+from compiler.util import ir_data_binary
+from compiler.util import ir_data_fields
+from compiler.util import ir_data_utils
+from compiler.util import name_conversion
+from compiler.util import parser_types
+from compiler.util import parser_util
+from compiler.util import simple_memoizer
+
+# Bump this if the format of cache entries changes.
+_CACHE_FORMAT_VERSION = b"2"
+
+# The modules whose code determines the module-level IR of a module.  Any change
+# to one of them invalidates every cache entry.
+_IR_PRODUCING_MODULES = (
+    cached_parser,
+    ir_data,
+    ir_data_binary,
+    ir_data_fields,
+    ir_data_utils,
+    lr1,
+    module_ir,
+    name_conversion,
+    parser,
+    parser_types,
+    parser_util,
+    tokenizer,
+)
+
+
+@simple_memoizer.memoize
+def compiler_fingerprint():
+    """Returns a hash of the IR-producing modules and the parser tables."""
+    fingerprint = hashlib.sha256(_CACHE_FORMAT_VERSION)
+    for module in _IR_PRODUCING_MODULES:
+        source = module.__loader__.get_source(module.__name__)
+        fingerprint.update(module.__name__.encode("utf-8"))
+        fingerprint.update(b"\0")
+        fingerprint.update(hashlib.sha256(source.encode("utf-8")).digest())
+    fingerprint.update(hashlib.sha256(cached_parser.load_file_data()).digest())
+    return fingerprint.hexdigest()
+
+
+class ModuleCache(object):
+    """A directory of cached module-level IRs."""
+
+    def __init__(self, directory):
+        self.directory = directory
+
+    def _entry_path(self, source_code, file_name):
+        key = hashlib.sha256()
+        key.update(compiler_fingerprint().encode("utf-8"))
+        for part in (file_name, source_code):
+            encoded = part.encode("utf-8")
+            key.update(str(len(encoded)).encode("utf-8"))
+            key.update(b":")
+            key.update(encoded)
+        digest = key.hexdigest()
+        # Spread entries across subdirectories, so that no single directory gets
+        # too large.
+        return os.path.join(self.directory, digest[:2], digest[2:] + ".bin")
+
+    def get(self, source_code, file_name):
+        """Returns the cached module IR for source_code, or None on a miss."""
+        try:
+            with open(self._entry_path(source_code, file_name), "rb") as f:
+                return ir_data_binary.from_binary(ir_data.Module, f.read())
+        except (OSError, ValueError, TypeError, AttributeError, KeyError, IndexError):
+            # Missing and corrupt entries are both just cache misses.
+            return None
+
+    def put(self, source_code, file_name, module):
+        """Stores module as the module IR for source_code.
+
+        Failures to write to the cache are ignored: the cache only makes
+        compilation faster, and is never required for correctness.
+        """
+        path = self._entry_path(source_code, file_name)
+        temp_name = None
+        try:
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with tempfile.NamedTemporaryFile(
+                "wb", dir=os.path.dirname(path), suffix=".tmp", delete=False
+            ) as f:
+                temp_name = f.name
+                f.write(ir_data_binary.to_binary(module))
+            os.replace(temp_name, path)
+        except OSError as e:
+            print(
+                "Unable to write module cache entry {}: {}".format(path, e),
+                file=sys.stderr,
+            )
+            if temp_name is not None:
+                try:
+                    os.remove(temp_name)
+                except OSError:
+                    pass
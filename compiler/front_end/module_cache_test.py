@@ -0,0 +1,160 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Tests for front_end.module_cache."""
+
+import contextlib
+import io
+import os
+import tempfile
+import unittest
+
+from compiler.front_end import emboss_front_end
+from compiler.front_end import glue
+from compiler.front_end import module_cache
+
+_SOURCE = """\
+struct Foo:
+  0 [+1]  UInt  bar
+"""
+
+
+class ModuleCacheTest(unittest.TestCase):
+
+    def setUp(self):
+        self._directory = tempfile.TemporaryDirectory()
+        self.cache = module_cache.ModuleCache(self._directory.name)
+        glue._cached_modules.clear()
+
+    def tearDown(self):
+        self._directory.cleanup()
+        glue._cached_modules.clear()
+
+    def _parse(self, source=_SOURCE, file_name="foo.emb"):
+        ir, _, errors = glue.parse_module_text(source, file_name)
+        self.assertFalse(errors)
+        return ir
+
+    def _entries(self):
+        return [
+            os.path.join(root, name)
+            for root, _, names in os.walk(self._directory.name)
+            for name in names
+        ]
+
+    def test_miss_on_empty_cache(self):
+        self.assertIsNone(self.cache.get(_SOURCE, "foo.emb"))
+
+    def test_round_trip(self):
+        ir = self._parse()
+        self.cache.put(_SOURCE, "foo.emb", ir)
+        self.assertEqual(ir, self.cache.get(_SOURCE, "foo.emb"))
+        self.assertEqual(1, len(self._entries()))
+
+    def test_key_includes_source_and_file_name(self):
+        self.cache.put(_SOURCE, "foo.emb", self._parse())
+        self.assertIsNone(self.cache.get(_SOURCE + "\n", "foo.emb"))
+        self.assertIsNone(self.cache.get(_SOURCE, "bar.emb"))
+
+    def test_corrupt_entries_are_misses(self):
+        self.cache.put(_SOURCE, "foo.emb", self._parse())
+        (entry,) = self._entries()
+        with open(entry, "rb") as f:
+            data = f.read()
+        with open(entry, "wb") as f:
+            f.write(data[: len(data) // 2])
+        self.assertIsNone(self.cache.get(_SOURCE, "foo.emb"))
+        with open(entry, "w") as f:
+            f.write('{"type": [')
+        self.assertIsNone(self.cache.get(_SOURCE, "foo.emb"))
+
+    def test_unwritable_cache_is_ignored(self):
+        # A regular file where the cache directory should be.
+        not_a_directory = os.path.join(self._directory.name, "file")
+        with open(not_a_directory, "w"):
+            pass
+        cache = module_cache.ModuleCache(not_a_directory)
+        cache.put(_SOURCE, "foo.emb", self._parse())
+        self.assertIsNone(cache.get(_SOURCE, "foo.emb"))
+
+    def test_parse_module_text_uses_cache(self):
+        ir, debug_info, errors = glue.parse_module_text(_SOURCE, "foo.emb", self.cache)
+        self.assertFalse(errors)
+        self.assertIsNotNone(debug_info.tokens)
+        self.assertEqual(1, len(self._entries()))
+        glue._cached_modules.clear()
+        cached_ir, cached_debug_info, errors = glue.parse_module_text(
+            _SOURCE, "foo.emb", self.cache
+        )
+        self.assertFalse(errors)
+        self.assertEqual(ir, cached_ir)
+        self.assertEqual("foo.emb", cached_ir.source_file_name)
+        # The module was not re-parsed.
+        self.assertIsNone(cached_debug_info.tokens)
+        self.assertEqual(debug_info.ir, cached_debug_info.ir)
+
+    def test_parse_module_text_does_not_memoize_cached_modules(self):
+        glue.parse_module_text(_SOURCE, "foo.emb", self.cache)
+        glue._cached_modules.clear()
+        glue.parse_module_text(_SOURCE, "foo.emb", self.cache)
+        # A later parse without the cache gets full debug info.
+        _, debug_info, errors = glue.parse_module_text(_SOURCE, "foo.emb")
+        self.assertFalse(errors)
+        self.assertIsNotNone(debug_info.tokens)
+
+    def test_front_end_debug_flags_with_warm_cache(self):
+        source_directory = tempfile.TemporaryDirectory()
+        self.addCleanup(source_directory.cleanup)
+        input_file = os.path.join(source_directory.name, "foo.emb")
+        with open(input_file, "w") as f:
+            f.write(_SOURCE)
+        command_line = [
+            "emboss_front_end",
+            input_file,
+            "--ir-cache-dir",
+            self._directory.name,
+        ]
+        # Warm the cache.
+        self.assertEqual(
+            0, emboss_front_end.main(emboss_front_end._parse_command_line(command_line))
+        )
+        self.assertTrue(self._entries())
+        glue._cached_modules.clear()
+        output = io.StringIO()
+        with contextlib.redirect_stdout(output):
+            self.assertEqual(
+                0,
+                emboss_front_end.main(
+                    emboss_front_end._parse_command_line(
+                        command_line
+                        + [
+                            "--debug-show-tokenization",
+                            "--debug-show-parse-tree",
+                            "--debug-show-used-productions",
+                            "--debug-show-unused-productions",
+                        ]
+                    )
+                ),
+            )
+        self.assertIn("Tokenization:", output.getvalue())
+        self.assertIn("Unused Productions:", output.getvalue())
+
+    def test_parse_errors_are_not_cached(self):
+        _, _, errors = glue.parse_module_text("struct", "foo.emb", self.cache)
+        self.assertTrue(errors)
+        self.assertEqual([], self._entries())
+
+
+if __name__ == "__main__":
+    unittest.main()
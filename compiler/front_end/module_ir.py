@@ -133,6 +133,11 @@ def build_ir(parse_tree, used_productions=None):
         constraints checked, fields synthesized, etc.; it will only be a
         representation of the syntactic elements of the source.
     """
+    # Anonymous fields are numbered from 1 in each module, so that a module's IR
+    # does not depend on which other modules were parsed first in the same
+    # process.
+    global _anonymous_name_counter
+    _anonymous_name_counter = 0
     handlers = {}
     for production, handler in _handlers.items():
         # An extra layer of indirection is required here so that the resulting
@@ -16,7 +16,7 @@
 
 import collections
 
-from compiler.front_end.generated import cached_parser
+from compiler.front_end import cached_parser
 from compiler.front_end import lr1
 from compiler.front_end import make_parser
 from compiler.front_end import module_ir
@@ -35,16 +35,19 @@ ParserAndIsCached = collections.namedtuple(
 @simple_memoizer.memoize
 def _load_module_parser():
     module_parser = cached_parser.module_parser()
+    # A cached parser from an older cached_parser.bin format is treated as if it
+    # had no productions, so that it is regenerated like any other stale parser.
+    cached_productions = module_parser.productions if module_parser else set()
     module_ir_productions = set(module_ir.PRODUCTIONS) | {
         parser_types.Production(lr1.START_PRIME, (module_ir.START_SYMBOL,))
     }
-    if module_parser.productions == module_ir_productions:
+    if cached_productions == module_ir_productions:
         return ParserAndIsCached(module_parser, (set(), set()))
     return ParserAndIsCached(
         make_parser.build_module_parser(),
         (
-            module_parser.productions - module_ir_productions,
-            module_ir_productions - module_parser.productions,
+            cached_productions - module_ir_productions,
+            module_ir_productions - cached_productions,
         ),
     )
 
@@ -52,10 +55,11 @@ def _load_module_parser():
 @simple_memoizer.memoize
 def _load_expression_parser():
     expression_parser = cached_parser.expression_parser()
+    cached_productions = expression_parser.productions if expression_parser else set()
     module_ir_productions = set(module_ir.PRODUCTIONS) | {
         parser_types.Production(lr1.START_PRIME, (module_ir.EXPRESSION_START_SYMBOL,))
     }
-    if expression_parser.productions == module_ir_productions:
+    if cached_productions == module_ir_productions:
         return ParserAndIsCached(
             expression_parser,
             (set(), set()),
@@ -63,8 +67,8 @@ def _load_expression_parser():
     return ParserAndIsCached(
         make_parser.build_expression_parser(),
         (
-            expression_parser.productions - module_ir_productions,
-            module_ir_productions - expression_parser.productions,
+            cached_productions - module_ir_productions,
+            module_ir_productions - cached_productions,
         ),
     )
 
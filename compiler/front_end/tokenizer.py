@@ -203,6 +203,31 @@ REGEX_TOKEN_PATTERNS = [
 ]
 del _T
 
+# _tokenize_line needs the longest match among all of the token patterns, with
+# ties going to the earliest pattern, but a regex alternation only finds the
+# first alternative that matches.  Instead, _TOKEN_SCANNER wraps each pattern in
+# an optional lookahead group, so that a single match attempt tries every
+# pattern at once, and _tokenize_line picks the longest group.  The literals
+# share a single group, longest first, which finds the longest matching literal.
+_TOKEN_SCANNER = re.compile(
+    "".join(
+        "(?:(?=({})))?".format(pattern)
+        for pattern in [
+            "|".join(
+                re.escape(literal)
+                for literal in sorted(LITERAL_TOKEN_PATTERNS, key=len, reverse=True)
+            )
+        ]
+        + [pattern.regex.pattern for pattern in REGEX_TOKEN_PATTERNS]
+    )
+)
+# The group for literal tokens.  Group n + 2 is REGEX_TOKEN_PATTERNS[n].
+_LITERAL_GROUP = 1
+assert (
+    _TOKEN_SCANNER.groups == len(REGEX_TOKEN_PATTERNS) + 1
+), "REGEX_TOKEN_PATTERNS must not contain capturing groups."
+_GROUP_SYMBOLS = [None, None] + [pattern.symbol for pattern in REGEX_TOKEN_PATTERNS]
+
 
 def _tokenize_line(line, line_number, file_name):
     """Tokenizes a single line of input.
@@ -219,33 +244,22 @@ def _tokenize_line(line, line_number, file_name):
     """
     tokens = []
     offset = 0
+    scan = _TOKEN_SCANNER.match
     while offset < len(line):
-        best_candidate = ""
-        best_candidate_symbol = None
         # Find the longest match.  Ties go to the first match.  This way, keywords
         # ("struct") are matched as themselves, but words that only happen to start
         # with keywords ("structure") are matched as words.
         #
         # There is never a reason to try to match a literal after a regex that
-        # could also match that literal, so check literals first.
-        for literal in LITERAL_TOKEN_PATTERNS:
-            if line[offset:].startswith(literal) and len(literal) > len(best_candidate):
-                best_candidate = literal
-                # For Emboss, the name of a literal token is just the literal in quotes,
-                # so that the grammar can read a little more naturally, e.g.:
-                #
-                #     expression -> expression "+" expression
-                #
-                # instead of
-                #
-                #     expression -> expression Plus expression
-                best_candidate_symbol = '"' + literal + '"'
-        for pattern in REGEX_TOKEN_PATTERNS:
-            match_result = pattern.regex.match(line[offset:])
-            if match_result and len(match_result.group(0)) > len(best_candidate):
-                best_candidate = match_result.group(0)
-                best_candidate_symbol = pattern.symbol
-        if not best_candidate:
+        # could also match that literal, so literals come first.  Groups which did
+        # not match have a span of (-1, -1), so they never win.
+        best_end = offset
+        best_group = None
+        for group, (_, end) in enumerate(scan(line, offset).regs):
+            if end > best_end:
+                best_end = end
+                best_group = group
+        if best_group is None:
             return None, [
                 [
                     error.error(
@@ -257,16 +271,28 @@ def _tokenize_line(line, line_number, file_name):
                     )
                 ]
             ]
-        if best_candidate_symbol:
+        text = line[offset:best_end]
+        if best_group == _LITERAL_GROUP:
+            # For Emboss, the name of a literal token is just the literal in quotes,
+            # so that the grammar can read a little more naturally, e.g.:
+            #
+            #     expression -> expression "+" expression
+            #
+            # instead of
+            #
+            #     expression -> expression Plus expression
+            symbol = '"' + text + '"'
+        else:
+            symbol = _GROUP_SYMBOLS[best_group]
+        if symbol:
             tokens.append(
                 parser_types.Token(
-                    best_candidate_symbol,
-                    best_candidate,
+                    symbol,
+                    text,
                     parser_types.SourceLocation(
-                        (line_number, offset + 1),
-                        (line_number, offset + len(best_candidate) + 1),
+                        (line_number, offset + 1), (line_number, best_end + 1)
                     ),
                 )
             )
-        offset += len(best_candidate)
+        offset = best_end
     return tokens, None
@@ -195,6 +195,9 @@ def _make_short_token_match_tests():
         "structx": ["SnakeWord", eol],
         "bitsx": ["SnakeWord", eol],
         "enumx": ["SnakeWord", eol],
+        "$max_size_in_bitsx": ["BadWord", eol],
+        "<==": ['"<="', '"="', eol],
+        "===": ['"=="', '"="', eol],
         "0b": ["BadNumber", eol],
         "0x": ["BadNumber", eol],
         "0b011101": ["Number", eol],
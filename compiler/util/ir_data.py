@@ -44,6 +44,10 @@ class Message:
     IR_DATACLASS: ClassVar[object] = object()
     field_specs: ClassVar[ir_data_fields.FilteredIrFieldSpecs]
 
+    # Message has no fields of its own; this lets subclasses made with
+    # `ir_data_fields.ir_dataclass` avoid having a per-instance `__dict__`.
+    __slots__ = ()
+
     def __post_init__(self):
         """Called by dataclass subclasses after init.
 
@@ -112,7 +116,7 @@ class Message:
 # From here to the end of the file are actual structure definitions.
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Word(Message):
     """IR for a bare word in the source file.
 
@@ -123,7 +127,7 @@ class Word(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class String(Message):
     """IR for a string in the source file."""
 
@@ -131,13 +135,13 @@ class String(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Documentation(Message):
     text: Optional[str] = None
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class BooleanConstant(Message):
     """IR for a boolean constant."""
 
@@ -145,14 +149,14 @@ class BooleanConstant(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Empty(Message):
     """Placeholder message for automatic element counts for arrays."""
 
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class NumericConstant(Message):
     """IR for any numeric constant."""
 
@@ -203,7 +207,7 @@ class FunctionMapping(int, enum.Enum):
     """`$lower_bound()`"""
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Function(Message):
     """IR for a single function (+, -, *, ==, $max, etc.) in an expression."""
 
@@ -213,7 +217,7 @@ class Function(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class CanonicalName(Message):
     """CanonicalName is the unique, absolute name for some object.
 
@@ -252,7 +256,7 @@ class CanonicalName(Message):
   """
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class NameDefinition(Message):
     """NameDefinition is IR for the name of an object, within the object.
 
@@ -284,7 +288,7 @@ class NameDefinition(Message):
     """The location of this NameDefinition in source code."""
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Reference(Message):
     """A Reference holds the canonical name of something defined elsewhere.
 
@@ -332,7 +336,7 @@ class Reference(Message):
   """
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class FieldReference(Message):
     """IR for a "field" or "field.sub.subsub" reference in an expression.
 
@@ -379,12 +383,12 @@ class FieldReference(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class OpaqueType(Message):
     pass
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class IntegerType(Message):
     """Type of an integer expression."""
 
@@ -441,18 +445,18 @@ class IntegerType(Message):
     maximum_value: Optional[str] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class BooleanType(Message):
     value: Optional[bool] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class EnumType(Message):
     name: Optional[Reference] = None
     value: Optional[str] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class ExpressionType(Message):
     opaque: Optional[OpaqueType] = ir_data_fields.oneof_field("type")
     integer: Optional[IntegerType] = ir_data_fields.oneof_field("type")
@@ -460,7 +464,7 @@ class ExpressionType(Message):
     enumeration: Optional[EnumType] = ir_data_fields.oneof_field("type")
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Expression(Message):
     """IR for an expression.
 
@@ -482,7 +486,7 @@ class Expression(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class ArrayType(Message):
     """IR for an array type ("Int:8[12]" or "Message[2]" or "UInt[3][2]")."""
 
@@ -494,7 +498,7 @@ class ArrayType(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class AtomicType(Message):
     """IR for a non-array type ("UInt" or "Foo(Version.SIX)")."""
 
@@ -503,7 +507,7 @@ class AtomicType(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Type(Message):
     """IR for a type reference ("UInt", "Int:8[12]", etc.)."""
 
@@ -514,7 +518,7 @@ class Type(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class AttributeValue(Message):
     """IR for a attribute value."""
 
@@ -526,7 +530,7 @@ class AttributeValue(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Attribute(Message):
     """IR for a [name = value] attribute."""
 
@@ -537,7 +541,7 @@ class Attribute(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class WriteTransform(Message):
     """IR which defines an expression-based virtual field write scheme.
 
@@ -555,7 +559,7 @@ class WriteTransform(Message):
     destination: Optional[FieldReference] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class WriteMethod(Message):
     """IR which defines the method used for writing to a virtual field."""
 
@@ -582,7 +586,7 @@ class WriteMethod(Message):
   """
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class FieldLocation(Message):
     """IR for a field location."""
 
@@ -591,7 +595,7 @@ class FieldLocation(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Field(Message):  # pylint:disable=too-many-instance-attributes
     """IR for a field in a struct definition.
 
@@ -662,7 +666,7 @@ class Field(Message):  # pylint:disable=too-many-instance-attributes
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Structure(Message):
     """IR for a bits or struct definition."""
 
@@ -706,7 +710,7 @@ class Structure(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class External(Message):
     """IR for an external type declaration."""
 
@@ -716,7 +720,7 @@ class External(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class EnumValue(Message):
     """IR for a single value within an enumerated type."""
 
@@ -732,7 +736,7 @@ class EnumValue(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Enum(Message):
     """IR for an enumerated type definition."""
 
@@ -740,7 +744,7 @@ class Enum(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Import(Message):
     """IR for an import statement in a module."""
 
@@ -751,7 +755,7 @@ class Import(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class RuntimeParameter(Message):
     """IR for a runtime parameter definition."""
 
@@ -795,7 +799,7 @@ class AddressableUnit(int, enum.Enum):
     BYTE = 8
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class TypeDefinition(Message):
     """Container IR for a type definition (struct, union, etc.)"""
 
@@ -825,7 +829,7 @@ class TypeDefinition(Message):
     source_location: Optional[parser_types.SourceLocation] = None
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class Module(Message):
     """The IR for an individual Emboss module (file)."""
 
@@ -845,7 +849,7 @@ class Module(Message):
     """Name of the source file."""
 
 
-@dataclasses.dataclass
+@ir_data_fields.ir_dataclass
 class EmbossIr(Message):
     """The top-level IR for an Emboss module and all of its dependencies."""
 
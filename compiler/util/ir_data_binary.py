@@ -0,0 +1,281 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""A compact binary serialization of IR data classes.
+
+JSON IR is easy to read and to consume from other tools, but for large schemas
+it is tens of megabytes, and converting it to and from IR dataclasses is slow.
+The binary form is meant for passing IR between parts of the Emboss compiler
+itself -- for example, from the front end to a back end -- and is not a stable
+interchange format: it can only be read by a compiler with the same IR
+definitions as the one that wrote it.
+
+Each IR dataclass instance is encoded as a tuple of its field values, in field
+order.  Unset fields and empty lists are `None`, nested dataclasses are nested
+tuples, enums are ints, and `SourceLocation`s are flat tuples of ints and
+bools.  The result is written with `marshal`, after a short header which
+identifies the format and the IR definitions.
+
+The conversion functions for each IR dataclass are generated on first use, so
+that encoding and decoding are straight-line code without any per-field
+reflection.
+"""
+
+import dataclasses
+import gc
+import hashlib
+import marshal
+from typing import Any, Callable, MutableMapping
+
+from compiler.util import ir_data_fields
+from compiler.util import parser_types
+
+# All binary IR starts with MAGIC.
+MAGIC = b"\x00EmbossIR\n"
+
+# Bump this if the encoding changes in a way that is not reflected in the IR
+# definitions themselves.
+_FORMAT_VERSION = 1
+
+_MARSHAL_VERSION = 4
+
+_ENCODERS: MutableMapping[type, Callable[[Any], Any]] = {}
+_DECODERS: MutableMapping[type, Callable[[Any], Any]] = {}
+_FUNCTION_NAMES: MutableMapping[type, str] = {}
+# All of the generated functions live in _GLOBALS, so that they can refer to
+# each other (and to the types they use) by name.
+_GLOBALS: dict[str, Any] = {
+    "_new": object.__new__,
+    "_set": object.__setattr__,
+    "_tuple_new": tuple.__new__,
+    "_SourceLocation": parser_types.SourceLocation,
+    "_SourcePosition": parser_types.SourcePosition,
+    "CopyValuesList": ir_data_fields.CopyValuesList,
+}
+
+
+def _global(prefix: str, value: Any) -> str:
+    """Adds `value` to the generated code's globals, and returns its name."""
+    name = f"{prefix}_{len(_GLOBALS)}"
+    _GLOBALS[name] = value
+    return name
+
+
+def _specs(cls: type):
+    return ir_data_fields.IrDataclassSpecs.get_specs(cls).field_specs
+
+
+def _encode_expression(spec: ir_data_fields.FieldSpec, value: str) -> str:
+    """Returns an expression which encodes a non-None `value` of `spec`."""
+    if spec.is_dataclass:
+        return f"_encode{_FUNCTION_NAMES[spec.data_type]}({value})"
+    if spec.data_type is parser_types.SourceLocation:
+        return f"(*{value}[0], *{value}[1], {value}[2], {value}[3])"
+    if spec.is_enum:
+        return f"int({value})"
+    return value
+
+
+def _decode_expression(spec: ir_data_fields.FieldSpec, value: str) -> str:
+    """Returns an expression which decodes a non-None `value` of `spec`."""
+    if spec.is_dataclass:
+        return f"_decode{_FUNCTION_NAMES[spec.data_type]}({value})"
+    if spec.data_type is parser_types.SourceLocation:
+        # The location was valid when it was encoded, so there is no need to
+        # go through SourceLocation's checks again.
+        return (
+            f"_tuple_new(_SourceLocation, ("
+            f"_tuple_new(_SourcePosition, {value}[0:2]), "
+            f"_tuple_new(_SourcePosition, {value}[2:4]), "
+            f"{value}[4], {value}[5]))"
+        )
+    if spec.is_enum:
+        return f"{_global('_enum', spec.data_type)}({value})"
+    return value
+
+
+def _encoder_source(cls: type) -> str:
+    """Returns the source code of the encoder for `cls`."""
+    items = []
+    for spec in _specs(cls):
+        value = f"ir.{spec.name}"
+        if spec.is_sequence:
+            encoded = _encode_expression(spec, "v")
+            if encoded == "v":
+                items.append(f"list({value}) if {value} else None")
+            else:
+                items.append(f"[{encoded} for v in {value}] if {value} else None")
+        elif _encode_expression(spec, value) == value:
+            items.append(value)
+        else:
+            items.append(
+                f"None if {value} is None else {_encode_expression(spec, value)}"
+            )
+    return "".join(
+        [
+            f"def _encode{_FUNCTION_NAMES[cls]}(ir):\n",
+            "    return (\n",
+            "".join(f"        {item},\n" for item in items),
+            "    )\n",
+        ]
+    )
+
+
+def _decoder_source(cls: type) -> str:
+    """Returns the source code of the decoder for `cls`."""
+    specs = _specs(cls)
+    lines = [
+        f"def _decode{_FUNCTION_NAMES[cls]}(data):",
+        f"    new = _new({_global('_class', cls)})",
+    ]
+    if specs:
+        lines.append("    " + "".join(f"v{i}, " for i in range(len(specs))) + "= data")
+    # A oneof is stored in a pair of proxy attributes (see
+    # `ir_data_fields.OneOfField`), which are always set, even if the oneof is
+    # empty.
+    for oneof in dict.fromkeys(spec.oneof for spec in specs if spec.is_oneof):
+        lines.append(f"    _set(new, '_value_{oneof}', None)")
+        lines.append(f"    _set(new, 'which_{oneof}', None)")
+    class_fields = {field.name: field for field in dataclasses.fields(cls)}
+    for i, spec in enumerate(specs):
+        value = f"v{i}"
+        if spec.is_oneof:
+            lines.append(f"    if {value} is not None:")
+            lines.append(
+                f"        _set(new, '_value_{spec.oneof}', "
+                f"{_decode_expression(spec, value)})"
+            )
+            lines.append(f"        _set(new, 'which_{spec.oneof}', {spec.name!r})")
+        elif spec.is_sequence:
+            data_type = _global("_type", spec.data_type)
+            decoded = _decode_expression(spec, "v")
+            if decoded == "v":
+                items = value
+            else:
+                items = f"[{decoded} for v in {value}] if {value} else None"
+            lines.append(
+                f"    _set(new, {spec.name!r}, CopyValuesList({data_type}, {items}))"
+            )
+        else:
+            # Unset fields get their default value, just as if the instance had
+            # been constructed without them.
+            class_field = class_fields[spec.name]
+            if class_field.default_factory is not dataclasses.MISSING:
+                default = _global("_factory", class_field.default_factory) + "()"
+            else:
+                default = _global("_default", class_field.default)
+            lines.append(
+                f"    _set(new, {spec.name!r}, {default} if {value} is None "
+                f"else {_decode_expression(spec, value)})"
+            )
+    lines.append("    return new")
+    return "\n".join(lines) + "\n"
+
+
+def _generate_functions(cls: type) -> None:
+    """Generates codecs for `cls` and every IR dataclass it contains."""
+    new_classes = []
+    classes_to_check = [cls]
+    while classes_to_check:
+        data_class = classes_to_check.pop()
+        if data_class in _FUNCTION_NAMES:
+            continue
+        _FUNCTION_NAMES[data_class] = f"_{len(_FUNCTION_NAMES)}"
+        new_classes.append(data_class)
+        for spec in _specs(data_class):
+            if spec.is_dataclass:
+                classes_to_check.append(spec.data_type)
+    source = "".join(
+        _encoder_source(data_class) + _decoder_source(data_class)
+        for data_class in new_classes
+    )
+    exec(compile(source, "<ir_data_binary codecs>", "exec"), _GLOBALS)
+    for data_class in new_classes:
+        _ENCODERS[data_class] = _GLOBALS["_encode" + _FUNCTION_NAMES[data_class]]
+        _DECODERS[data_class] = _GLOBALS["_decode" + _FUNCTION_NAMES[data_class]]
+
+
+def _schema_fingerprint(cls: type) -> str:
+    """Returns a hash of the definitions of `cls` and the classes it contains."""
+    fingerprint = hashlib.sha256(str(_FORMAT_VERSION).encode("utf-8"))
+    seen = set()
+    classes_to_check = [cls]
+    while classes_to_check:
+        data_class = classes_to_check.pop()
+        if data_class in seen:
+            continue
+        seen.add(data_class)
+        fingerprint.update(data_class.__qualname__.encode("utf-8"))
+        for spec in _specs(data_class):
+            fingerprint.update(
+                repr(
+                    (
+                        spec.name,
+                        spec.data_type.__qualname__,
+                        spec.container.name,
+                        spec.oneof,
+                    )
+                ).encode("utf-8")
+            )
+            if spec.is_dataclass:
+                classes_to_check.append(spec.data_type)
+    return fingerprint.hexdigest()
+
+
+def is_binary_ir(data: bytes) -> bool:
+    """Returns True if `data` looks like the output of `to_binary`."""
+    return data.startswith(MAGIC)
+
+
+def to_binary(ir: Any) -> bytes:
+    """Serializes the IR dataclass instance `ir` to bytes."""
+    cls = type(ir)
+    if cls not in _ENCODERS:
+        _generate_functions(cls)
+    return MAGIC + marshal.dumps(
+        (_schema_fingerprint(cls), _ENCODERS[cls](ir)), _MARSHAL_VERSION
+    )
+
+
+def from_binary(data_cls: type, data: bytes) -> Any:
+    """Deserializes an instance of `data_cls` from the output of `to_binary`.
+
+    Raises:
+      ValueError: `data` is not binary IR, or was written by a compiler with
+          different IR definitions.
+    """
+    if not is_binary_ir(data):
+        raise ValueError("Data is not binary Emboss IR.")
+    try:
+        fingerprint, encoded = marshal.loads(memoryview(data)[len(MAGIC) :])
+    except (EOFError, TypeError) as e:
+        raise ValueError(f"Corrupt binary Emboss IR: {e}")
+    if fingerprint != _schema_fingerprint(data_cls):
+        raise ValueError(
+            f"Binary Emboss IR does not match this compiler's definition of "
+            f"{data_cls.__name__}; it was probably written by a different "
+            f"version of the compiler."
+        )
+    if data_cls not in _DECODERS:
+        _generate_functions(data_cls)
+    # Decoding allocates a large number of objects, none of which can be part of
+    # a reference cycle until decoding is done, so the cyclic garbage collector
+    # would only waste time scanning them.
+    gc_was_enabled = gc.isenabled()
+    gc.disable()
+    try:
+        return _DECODERS[data_cls](encoded)
+    finally:
+        if gc_was_enabled:
+            gc.enable()
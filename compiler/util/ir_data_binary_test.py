@@ -0,0 +1,96 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Tests for util.ir_data_binary."""
+
+import unittest
+
+from compiler.util import expression_parser
+from compiler.util import ir_data
+from compiler.util import ir_data_binary
+from compiler.util import ir_data_fields
+from compiler.util import ir_data_utils
+from compiler.util import parser_types
+
+
+def _round_trip(ir):
+    return ir_data_binary.from_binary(type(ir), ir_data_binary.to_binary(ir))
+
+
+class IrDataBinaryTest(unittest.TestCase):
+
+    def test_round_trip_expression(self):
+        expression = expression_parser.parse("(a.b + 3) * $max(c, 4) == 10")
+        copy = _round_trip(expression)
+        self.assertEqual(expression, copy)
+        self.assertEqual(
+            ir_data_utils.IrDataSerializer(expression).to_json(),
+            ir_data_utils.IrDataSerializer(copy).to_json(),
+        )
+
+    def test_round_trip_oneof_and_enum(self):
+        function = ir_data.Function(
+            function=ir_data.FunctionMapping.ADDITION,
+            args=[ir_data.Expression(boolean_constant=ir_data.BooleanConstant())],
+        )
+        copy = _round_trip(function)
+        self.assertEqual(function, copy)
+        self.assertIs(ir_data.FunctionMapping.ADDITION, copy.function)
+        self.assertIsNotNone(copy.args[0].boolean_constant)
+        self.assertIsNone(copy.args[0].constant)
+        self.assertEqual("boolean_constant", copy.args[0].which_expression)
+
+    def test_round_trip_source_location(self):
+        location = parser_types.SourceLocation(
+            (1, 2), (3, 4), is_disjoint_from_parent=True, is_synthetic=True
+        )
+        copy = _round_trip(ir_data.Word(text="x", source_location=location))
+        self.assertEqual(location, copy.source_location)
+        self.assertIsInstance(copy.source_location, parser_types.SourceLocation)
+        self.assertIsInstance(copy.source_location.end, parser_types.SourcePosition)
+
+    def test_unset_fields_get_defaults(self):
+        copy = _round_trip(ir_data.CanonicalName())
+        self.assertEqual(ir_data.CanonicalName(), copy)
+        self.assertEqual("", copy.module_file)
+        self.assertIsInstance(copy.object_path, ir_data_fields.CopyValuesList)
+        self.assertIsNone(_round_trip(ir_data.Import()).file_name)
+        copy = _round_trip(ir_data.Module())
+        self.assertIsInstance(copy.type, ir_data_fields.CopyValuesList)
+        self.assertEqual([], copy.type)
+        copy.type.append(ir_data.TypeDefinition())
+        self.assertEqual(1, len(copy.type))
+
+    def test_is_binary_ir(self):
+        self.assertTrue(
+            ir_data_binary.is_binary_ir(ir_data_binary.to_binary(ir_data.Word()))
+        )
+        self.assertFalse(
+            ir_data_binary.is_binary_ir(
+                ir_data_utils.IrDataSerializer(ir_data.Word()).to_json().encode()
+            )
+        )
+
+    def test_bad_data(self):
+        data = ir_data_binary.to_binary(ir_data.Word(text="x"))
+        with self.assertRaisesRegex(ValueError, "not binary"):
+            ir_data_binary.from_binary(ir_data.Word, b"{}")
+        with self.assertRaisesRegex(ValueError, "Corrupt"):
+            ir_data_binary.from_binary(ir_data.Word, data[: len(data) - 3])
+        with self.assertRaisesRegex(ValueError, "different version"):
+            ir_data_binary.from_binary(ir_data.Expression, data)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -30,6 +30,8 @@ Various utilities are provided for working with `dataclasses.Field`s:
     - `copy`, `update`
   - Functions to help defining IR data fields
     - `oneof_field`, `list_field`, `str_field`
+  - A decorator for defining memory-compact IR data classes
+    - `ir_dataclass`
 """
 
 import dataclasses
@@ -78,6 +80,8 @@ def _is_ir_dataclass(obj):
 class CopyValuesList(list[CopyValuesListT]):
     """A list that makes copies of any value that is inserted."""
 
+    __slots__ = ("value_type",)
+
     def __init__(
         self, value_type: CopyValuesListT, iterable: Optional[Iterable[Any]] = None
     ):
@@ -340,6 +344,8 @@ def fields_and_values(
 # 4. `FieldSpec` checks are cached including `is_dataclass` and `is_sequence`.
 # 5. None checks are only done in `copy()`, `_copy_set_fields` only
 #    references `_copy()` to avoid this step.
+# 6. `_copy()` itself uses generated, per-class copy functions; see
+#    `_generate_copiers()`.  `_copy_set_fields` is only used by `update()`.
 def _copy_set_fields(ir: IrDataT):
     """Deep copies fields from IR node `ir`."""
     values: MutableMapping[str, Any] = {}
@@ -364,7 +370,107 @@ def _copy_set_fields(ir: IrDataT):
 
 
 def _copy(ir: IrDataT) -> IrDataT:
-    return type(ir)(**_copy_set_fields(ir))  # type: ignore[misc]
+    copier = _COPIERS.get(type(ir))
+    if copier is None:
+        copier = _generate_copiers(type(ir))
+    return copier(ir)
+
+
+# `_copy` uses a generated function for each IR dataclass, which copies each
+# field with straight-line code and builds the copy without going through
+# `__init__`, `__post_init__`, or the debug-mode `__setattr__` type checks: the
+# values came from an existing, valid instance, so there is nothing to check.
+#
+# `_COPIERS` maps each IR dataclass to its copy function.  All of the generated
+# functions live in `_COPIER_GLOBALS`, so that they can refer to each other (and
+# to the classes they build) by name.
+_COPIERS: MutableMapping[type, Callable[[Any], Any]] = {}
+_COPIER_NAMES: MutableMapping[type, str] = {}
+_COPIER_GLOBALS: dict[str, Any] = {
+    "_new": object.__new__,
+    "_set": object.__setattr__,
+    "CopyValuesList": CopyValuesList,
+}
+
+
+def _copier_global(prefix: str, value: Any) -> str:
+    """Adds `value` to the copier globals, and returns its name."""
+    name = f"{prefix}_{len(_COPIER_GLOBALS)}"
+    _COPIER_GLOBALS[name] = value
+    return name
+
+
+def _copier_source(cls: type) -> str:
+    """Returns the source code of the copy function for `cls`."""
+    lines = [
+        f"def {_COPIER_NAMES[cls]}(ir):",
+        f"    new = _new({_copier_global('_class', cls)})",
+    ]
+    class_fields = {field.name: field for field in dataclasses.fields(cls)}
+    oneofs: MutableMapping[str, list[FieldSpec]] = {}
+    for spec in IrDataclassSpecs.get_specs(cls).field_specs:
+        if spec.is_oneof:
+            assert not spec.is_sequence, "Repeated oneof fields are not supported."
+            oneofs.setdefault(spec.oneof, []).append(spec)
+            continue
+        lines.append(f"    value = ir.{spec.name}")
+        if spec.is_sequence:
+            data_type = _copier_global("_type", spec.data_type)
+            if spec.is_dataclass:
+                copier = _COPIER_NAMES[spec.data_type]
+                value = f"[{copier}(v) for v in value] if value else None"
+            else:
+                value = "value"
+            lines.append(
+                f"    _set(new, {spec.name!r}, CopyValuesList({data_type}, {value}))"
+            )
+            continue
+        # Unset fields get their default value, just as if the copy had been
+        # constructed without them.
+        class_field = class_fields[spec.name]
+        if class_field.default_factory is not dataclasses.MISSING:
+            default = _copier_global("_factory", class_field.default_factory) + "()"
+        else:
+            default = _copier_global("_default", class_field.default)
+        if spec.is_dataclass:
+            value = f"{_COPIER_NAMES[spec.data_type]}(value)"
+        else:
+            value = "value"
+        lines.append(
+            f"    _set(new, {spec.name!r}, {default} if value is None else {value})"
+        )
+    # A oneof is stored in a pair of proxy attributes (see `OneOfField`).
+    for oneof, specs in oneofs.items():
+        lines.append(f"    which = ir.which_{oneof}")
+        lines.append(f"    value = ir._value_{oneof}")
+        for spec in specs:
+            if spec.is_dataclass:
+                lines.append(f"    if which == {spec.name!r}:")
+                lines.append(f"        value = {_COPIER_NAMES[spec.data_type]}(value)")
+        lines.append(f"    _set(new, '_value_{oneof}', value)")
+        lines.append(f"    _set(new, 'which_{oneof}', which)")
+    lines.append("    return new")
+    return "\n".join(lines) + "\n"
+
+
+def _generate_copiers(cls: type) -> Callable[[Any], Any]:
+    """Generates copy functions for `cls` and every IR dataclass it contains."""
+    new_classes = []
+    classes_to_check = [cls]
+    while classes_to_check:
+        data_class = classes_to_check.pop()
+        if data_class in _COPIER_NAMES:
+            continue
+        _COPIER_NAMES[data_class] = _copier_global("_copy", None)
+        new_classes.append(data_class)
+        for spec in IrDataclassSpecs.get_specs(data_class).field_specs:
+            if spec.is_dataclass:
+                classes_to_check.append(spec.data_type)
+    source = "".join(_copier_source(data_class) for data_class in new_classes)
+    exec(compile(source, "<ir_data_fields copiers>", "exec"), _COPIER_GLOBALS)
+    for data_class in new_classes:
+        _COPIERS[data_class] = _COPIER_GLOBALS[_COPIER_NAMES[data_class]]
+    return _COPIERS[cls]
 
 
 def copy(ir: IrDataT) -> Optional[IrDataT]:
@@ -388,7 +494,8 @@ class OneOfField:
     Tracks when the field is set and will unset othe fields in the associated
     oneof group.
 
-    Note: Decorators only work if dataclass slots aren't used.
+    Note: `dataclasses.dataclass(slots=True)` would replace this descriptor with
+    a slot; use `ir_dataclass` to get a slotted class with working oneofs.
     """
 
     def __init__(self, oneof: str) -> None:
@@ -403,9 +510,11 @@ class OneOfField:
         self.name = name
         self.owner_type = owner
         # Add the empty proxy fields to the class.  This may re-initialize
-        # these if another field in this oneof got there first.
-        setattr(owner, self.proxy_name, None)
-        setattr(owner, self.proxy_choice_name, None)
+        # these if another field in this oneof got there first.  Slotted classes
+        # (see `ir_dataclass`) have slots for the proxy fields instead.
+        if self.proxy_name not in owner.__dict__.get("__slots__", ()):
+            setattr(owner, self.proxy_name, None)
+            setattr(owner, self.proxy_choice_name, None)
 
     def __get__(self, obj, objtype=None):
         if getattr(obj, self.proxy_choice_name, None) == self.name:
@@ -420,7 +529,9 @@ class OneOfField:
             value = None
 
         if value is None:
-            if getattr(obj, self.proxy_choice_name) == self.name:
+            # The proxy fields may not be set yet, if this is called from a
+            # slotted class's `__init__`.
+            if getattr(obj, self.proxy_choice_name, None) in (self.name, None):
                 setattr(obj, self.proxy_name, None)
                 setattr(obj, self.proxy_choice_name, None)
         else:
@@ -428,6 +539,42 @@ class OneOfField:
             setattr(obj, self.proxy_choice_name, self.name)
 
 
+def ir_dataclass(cls):
+    """Like `dataclasses.dataclass`, but makes a class that uses `__slots__`.
+
+    Large IRs have millions of nodes, and a `__slots__` class's instances are
+    much smaller than instances with a `__dict__`.  Unlike
+    `dataclasses.dataclass(slots=True)`, this keeps `oneof_field` descriptors
+    working: the oneof's proxy fields get slots, and the descriptors stay on
+    the class.
+
+    All base classes must also use `__slots__` (or have no instance fields),
+    or instances will still get a `__dict__`.
+    """
+    cls = dataclasses.dataclass(cls)
+    class_dict = dict(cls.__dict__)
+    slots = []
+    for class_field in dataclasses.fields(cls):
+        oneof = class_field.metadata.get("oneof")
+        if oneof is None:
+            names = [class_field.name]
+        else:
+            names = [f"_value_{oneof}", f"which_{oneof}"]
+        for name in names:
+            if name not in slots:
+                slots.append(name)
+                # Class attributes with the same names as slots would hide
+                # them.  `__init__` always sets every field, so the defaults
+                # are not needed.
+                class_dict.pop(name, None)
+    class_dict["__slots__"] = tuple(slots)
+    class_dict.pop("__dict__", None)
+    class_dict.pop("__weakref__", None)
+    slotted_cls = type(cls)(cls.__name__, cls.__bases__, class_dict)
+    slotted_cls.__qualname__ = cls.__qualname__
+    return slotted_cls
+
+
 def oneof_field(name: str):
     """Alternative for `datclasses.field` that sets up a oneof variable."""
     return dataclasses.field(  # pylint:disable=invalid-field-call
@@ -86,6 +86,16 @@ class OneofFieldTest(ir_data.Message):
     normal_field: bool = True
 
 
+@ir_data_fields.ir_dataclass
+class SlottedOneofTest(ir_data.Message):
+    """Test class for ir_dataclass."""
+
+    int_field_1: Optional[int] = ir_data_fields.oneof_field("type_1")
+    opaque: Optional[Opaque] = ir_data_fields.oneof_field("type_1")
+    normal_field: bool = True
+    seq_field: list[int] = ir_data_fields.list_field(int)
+
+
 class OneOfTest(unittest.TestCase):
     """Tests for the various oneof field helpers."""
 
@@ -193,6 +203,51 @@ class IrDataFieldsTest(unittest.TestCase):
         empty_copy = ir_data_fields.copy(None)
         self.assertIsNone(empty_copy)
 
+    def test_copy_is_deep(self):
+        """Tests that copies share no mutable state with the original."""
+        original = ir_data.Expression(
+            function=ir_data.Function(
+                function=ir_data.FunctionMapping.ADDITION,
+                args=[
+                    ir_data.Expression(
+                        constant=ir_data.NumericConstant(value="1"),
+                        source_location=parser_types.SourceLocation((1, 2), (1, 3)),
+                    ),
+                ],
+            ),
+        )
+        expression_copy = ir_data_fields.copy(original)
+        self.assertEqual(original, expression_copy)
+        self.assertIsNot(original.function, expression_copy.function)
+        self.assertIsNot(original.function.args, expression_copy.function.args)
+        self.assertIsInstance(
+            expression_copy.function.args, ir_data_fields.CopyValuesList
+        )
+        self.assertIsNone(expression_copy.type)
+        expression_copy.function.args[0].constant.value = "2"
+        expression_copy.function.args.append(ir_data.Expression())
+        self.assertEqual("1", original.function.args[0].constant.value)
+        self.assertLen(original.function.args, 1)
+
+    def test_ir_dataclass(self):
+        """Tests that ir_dataclass makes slotted classes with working oneofs."""
+        slotted = SlottedOneofTest(int_field_1=10)
+        self.assertFalse(hasattr(slotted, "__dict__"))
+        with self.assertRaises(AttributeError):
+            slotted.not_a_field = 1
+        self.assertEqual(10, slotted.int_field_1)
+        self.assertIsNone(slotted.opaque)
+        self.assertTrue(slotted.normal_field)
+        self.assertEqual([], slotted.seq_field)
+        slotted.opaque = Opaque()
+        self.assertIsNone(slotted.int_field_1)
+        self.assertEqual(Opaque(), slotted.opaque)
+        slotted_copy = ir_data_fields.copy(slotted)
+        self.assertEqual(slotted, slotted_copy)
+        self.assertIsNot(slotted.opaque, slotted_copy.opaque)
+        self.assertIsNone(SlottedOneofTest().opaque)
+        self.assertEqual(SlottedOneofTest(), ir_data_fields.copy(SlottedOneofTest()))
+
     def test_copy_values_list(self):
         """Tests that CopyValuesList copies values."""
         data_list = ir_data_fields.CopyValuesList(ListCopyTestClass)
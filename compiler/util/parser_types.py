@@ -43,6 +43,10 @@ class SourcePosition(PositionTuple):
         column: the column within the source line; the first character is 1
     """
 
+    # Large schemas have hundreds of thousands of these, so they should not each
+    # have a __dict__.
+    __slots__ = ()
+
     # This __new__ just adds asserts around PositionTuple.__new__, so it is
     # unnecessary when running under -O.
     if __debug__:
@@ -96,6 +100,8 @@ class SourceLocation(LocationTuple):
     SourceLocation is falsy if the start and end are falsy.
     """
 
+    __slots__ = ()
+
     def __new__(
         cls,
         /,
@@ -187,6 +193,8 @@ class Token(collections.namedtuple("Token", ["symbol", "text", "source_location"
       source_location: Where this token came from in the original source file.
     """
 
+    __slots__ = ()
+
     def __str__(self):
         return "{} {} {}".format(
             self.symbol, repr(self.text), str(self.source_location)
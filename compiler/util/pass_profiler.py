@@ -0,0 +1,240 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Optional timing and memory statistics for compiler passes.
+
+Profiling is off by default.  While it is off, `measure()` does no timing or
+counting, so it is cheap enough to leave in place around every pass:
+
+    with pass_profiler.measure("symbol_resolver.resolve_symbols") as stats:
+        errors = symbol_resolver.resolve_symbols(ir)
+    stats.count_ir_nodes(ir)
+
+Node counts should be recorded after the `with` block, as above, so that the
+cost of counting is not charged to the pass.
+
+A driver turns profiling on with `start()`, and collects the results with
+`stop()`.
+"""
+
+import contextlib
+import json
+import sys
+import time
+import tracemalloc
+
+try:
+    import resource  # pylint:disable=import-error
+except ImportError:  # pragma: no cover -- `resource` is Unix-only.
+    resource = None
+
+
+def count_ir_nodes(ir):
+    """Returns the number of IR dataclass instances reachable from `ir`."""
+    count = 0
+    stack = [ir]
+    while stack:
+        node = stack.pop()
+        count += 1
+        for spec in node.field_specs.field_specs:
+            if not spec.is_dataclass:
+                continue
+            value = getattr(node, spec.name)
+            if value is None:
+                continue
+            if spec.is_sequence:
+                stack.extend(value)
+            else:
+                stack.append(value)
+    return count
+
+
+def _max_rss_bytes():
+    """Returns the peak resident set size of this process, if known."""
+    if resource is None:
+        return None
+    # ru_maxrss is in kilobytes on Linux, but in bytes on macOS.
+    max_rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    return max_rss if sys.platform == "darwin" else max_rss * 1024
+
+
+class PassStats(object):
+    """Statistics for a single run of a single pass."""
+
+    __slots__ = ("name", "seconds", "node_count", "peak_bytes", "max_rss_bytes")
+
+    def __init__(self, name):
+        self.name = name
+        self.seconds = None
+        # The number of tokens, parse tree nodes, or IR nodes produced by the
+        # pass, if the pass reported one.
+        self.node_count = None
+        # The peak Python heap usage during the pass, if memory tracing is on.
+        self.peak_bytes = None
+        # The peak resident set size of the process, as of the end of the pass.
+        self.max_rss_bytes = None
+
+    def count_ir_nodes(self, ir):
+        self.node_count = count_ir_nodes(ir)
+
+    def set_node_count(self, count):
+        self.node_count = count
+
+    def to_dict(self):
+        return {name: getattr(self, name) for name in self.__slots__}
+
+
+class _NullStats(object):
+    """Stand-in for PassStats when profiling is off."""
+
+    __slots__ = ()
+
+    def count_ir_nodes(self, ir):
+        pass
+
+    def set_node_count(self, count):
+        pass
+
+
+_NULL_STATS = _NullStats()
+
+
+class Profiler(object):
+    """Collects PassStats for every measured pass, in the order they ran."""
+
+    def __init__(self, trace_memory=False):
+        self.trace_memory = trace_memory
+        self.stats = []
+
+    @contextlib.contextmanager
+    def measure(self, name):
+        stats = PassStats(name)
+        if self.trace_memory:
+            tracemalloc.reset_peak()
+        start = time.perf_counter()
+        try:
+            yield stats
+        finally:
+            stats.seconds = time.perf_counter() - start
+            if self.trace_memory:
+                stats.peak_bytes = tracemalloc.get_traced_memory()[1]
+            stats.max_rss_bytes = _max_rss_bytes()
+            self.stats.append(stats)
+
+    def total_seconds(self):
+        return sum(stats.seconds for stats in self.stats)
+
+    def format_text(self):
+        """Returns a human-readable table of the collected statistics."""
+        total = self.total_seconds() or 1.0
+        name_width = max([len("pass")] + [len(stats.name) for stats in self.stats])
+        lines = [
+            "{:<{w}}  {:>9}  {:>6}  {:>9}  {:>10}  {:>10}".format(
+                "pass", "seconds", "%", "nodes", "peak MiB", "rss MiB", w=name_width
+            )
+        ]
+        for stats in self.stats:
+            lines.append(
+                "{:<{w}}  {:>9.4f}  {:>6.1%}  {:>9}  {:>10}  {:>10}".format(
+                    stats.name,
+                    stats.seconds,
+                    stats.seconds / total,
+                    "-" if stats.node_count is None else stats.node_count,
+                    _format_mib(stats.peak_bytes),
+                    _format_mib(stats.max_rss_bytes),
+                    w=name_width,
+                )
+            )
+        lines.append(
+            "{:<{w}}  {:>9.4f}".format("total", self.total_seconds(), w=name_width)
+        )
+        return "\n".join(lines)
+
+    def to_json(self):
+        """Returns the collected statistics as a JSON string."""
+        return json.dumps(
+            {
+                "total_seconds": self.total_seconds(),
+                "trace_memory": self.trace_memory,
+                "passes": [stats.to_dict() for stats in self.stats],
+            },
+            indent=2,
+        )
+
+    def report(self, json_file_name=None):
+        """Writes the statistics as JSON to json_file_name, or to stderr as text."""
+        if json_file_name:
+            with open(json_file_name, "w") as f:
+                f.write(self.to_json())
+        else:
+            print(self.format_text(), file=sys.stderr)
+
+
+def _format_mib(num_bytes):
+    if num_bytes is None:
+        return "-"
+    return "{:.1f}".format(num_bytes / (1024 * 1024))
+
+
+_active_profiler = None
+
+
+def start(trace_memory=False):
+    """Turns on profiling, and returns the Profiler that will collect stats.
+
+    Arguments:
+      trace_memory: If true, also record the peak Python heap usage of each pass,
+          using tracemalloc.  Memory tracing slows compilation down
+          considerably, so the reported times will be inflated.
+    """
+    global _active_profiler
+    assert _active_profiler is None, "Profiling is already on."
+    _active_profiler = Profiler()
+    if trace_memory:
+        start_tracing_memory()
+    return _active_profiler
+
+
+def start_tracing_memory():
+    """Turns on memory tracing for passes measured from now on.
+
+    Drivers may use this to avoid tracing expensive setup, such as importing the
+    compiler, which would otherwise take several minutes under tracemalloc.
+    Does nothing if profiling is off.
+    """
+    if _active_profiler is not None and not _active_profiler.trace_memory:
+        _active_profiler.trace_memory = True
+        tracemalloc.start()
+
+
+def stop():
+    """Turns off profiling, and returns the Profiler that collected stats."""
+    global _active_profiler
+    profiler, _active_profiler = _active_profiler, None
+    if profiler is not None and profiler.trace_memory:
+        tracemalloc.stop()
+    return profiler
+
+
+def measure(name):
+    """Returns a context manager which measures the enclosed pass.
+
+    The context manager yields an object with `count_ir_nodes(ir)` and
+    `set_node_count(count)` methods, which record the size of the pass's
+    output.  They may be called after the context manager exits, and do nothing
+    when profiling is off.
+    """
+    if _active_profiler is None:
+        return contextlib.nullcontext(_NULL_STATS)
+    return _active_profiler.measure(name)
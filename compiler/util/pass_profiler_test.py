@@ -0,0 +1,116 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Tests for util.pass_profiler."""
+
+import json
+import unittest
+
+from compiler.util import ir_data
+from compiler.util import pass_profiler
+
+
+def _make_ir():
+    return ir_data.EmbossIr(
+        module=[
+            ir_data.Module(
+                type=[
+                    ir_data.TypeDefinition(name=ir_data.NameDefinition()),
+                    ir_data.TypeDefinition(),
+                ]
+            ),
+            ir_data.Module(),
+        ]
+    )
+
+
+class PassProfilerTest(unittest.TestCase):
+
+    def tearDown(self):
+        pass_profiler.stop()
+
+    def test_count_ir_nodes(self):
+        # EmbossIr, two Modules, two TypeDefinitions, and one NameDefinition.
+        self.assertEqual(6, pass_profiler.count_ir_nodes(_make_ir()))
+        self.assertEqual(1, pass_profiler.count_ir_nodes(ir_data.Module()))
+
+    def test_measure_is_a_no_op_when_off(self):
+        with pass_profiler.measure("pass") as stats:
+            stats.count_ir_nodes(_make_ir())
+            stats.set_node_count(3)
+        self.assertIsNone(pass_profiler.stop())
+
+    def test_measure_records_passes_in_order(self):
+        profiler = pass_profiler.start()
+        with pass_profiler.measure("first") as stats:
+            ir = _make_ir()
+        stats.count_ir_nodes(ir)
+        with pass_profiler.measure("second") as stats:
+            stats.set_node_count(11)
+        with pass_profiler.measure("third"):
+            pass
+        self.assertIs(profiler, pass_profiler.stop())
+        self.assertEqual(
+            ["first", "second", "third"], [stats.name for stats in profiler.stats]
+        )
+        self.assertEqual([6, 11, None], [stats.node_count for stats in profiler.stats])
+        for stats in profiler.stats:
+            self.assertGreaterEqual(stats.seconds, 0)
+            self.assertIsNone(stats.peak_bytes)
+        # Once profiling is off, nothing else is recorded.
+        with pass_profiler.measure("fourth"):
+            pass
+        self.assertEqual(3, len(profiler.stats))
+
+    def test_measure_records_failed_passes(self):
+        profiler = pass_profiler.start()
+        with self.assertRaises(ValueError):
+            with pass_profiler.measure("failing"):
+                raise ValueError()
+        self.assertEqual(["failing"], [stats.name for stats in profiler.stats])
+
+    def test_trace_memory(self):
+        profiler = pass_profiler.start(trace_memory=True)
+        with pass_profiler.measure("allocating"):
+            data = [object() for _ in range(1000)]
+        del data
+        pass_profiler.stop()
+        self.assertGreater(profiler.stats[0].peak_bytes, 0)
+
+    def test_to_json(self):
+        profiler = pass_profiler.start()
+        with pass_profiler.measure("pass") as stats:
+            stats.set_node_count(5)
+        pass_profiler.stop()
+        report = json.loads(profiler.to_json())
+        self.assertEqual(False, report["trace_memory"])
+        self.assertEqual(1, len(report["passes"]))
+        self.assertEqual("pass", report["passes"][0]["name"])
+        self.assertEqual(5, report["passes"][0]["node_count"])
+        self.assertEqual(report["total_seconds"], report["passes"][0]["seconds"])
+
+    def test_format_text(self):
+        profiler = pass_profiler.start()
+        with pass_profiler.measure("some_module.some_pass"):
+            pass
+        pass_profiler.stop()
+        lines = profiler.format_text().splitlines()
+        self.assertEqual(3, len(lines))
+        self.assertTrue(lines[0].startswith("pass "))
+        self.assertTrue(lines[1].startswith("some_module.some_pass "))
+        self.assertTrue(lines[2].startswith("total "))
+
+
+if __name__ == "__main__":
+    unittest.main()
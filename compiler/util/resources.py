@@ -23,3 +23,8 @@ def load(package, file, encoding="utf-8"):
         "r", encoding=encoding
     ) as f:
         return f.read()
+
+
+def load_bytes(package, file):
+    """Returns the contents of binary `file` from the Python package loader."""
+    return importlib.resources.files(package).joinpath(file).read_bytes()
@@ -82,15 +82,19 @@ class _FunctionCaller:
                 args = args[: -len(argspec.defaults)]
             self.required_arg_names.update(args)
 
+        # Keyword argument dicts are usually larger than the function's argument
+        # list, so invoke() picks out arguments by iterating over the latter.
+        self._valid_arg_names = tuple(self.valid_arg_names)
+
     def invoke(self, positional_arg, keyword_args):
         """Invokes the function with the given args."""
         if self.needs_filtering:
             # Trim to just recognized args.
             matched_args = {
-                k: v for k, v in keyword_args.items() if k in self.valid_arg_names
+                k: keyword_args[k] for k in self._valid_arg_names if k in keyword_args
             }
             # Check if any required args are missing.
-            missing_args = self.required_arg_names.difference(matched_args.keys())
+            missing_args = self.required_arg_names.difference(matched_args)
             assert not missing_args, (
                 f"Attempting to call '{self.function.__name__}'; "
                 f"missing {missing_args} (have {set(keyword_args.keys())})"
@@ -115,70 +119,136 @@ def _call_with_optional_args(function, positional_arg, keyword_args):
     return caller.invoke(positional_arg, keyword_args)
 
 
-def _fast_traverse_proto_top_down(
-    proto, incidental_actions, pattern, skip_descendants_of, action, parameters
-):
-    """Traverses an IR, calling `action` on some nodes."""
+class _Traversal:
+    """A traversal of the IR, specialized for one set of traversal arguments.
 
-    # Parameters are scoped to the branch of the tree, so make a copy here, before
-    # any action or incidental_action can update them.
-    parameters = parameters.copy()
+    A _Traversal builds one visitor function for each (node type, pattern
+    position) pair that the traversal actually reaches.  Each visitor knows, ahead
+    of time, which incidental actions to run, whether to run `action`, and which
+    fields might lead to a node matching the rest of the pattern, so visiting a
+    node does no type dispatch or field-table lookups; the IR is walked with
+    plain attribute access.
 
-    # If there is an incidental action for this node type, run it.
-    if type(proto) in incidental_actions:  # pylint: disable=unidiomatic-typecheck
-        for incidental_action in incidental_actions[type(proto)]:
-            parameters.update(
-                _call_with_optional_args(incidental_action, proto, parameters) or {}
-            )
+    Visitors treat `parameters` as immutable: when an action returns new
+    parameters, a new dict is made for that node's descendants, so that
+    parameters stay scoped to the branch of the tree.
+    """
 
-    # If we are at the end of pattern, check to see if we should call action.
-    if len(pattern) == 1:
-        new_pattern = pattern
-        if pattern[0] == type(proto):
-            parameters.update(_call_with_optional_args(action, proto, parameters) or {})
-    else:
-        # Otherwise, if this node's type matches the head of pattern, recurse with
-        # the tail of the pattern.
-        if pattern[0] == type(proto):
-            new_pattern = pattern[1:]
+    def __init__(self, pattern, action, incidental_actions, skip_descendants_of):
+        self._pattern = pattern
+        self._action = _memoized_caller(action).invoke
+        self._incidental_actions = {
+            node_type: tuple(
+                _memoized_caller(function).invoke for function in functions
+            )
+            for node_type, functions in incidental_actions
+        }
+        self._skip_descendants_of = skip_descendants_of
+        self._visitors = {}
+
+    def visitor(self, node_type, pattern_index):
+        """Returns the visitor for node_type at position pattern_index."""
+        key = node_type, pattern_index
+        if key not in self._visitors:
+            self._make_visitor(node_type, pattern_index)
+        return self._visitors[key]
+
+    def _make_visitor(self, node_type, pattern_index):
+        pattern = self._pattern
+        # If we are at the end of pattern, check to see if we should call action.
+        # Otherwise, if this node's type matches the head of pattern, children
+        # should match the tail of the pattern.
+        if pattern_index == len(pattern) - 1:
+            call_action = pattern[pattern_index] == node_type
+            child_pattern_index = pattern_index
         else:
-            new_pattern = pattern
-
-    # If the current node's type is one of the types whose branch should be
-    # skipped, then bail.  This has to happen after `action` is called, because
-    # clients rely on being able to, e.g., get a callback for the "root"
-    # Expression without getting callbacks for every sub-Expression.
-    # pylint: disable=unidiomatic-typecheck
-    if type(proto) in skip_descendants_of:
-        return
-
-    # Otherwise, recurse.  _FIELDS_TO_SCAN_BY_CURRENT_AND_TARGET tells us, given
-    # the current node's type and the current target type, which fields to check.
-    singular_fields, repeated_fields = _FIELDS_TO_SCAN_BY_CURRENT_AND_TARGET[
-        type(proto), new_pattern[0]
-    ]
-    for member_name in singular_fields:
-        if proto.has_field(member_name):
-            _fast_traverse_proto_top_down(
-                getattr(proto, member_name),
-                incidental_actions,
-                new_pattern,
-                skip_descendants_of,
-                action,
-                parameters,
+            call_action = False
+            if pattern[pattern_index] == node_type:
+                child_pattern_index = pattern_index + 1
+            else:
+                child_pattern_index = pattern_index
+        actions = self._incidental_actions.get(node_type, ())
+        if call_action:
+            actions += (self._action,)
+
+        # The IR is recursive, so this visitor must be registered before the
+        # visitors for its children can be made; `children` is filled in below.
+        children = []
+
+        def visit(node, parameters):
+            for action in actions:
+                new_parameters = action(node, parameters)
+                if new_parameters:
+                    parameters = {**parameters, **new_parameters}
+            for member_name, is_repeated, visit_child in children:
+                child = getattr(node, member_name, None)
+                if child is None:
+                    continue
+                if is_repeated:
+                    for element in child:
+                        visit_child(element, parameters)
+                else:
+                    visit_child(child, parameters)
+
+        self._visitors[node_type, pattern_index] = visit
+
+        # If the current node's type is one of the types whose branch should be
+        # skipped, then there are no children to visit.  This has to happen after
+        # `action` is called, because clients rely on being able to, e.g., get a
+        # callback for the "root" Expression without getting callbacks for every
+        # sub-Expression.
+        if node_type in self._skip_descendants_of:
+            return
+
+        # _FIELDS_TO_SCAN_BY_CURRENT_AND_TARGET tells us, given the current node's
+        # type and the current target type, which fields to check.
+        singular_fields, repeated_fields = _FIELDS_TO_SCAN_BY_CURRENT_AND_TARGET[
+            node_type, pattern[child_pattern_index]
+        ]
+        field_specs = ir_data_utils.field_specs(node_type)
+        for member_name in singular_fields:
+            children.append(
+                (
+                    member_name,
+                    False,
+                    self.visitor(
+                        field_specs[member_name].data_type, child_pattern_index
+                    ),
+                )
             )
-    for member_name in repeated_fields:
-        for array_element in getattr(proto, member_name) or []:
-            _fast_traverse_proto_top_down(
-                array_element,
-                incidental_actions,
-                new_pattern,
-                skip_descendants_of,
-                action,
-                parameters,
+        for member_name in repeated_fields:
+            children.append(
+                (
+                    member_name,
+                    True,
+                    self.visitor(
+                        field_specs[member_name].data_type, child_pattern_index
+                    ),
+                )
             )
 
 
+@simple_memoizer.memoize
+def _traversal(pattern, action, incidental_actions, skip_descendants_of):
+    return _Traversal(pattern, action, incidental_actions, skip_descendants_of)
+
+
+def _fast_traverse_proto_top_down(
+    proto, incidental_actions, pattern, skip_descendants_of, action, parameters
+):
+    """Traverses an IR, calling `action` on some nodes."""
+    traversal = _traversal(
+        tuple(pattern),
+        action,
+        tuple(
+            (node_type, tuple(functions))
+            for node_type, functions in incidental_actions.items()
+        ),
+        frozenset(skip_descendants_of),
+    )
+    traversal.visitor(type(proto), 0)(proto, parameters)
+
+
 def _fields_to_scan_by_current_and_target():
     """Generates _FIELDS_TO_SCAN_BY_CURRENT_AND_TARGET."""
     # In order to avoid spending a *lot* of time just walking the IR, this
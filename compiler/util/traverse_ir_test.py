@@ -423,6 +423,41 @@ class TraverseIrTest(unittest.TestCase):
             _count_entries(constants),
         )
 
+    def test_parameters_are_not_modified(self):
+        constants = []
+        parameters = {"constant_list": constants, "location": None}
+
+        def set_location(field):
+            return {"location": field.name.name.text}
+
+        traverse_ir.fast_traverse_ir_top_down(
+            _EXAMPLE_IR,
+            [ir_data.NumericConstant],
+            _record_location_parameter_and_constant,
+            incidental_actions={ir_data.Field: set_location},
+            parameters=parameters,
+        )
+        self.assertIn(("field1", 0), constants)
+        self.assertEqual({"constant_list": constants, "location": None}, parameters)
+
+    def test_same_action_with_different_arguments(self):
+        all_constants = []
+        enum_constants = []
+        traverse_ir.fast_traverse_ir_top_down(
+            _EXAMPLE_IR,
+            [ir_data.NumericConstant],
+            _record_constant,
+            parameters={"constant_list": all_constants},
+        )
+        traverse_ir.fast_traverse_ir_top_down(
+            _EXAMPLE_IR,
+            [ir_data.Enum, ir_data.NumericConstant],
+            _record_constant,
+            parameters={"constant_list": enum_constants},
+        )
+        self.assertLess(len(enum_constants), len(all_constants))
+        self.assertEqual(_count_entries([1, 1, 1]), _count_entries(enum_constants))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -29,15 +29,17 @@ set(EMBOSSC_SOURCES
   "compiler/front_end/__init__.py"
   "compiler/front_end/attribute_checker.py"
   "compiler/front_end/attributes.py"
+  "compiler/front_end/cached_parser.py"
   "compiler/front_end/constraints.py"
   "compiler/front_end/dependency_checker.py"
   "compiler/front_end/emboss_front_end.py"
   "compiler/front_end/error_examples"
   "compiler/front_end/expression_bounds.py"
-  "compiler/front_end/generated/cached_parser.py"
+  "compiler/front_end/generated/cached_parser.bin"
   "compiler/front_end/glue.py"
   "compiler/front_end/lr1.py"
   "compiler/front_end/make_parser.py"
+  "compiler/front_end/module_cache.py"
   "compiler/front_end/module_ir.py"
   "compiler/front_end/parser.py"
   "compiler/front_end/prelude.emb"
@@ -52,12 +54,14 @@ set(EMBOSSC_SOURCES
   "compiler/util/error.py"
   "compiler/util/expression_parser.py"
   "compiler/util/ir_data.py"
+  "compiler/util/ir_data_binary.py"
   "compiler/util/ir_data_fields.py"
   "compiler/util/ir_data_utils.py"
   "compiler/util/ir_util.py"
   "compiler/util/name_conversion.py"
   "compiler/util/parser_types.py"
   "compiler/util/parser_util.py"
+  "compiler/util/pass_profiler.py"
   "compiler/util/resources.py"
   "compiler/util/simple_memoizer.py"
   "compiler/util/traverse_ir.py"
@@ -75,9 +79,13 @@ set(EMBOSS_RUNTIME_CPP_SOURCES
   "runtime/cpp/emboss_cpp_util.h"
   "runtime/cpp/emboss_defines.h"
   "runtime/cpp/emboss_enum_view.h"
+  "runtime/cpp/emboss_field_descriptor.h"
+  "runtime/cpp/emboss_json_util.h"
   "runtime/cpp/emboss_maybe.h"
   "runtime/cpp/emboss_memory_util.h"
+  "runtime/cpp/emboss_parallel_text_util.h"
   "runtime/cpp/emboss_prelude.h"
+  "runtime/cpp/emboss_text_file_util.h"
   "runtime/cpp/emboss_text_util.h"
   "runtime/cpp/emboss_view_parameters.h"
 )
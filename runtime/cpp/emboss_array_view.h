@@ -402,6 +402,27 @@ void WriteShorthandArrayCommentToTextStream(
   WriteShorthandAsciiArrayCommentToTextStream(array, stream, options);
 }
 
+// Returns ::std::true_type for arrays which may be written as a string of hex
+// digits (arrays of UInt:8), and ::std::false_type otherwise.  Only the return
+// type is interesting.
+template <class ElementView, class BufferType, ::std::size_t kElementSize,
+          ::std::size_t kAddressableUnitSize>
+::std::false_type IsByteArray(
+    const GenericArrayView<ElementView, BufferType, kElementSize,
+                           kAddressableUnitSize> *) {
+  return {};
+}
+
+// Overload for arrays of UInt:8.
+template <class BufferType, class BitViewType, ::std::size_t kElementSize,
+          class Parameters,
+          class = typename ::std::enable_if<Parameters::kBits == 8>::type>
+::std::true_type IsByteArray(
+    const GenericArrayView<prelude::UIntView<Parameters, BitViewType>,
+                           BufferType, kElementSize, 8> *) {
+  return {};
+}
+
 }  // namespace support
 }  // namespace emboss
 
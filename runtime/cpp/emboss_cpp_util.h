@@ -24,6 +24,7 @@
 #include "runtime/cpp/emboss_cpp_types.h"
 #include "runtime/cpp/emboss_defines.h"
 #include "runtime/cpp/emboss_enum_view.h"
+#include "runtime/cpp/emboss_field_descriptor.h"
 #include "runtime/cpp/emboss_memory_util.h"
 #include "runtime/cpp/emboss_view_parameters.h"
 
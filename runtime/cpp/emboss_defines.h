@@ -247,6 +247,16 @@
 #define EMBOSS_ALIAS_SAFE_POINTER_CAST(t, x) \
   reinterpret_cast<t __attribute__((__may_alias__)) *>((x))
 #endif  // !defined(EMBOSS_LITTLE_ENDIAN_TO_NATIVE)
+
+// EMBOSS_MAY_ALIAS applies "__may_alias__" to a struct definition, so that the
+// struct may be read and written through a pointer derived from a pointer to
+// bytes.  EMBOSS_HAS_MAY_ALIAS is 1 if EMBOSS_MAY_ALIAS is available.
+#if !defined(EMBOSS_MAY_ALIAS)
+#define EMBOSS_MAY_ALIAS __attribute__((__may_alias__))
+#if !defined(EMBOSS_HAS_MAY_ALIAS)
+#define EMBOSS_HAS_MAY_ALIAS 1
+#endif  // !defined(EMBOSS_HAS_MAY_ALIAS)
+#endif  // !defined(EMBOSS_MAY_ALIAS)
 #endif  // !defined(__INTEL_COMPILER)
 
 // GCC supports __BYTE_ORDER__ of __ORDER_LITTLE_ENDIAN__, __ORDER_BIG_ENDIAN__,
@@ -256,6 +266,14 @@
 //
 // There are no plans to support PDP-endian systems.
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// EMBOSS_SYSTEM_IS_LITTLE_ENDIAN and EMBOSS_SYSTEM_IS_BIG_ENDIAN are 1 when the
+// host byte order is known to be little- or big-endian, respectively, and 0
+// otherwise.  Generated code uses them to decide whether a structure's layout
+// matches the equivalent native C++ struct.
+#if !defined(EMBOSS_SYSTEM_IS_LITTLE_ENDIAN)
+#define EMBOSS_SYSTEM_IS_LITTLE_ENDIAN 1
+#endif  // !defined(EMBOSS_SYSTEM_IS_LITTLE_ENDIAN)
+
 // EMBOSS_LITTLE_ENDIAN_TO_NATIVE and EMBOSS_BIG_ENDIAN_TO_NATIVE can be used to
 // fix up integers after a little- or big-endian value has been memcpy'ed into
 // them.
@@ -278,8 +296,16 @@
 #define EMBOSS_NATIVE_TO_BIG_ENDIAN(x) (::emboss::support::ByteSwap((x)))
 #endif  // !defined(EMBOSS_NATIVE_TO_BIG_ENDIAN)
 
-// TODO(bolms): Find a way to test on a big-endian architecture, and add support
-// for __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+// Big-endian hosts only get EMBOSS_SYSTEM_IS_BIG_ENDIAN, which lets big-endian
+// structures use their native layout.  The byte-order conversion macros above
+// are untested on big-endian hosts, so they are not defined here.
+//
+// TODO(bolms): Find a way to test on a big-endian architecture, and define the
+// conversion macros for __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__.
+#if !defined(EMBOSS_SYSTEM_IS_BIG_ENDIAN)
+#define EMBOSS_SYSTEM_IS_BIG_ENDIAN 1
+#endif  // !defined(EMBOSS_SYSTEM_IS_BIG_ENDIAN)
 #endif  // __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 
 // Prior to version 4.8, __builtin_bswap16 was not available on all platforms.
@@ -311,4 +337,20 @@
 #define EMBOSS_SYSTEM_IS_TWOS_COMPLEMENT 0
 #endif  // !defined(EMBOSS_SYSTEM_IS_TWOS_COMPLEMENT)
 
+#if !defined(EMBOSS_SYSTEM_IS_LITTLE_ENDIAN)
+#define EMBOSS_SYSTEM_IS_LITTLE_ENDIAN 0
+#endif  // !defined(EMBOSS_SYSTEM_IS_LITTLE_ENDIAN)
+
+#if !defined(EMBOSS_SYSTEM_IS_BIG_ENDIAN)
+#define EMBOSS_SYSTEM_IS_BIG_ENDIAN 0
+#endif  // !defined(EMBOSS_SYSTEM_IS_BIG_ENDIAN)
+
+#if !defined(EMBOSS_MAY_ALIAS)
+#define EMBOSS_MAY_ALIAS
+#endif  // !defined(EMBOSS_MAY_ALIAS)
+
+#if !defined(EMBOSS_HAS_MAY_ALIAS)
+#define EMBOSS_HAS_MAY_ALIAS 0
+#endif  // !defined(EMBOSS_HAS_MAY_ALIAS)
+
 #endif  // EMBOSS_RUNTIME_CPP_EMBOSS_DEFINES_H_
@@ -0,0 +1,43 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Static descriptions of the fields of Emboss structures, for use by generic
+// code that walks views with the generated VisitFields() method.
+#ifndef EMBOSS_RUNTIME_CPP_EMBOSS_FIELD_DESCRIPTOR_H_
+#define EMBOSS_RUNTIME_CPP_EMBOSS_FIELD_DESCRIPTOR_H_
+
+namespace emboss {
+namespace support {
+
+// FieldDescriptor describes a single named field of an Emboss structure.  Each
+// generated view provides a constexpr FieldDescriptorAt(i) for i in
+// [0, FieldCount()), in the same order that VisitFields() visits the fields.
+//
+// FieldDescriptor is a literal type, so that descriptors can be inspected in
+// constant expressions (e.g., in a static_assert).
+struct FieldDescriptor {
+  // The name of the field, as written in the .emb; nullptr for an
+  // out-of-range descriptor.
+  const char *name;
+  // True if the field is a virtual field (`let`), false if it occupies space
+  // in the structure.
+  bool is_virtual;
+  // True if the field cannot be written.
+  bool is_read_only;
+};
+
+}  // namespace support
+}  // namespace emboss
+
+#endif  // EMBOSS_RUNTIME_CPP_EMBOSS_FIELD_DESCRIPTOR_H_
@@ -0,0 +1,268 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This header contains functionality for writing Emboss views as JSON.
+//
+// Structures are written as JSON objects, using the generated VisitFields()
+// method, so the set of fields written is the same set that VisitFields()
+// visits.  Arrays are written as JSON arrays, numbers and booleans are written
+// natively, and enums are written as their names (or, optionally, as numbers).
+#ifndef EMBOSS_RUNTIME_CPP_EMBOSS_JSON_UTIL_H_
+#define EMBOSS_RUNTIME_CPP_EMBOSS_JSON_UTIL_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "runtime/cpp/emboss_text_util.h"
+
+namespace emboss {
+
+// JsonByteArrayEncoding selects how arrays of UInt:8 are written.
+enum class JsonByteArrayEncoding {
+  // As a JSON array of numbers: [1,2,255]
+  kArray,
+  // As a string of lowercase hex digits: "0102ff"
+  kHex,
+  // As a string of standard, padded base64: "AQL/"
+  kBase64,
+};
+
+// JsonOutputOptions are used to configure JSON output.  As with
+// TextOutputOptions, the default JsonOutputOptions() is usually sufficient.
+class JsonOutputOptions final {
+ public:
+  JsonOutputOptions() = default;
+
+  JsonOutputOptions WithEnumsAsNumbers(bool new_value) const {
+    JsonOutputOptions result = *this;
+    result.enums_as_numbers_ = new_value;
+    return result;
+  }
+
+  JsonOutputOptions WithByteArrayEncoding(
+      JsonByteArrayEncoding new_value) const {
+    JsonOutputOptions result = *this;
+    result.byte_array_encoding_ = new_value;
+    return result;
+  }
+
+  bool enums_as_numbers() const { return enums_as_numbers_; }
+  JsonByteArrayEncoding byte_array_encoding() const {
+    return byte_array_encoding_;
+  }
+
+ private:
+  bool enums_as_numbers_ = false;
+  JsonByteArrayEncoding byte_array_encoding_ = JsonByteArrayEncoding::kArray;
+};
+
+namespace support {
+
+// JsonPriority<N> is used to rank the WriteJsonValue() overloads: the overload
+// taking the highest priority which is viable is selected.
+template <int N>
+struct JsonPriority : JsonPriority<N - 1> {};
+
+template <>
+struct JsonPriority<0> {};
+
+template <class Stream, class View>
+void WriteJsonValue(const View &view, Stream *stream,
+                    const JsonOutputOptions &options);
+
+// JsonFieldWriter is the visitor passed to VisitFields() when writing a
+// structure.
+template <class Stream>
+class JsonFieldWriter final {
+ public:
+  JsonFieldWriter(Stream *stream, const JsonOutputOptions &options)
+      : stream_(stream), options_(options) {}
+
+  template <class View>
+  void operator()(const char *name, const View &view) {
+    if (wrote_field_) stream_->Write(',');
+    wrote_field_ = true;
+    stream_->Write('"');
+    stream_->Write(name);
+    stream_->Write("\":");
+    WriteJsonValue(view, stream_, options_);
+  }
+
+ private:
+  Stream *stream_;
+  const JsonOutputOptions &options_;
+  bool wrote_field_ = false;
+};
+
+template <class Stream>
+void WriteJsonScalar(bool value, Stream *stream, const JsonOutputOptions &) {
+  stream->Write(value ? "true" : "false");
+}
+
+template <class Stream, class Float>
+typename ::std::enable_if<::std::is_floating_point<Float>::value>::type
+WriteJsonScalar(Float value, Stream *stream, const JsonOutputOptions &) {
+  // JSON has no representation for infinities or NaNs.
+  if (!::std::isfinite(value)) {
+    stream->Write("null");
+    return;
+  }
+  WriteFloatToTextStream(value, stream, TextOutputOptions());
+}
+
+template <class Stream, class Int>
+typename ::std::enable_if<::std::is_integral<Int>::value &&
+                          !::std::is_same<Int, bool>::value>::type
+WriteJsonScalar(Int value, Stream *stream, const JsonOutputOptions &) {
+  WriteIntegerToTextStream(value, stream, 10, false);
+}
+
+template <class Stream, class Enum>
+typename ::std::enable_if<::std::is_enum<Enum>::value>::type WriteJsonScalar(
+    Enum value, Stream *stream, const JsonOutputOptions &options) {
+  if (!options.enums_as_numbers()) {
+    const char *name = TryToGetNameFromEnum(value);
+    if (name != nullptr) {
+      stream->Write('"');
+      stream->Write(name);
+      stream->Write('"');
+      return;
+    }
+  }
+  WriteIntegerToTextStream(
+      static_cast<typename ::std::underlying_type<Enum>::type>(value), stream,
+      10, false);
+}
+
+// Writes the bytes of array as a JSON string, using the given encoding.
+template <class Stream, class Array>
+void WriteJsonByteString(const Array &array, Stream *stream,
+                         JsonByteArrayEncoding encoding) {
+  stream->Write('"');
+  const ::std::size_t size = array.ElementCount();
+  if (encoding == JsonByteArrayEncoding::kHex) {
+    WriteHexBytesToTextStream(&array, 0, size, stream);
+  } else {
+    static constexpr char kBase64Digits[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (::std::size_t i = 0; i < size; i += 3) {
+      const ::std::size_t chunk_size = size - i < 3 ? size - i : 3;
+      ::std::uint32_t chunk = static_cast</**/ ::std::uint32_t>(array[i].Read())
+                              << 16;
+      if (chunk_size > 1) chunk |= array[i + 1].Read() << 8;
+      if (chunk_size > 2) chunk |= array[i + 2].Read();
+      stream->Write(kBase64Digits[(chunk >> 18) & 0x3f]);
+      stream->Write(kBase64Digits[(chunk >> 12) & 0x3f]);
+      stream->Write(chunk_size > 1 ? kBase64Digits[(chunk >> 6) & 0x3f] : '=');
+      stream->Write(chunk_size > 2 ? kBase64Digits[chunk & 0x3f] : '=');
+    }
+  }
+  stream->Write('"');
+}
+
+template <class Stream, class View>
+bool MaybeWriteJsonByteString(const View &, Stream *,
+                              const JsonOutputOptions &, ::std::false_type) {
+  return false;
+}
+
+template <class Stream, class View>
+bool MaybeWriteJsonByteString(const View &view, Stream *stream,
+                              const JsonOutputOptions &options,
+                              ::std::true_type) {
+  if (options.byte_array_encoding() == JsonByteArrayEncoding::kArray ||
+      !view.Ok()) {
+    return false;
+  }
+  WriteJsonByteString(view, stream, options.byte_array_encoding());
+  return true;
+}
+
+// Structures: anything with VisitFields().
+template <class Stream, class View>
+auto WriteJsonValue(const View &view, Stream *stream,
+                    const JsonOutputOptions &options, JsonPriority<2>)
+    -> decltype(view.VisitFields(::std::declval<JsonFieldWriter<Stream> &>())) {
+  stream->Write('{');
+  view.VisitFields(JsonFieldWriter<Stream>(stream, options));
+  stream->Write('}');
+}
+
+// Arrays: anything with ElementCount() and operator[].  Arrays of UInt:8 may
+// be written as strings instead; see JsonByteArrayEncoding.
+template <class Stream, class View>
+auto WriteJsonValue(const View &view, Stream *stream,
+                    const JsonOutputOptions &options, JsonPriority<1>)
+    -> decltype((void)view.ElementCount(), (void)view[0]) {
+  if (MaybeWriteJsonByteString(view, stream, options, IsByteArray(&view))) {
+    return;
+  }
+  stream->Write('[');
+  for (::std::size_t i = 0; i < view.ElementCount(); ++i) {
+    if (i > 0) stream->Write(',');
+    WriteJsonValue(view[i], stream, options);
+  }
+  stream->Write(']');
+}
+
+// Scalars: anything with Read().  Scalars which cannot be read are written as
+// null.
+template <class Stream, class View>
+auto WriteJsonValue(const View &view, Stream *stream,
+                    const JsonOutputOptions &options, JsonPriority<0>)
+    -> decltype((void)view.Read()) {
+  if (!view.Ok()) {
+    stream->Write("null");
+    return;
+  }
+  WriteJsonScalar(view.Read(), stream, options);
+}
+
+template <class Stream, class View>
+void WriteJsonValue(const View &view, Stream *stream,
+                    const JsonOutputOptions &options) {
+  WriteJsonValue(view, stream, options, JsonPriority<2>());
+}
+
+}  // namespace support
+
+// Writes the JSON form of view to stream, which may be any type usable with
+// WriteToTextStream(), such as support::TextOutputStream or
+// support::BufferedTextOutputStream.
+template <typename EmbossViewType, class Stream>
+inline void WriteJsonToStream(const EmbossViewType &view, Stream *stream,
+                              const JsonOutputOptions &options) {
+  support::WriteJsonValue(view, stream, options);
+}
+
+template <typename EmbossViewType>
+inline ::std::string WriteToJson(const EmbossViewType &view,
+                                 const JsonOutputOptions &options) {
+  support::TextOutputStream stream;
+  WriteJsonToStream(view, &stream, options);
+  return ::std::move(stream).Result();
+}
+
+template <typename EmbossViewType>
+inline ::std::string WriteToJson(const EmbossViewType &view) {
+  return WriteToJson(view, JsonOutputOptions());
+}
+
+}  // namespace emboss
+
+#endif  // EMBOSS_RUNTIME_CPP_EMBOSS_JSON_UTIL_H_
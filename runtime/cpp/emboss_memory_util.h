@@ -19,6 +19,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include "runtime/cpp/emboss_bit_util.h"
 #include "runtime/cpp/emboss_cpp_types.h"
@@ -699,6 +702,213 @@ class ContiguousBuffer final {
   ::std::size_t size_ = 0;
 };
 
+// VectorBackedBuffer is a growable backing storage for writable views.  It
+// refers to a region of a std::vector which does not need to exist yet: reads
+// of bytes past the end of the vector return zeroes, and writes to bytes past
+// the end of the vector first grow the vector (zero-filling any gap).
+//
+// A VectorBackedBuffer holds a pointer to the vector and an offset into it,
+// rather than a pointer to the vector's data, so views (and subviews) backed by
+// a VectorBackedBuffer remain valid after the vector reallocates.
+//
+// A VectorBackedBuffer constructed from a vector spans `max_size` bytes, which
+// defaults to effectively unlimited, so that a view of a dynamically-sized
+// structure is always complete, and can be written without computing its size
+// first:
+//
+//     ::std::vector<::std::uint8_t> bytes;
+//     auto writer = GenericMessageView<VectorBackedBuffer<>>(&bytes);
+//     writer.header_length().Write(2);  // bytes.size() is now 1.
+//
+// Growth uses ::std::vector::resize(), so it is amortized constant time per
+// byte.
+template <class Allocator = ::std::allocator</**/ ::std::uint8_t>>
+class VectorBackedBuffer final {
+ public:
+  using VectorType = ::std::vector</**/ ::std::uint8_t, Allocator>;
+
+  // Every subsection of a VectorBackedBuffer is another VectorBackedBuffer.
+  // Since the vector's data may move, alignment cannot be tracked statically,
+  // so the kSubAlignment and kSubOffset parameters are only used for
+  // compatibility with ContiguousBuffer.
+  template </**/ ::std::size_t kSubAlignment, ::std::size_t kSubOffset>
+  using OffsetStorageType = VectorBackedBuffer;
+
+  VectorBackedBuffer() : vector_(nullptr), offset_(0), size_(0) {}
+  explicit VectorBackedBuffer(VectorType *vector,
+                              ::std::size_t max_size =
+                                  ::std::numeric_limits<
+                                      /**/ ::std::size_t>::max())
+      : vector_(vector), offset_(0), size_(vector == nullptr ? 0 : max_size) {}
+  VectorBackedBuffer(const VectorBackedBuffer &other) = default;
+  VectorBackedBuffer &operator=(const VectorBackedBuffer &other) = default;
+
+  bool operator==(const VectorBackedBuffer &other) const {
+    return vector_ == other.vector_ && offset_ == other.offset_ &&
+           size_ == other.size_;
+  }
+  bool operator!=(const VectorBackedBuffer &other) const {
+    return !(*this == other);
+  }
+
+  // GetOffsetStorage returns a VectorBackedBuffer for a subsection of this
+  // one, with the same clamping behavior as ContiguousBuffer::GetOffsetStorage.
+  template </**/ ::std::size_t kSubAlignment, ::std::size_t kSubOffset>
+  OffsetStorageType<kSubAlignment, kSubOffset> GetOffsetStorage(
+      ::std::size_t offset, ::std::size_t size) const {
+    if (kSubAlignment == 0) {
+      EMBOSS_DCHECK_EQ(offset, kSubOffset);
+    } else {
+      EMBOSS_DCHECK_EQ(offset % (kSubAlignment == 0 ? 1 : kSubAlignment),
+                       kSubOffset);
+    }
+    return vector_ == nullptr
+               ? VectorBackedBuffer()
+               : VectorBackedBuffer(
+                     vector_, offset_ + offset,
+                     size_ < offset ? 0 : ::std::min(size, size_ - offset));
+  }
+
+  template </**/ ::std::size_t kBits>
+  typename LeastWidthInteger<kBits>::Unsigned ReadLittleEndianUInt() const {
+    EMBOSS_CHECK(Ok());
+    EMBOSS_CHECK_EQ(SizeInBytes() * 8, kBits);
+    return UncheckedReadLittleEndianUInt<kBits>();
+  }
+  template </**/ ::std::size_t kBits>
+  typename LeastWidthInteger<kBits>::Unsigned UncheckedReadLittleEndianUInt()
+      const {
+    ::std::uint8_t scratch[kBits / 8];
+    return MemoryAccessor<const ::std::uint8_t, 1, 0,
+                          kBits>::ReadLittleEndianUInt(ReadableBytes(scratch));
+  }
+  template </**/ ::std::size_t kBits>
+  typename LeastWidthInteger<kBits>::Unsigned ReadBigEndianUInt() const {
+    EMBOSS_CHECK(Ok());
+    EMBOSS_CHECK_EQ(SizeInBytes() * 8, kBits);
+    return UncheckedReadBigEndianUInt<kBits>();
+  }
+  template </**/ ::std::size_t kBits>
+  typename LeastWidthInteger<kBits>::Unsigned UncheckedReadBigEndianUInt()
+      const {
+    ::std::uint8_t scratch[kBits / 8];
+    return MemoryAccessor<const ::std::uint8_t, 1, 0,
+                          kBits>::ReadBigEndianUInt(ReadableBytes(scratch));
+  }
+
+  template </**/ ::std::size_t kBits>
+  void WriteLittleEndianUInt(
+      typename LeastWidthInteger<kBits>::Unsigned value) const {
+    EMBOSS_CHECK(Ok());
+    EMBOSS_CHECK_EQ(SizeInBytes() * 8, kBits);
+    UncheckedWriteLittleEndianUInt<kBits>(value);
+  }
+  template </**/ ::std::size_t kBits>
+  void UncheckedWriteLittleEndianUInt(
+      typename LeastWidthInteger<kBits>::Unsigned value) const {
+    MemoryAccessor</**/ ::std::uint8_t, 1, 0, kBits>::WriteLittleEndianUInt(
+        WritableBytes(kBits / 8), value);
+  }
+  template </**/ ::std::size_t kBits>
+  void WriteBigEndianUInt(
+      typename LeastWidthInteger<kBits>::Unsigned value) const {
+    EMBOSS_CHECK(Ok());
+    EMBOSS_CHECK_EQ(SizeInBytes() * 8, kBits);
+    UncheckedWriteBigEndianUInt<kBits>(value);
+  }
+  template </**/ ::std::size_t kBits>
+  void UncheckedWriteBigEndianUInt(
+      typename LeastWidthInteger<kBits>::Unsigned value) const {
+    MemoryAccessor</**/ ::std::uint8_t, 1, 0, kBits>::WriteBigEndianUInt(
+        WritableBytes(kBits / 8), value);
+  }
+
+  template <typename OtherByte, ::std::size_t kOtherAlignment,
+            ::std::size_t kOtherOffset>
+  void UncheckedCopyFrom(
+      const ContiguousBuffer<OtherByte, kOtherAlignment, kOtherOffset> &other,
+      ::std::size_t size) const {
+    if (size == 0) return;
+    memmove(WritableBytes(size), other.data(), size);
+  }
+  template <class OtherAllocator>
+  void UncheckedCopyFrom(const VectorBackedBuffer<OtherAllocator> &other,
+                         ::std::size_t size) const {
+    if (size == 0) return;
+    // Grow first: if `other` uses the same vector, growing may move its bytes.
+    ::std::uint8_t *destination = WritableBytes(size);
+    const ::std::size_t available = other.AvailableBytes(size);
+    // If `other` starts past the end of its vector, there are no bytes to copy,
+    // and even forming a pointer to its start would be undefined.
+    if (available > 0) {
+      memmove(destination, other.vector_->data() + other.offset_, available);
+    }
+    memset(destination + available, 0, size - available);
+  }
+  template <class OtherBuffer>
+  void CopyFrom(const OtherBuffer &other, ::std::size_t size) const {
+    EMBOSS_CHECK(Ok());
+    EMBOSS_CHECK(other.Ok());
+    EMBOSS_CHECK_GE(SizeInBytes(), size);
+    EMBOSS_CHECK_GE(other.SizeInBytes(), size);
+    UncheckedCopyFrom(other, size);
+  }
+  template <class OtherBuffer>
+  bool TryToCopyFrom(const OtherBuffer &other, ::std::size_t size) const {
+    if (Ok() && other.Ok() && SizeInBytes() >= size &&
+        other.SizeInBytes() >= size) {
+      UncheckedCopyFrom(other, size);
+      return true;
+    }
+    return false;
+  }
+
+  ::std::size_t SizeInBytes() const { return size_; }
+  bool Ok() const { return vector_ != nullptr; }
+  VectorType *vector() const { return vector_; }
+  ::std::size_t offset() const { return offset_; }
+
+ private:
+  VectorBackedBuffer(VectorType *vector, ::std::size_t offset,
+                     ::std::size_t size)
+      : vector_(vector), offset_(offset), size_(size) {}
+
+  // Returns the number of bytes, up to `size`, at the start of this buffer
+  // which currently exist in the vector.
+  ::std::size_t AvailableBytes(::std::size_t size) const {
+    return vector_->size() <= offset_
+               ? 0
+               : ::std::min(size, vector_->size() - offset_);
+  }
+
+  // Returns a pointer to the first kBytes bytes of this buffer: either
+  // directly into the vector or, if the vector is too short, into `scratch`,
+  // which is filled with the bytes that exist, followed by zeroes.
+  template </**/ ::std::size_t kBytes>
+  const ::std::uint8_t *ReadableBytes(::std::uint8_t (&scratch)[kBytes]) const {
+    const ::std::size_t available = AvailableBytes(kBytes);
+    if (available == kBytes) return vector_->data() + offset_;
+    if (available > 0) memcpy(scratch, vector_->data() + offset_, available);
+    memset(scratch + available, 0, kBytes - available);
+    return scratch;
+  }
+
+  // Grows the vector, if necessary, so that the first `size` bytes of this
+  // buffer exist, and returns a pointer to them.  The pointer is only valid
+  // until the vector is next resized.
+  ::std::uint8_t *WritableBytes(::std::size_t size) const {
+    if (vector_->size() < offset_ + size) vector_->resize(offset_ + size);
+    return vector_->data() + offset_;
+  }
+
+  VectorType *vector_;
+  ::std::size_t offset_;
+  ::std::size_t size_;
+
+  template <class OtherAllocator>
+  friend class VectorBackedBuffer;
+};
+
 // TODO(bolms): Remove these aliases.
 using ReadWriteContiguousBuffer = ContiguousBuffer<unsigned char, 1, 0>;
 using ReadOnlyContiguousBuffer = ContiguousBuffer<const unsigned char, 1, 0>;
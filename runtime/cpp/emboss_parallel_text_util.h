@@ -0,0 +1,118 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This header contains functionality for writing the text format of very
+// large arrays using multiple threads.
+//
+// It is separate from emboss_text_util.h so that generated code does not pull
+// in <thread>.
+#ifndef EMBOSS_RUNTIME_CPP_EMBOSS_PARALLEL_TEXT_UTIL_H_
+#define EMBOSS_RUNTIME_CPP_EMBOSS_PARALLEL_TEXT_UTIL_H_
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "runtime/cpp/emboss_text_util.h"
+
+namespace emboss {
+namespace support {
+
+// Arrays with fewer than kMinElementsPerTextThread elements per thread are
+// written with fewer threads, since starting a thread costs more than
+// formatting a few elements.
+static constexpr ::std::size_t kMinElementsPerTextThread = 1024;
+
+// Writes the text format of array to stream, formatting disjoint ranges of
+// elements on up to thread_count threads.  The text is identical to the text
+// written by WriteArrayToTextStream().  If thread_count is 0, the number of
+// hardware threads is used.
+//
+// Each element is read from its own thread, so the array's backing storage
+// must not be modified until this function returns.
+template <class Array, class Stream>
+void WriteArrayToTextStreamInParallel(const Array *array, Stream *stream,
+                                      const TextOutputOptions &options,
+                                      unsigned thread_count) {
+  if (thread_count == 0) thread_count = ::std::thread::hardware_concurrency();
+  const ::std::size_t element_count = array->ElementCount();
+  ::std::size_t chunk_count = element_count / kMinElementsPerTextThread;
+  if (chunk_count > thread_count) chunk_count = thread_count;
+  if (chunk_count <= 1 || (options.hex_byte_arrays() &&
+                           decltype(IsByteArray(array))::value)) {
+    WriteArrayToTextStream(array, stream, options);
+    return;
+  }
+
+  ::std::vector<TextOutputStream> chunks(chunk_count);
+  ::std::vector< ::std::thread> threads;
+  threads.reserve(chunk_count - 1);
+  auto write_chunk = [array, &chunks, &options, element_count,
+                      chunk_count](::std::size_t chunk) {
+    WriteArrayElementsToTextStream(
+        array, element_count * chunk / chunk_count,
+        element_count * (chunk + 1) / chunk_count, &chunks[chunk], options);
+  };
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+  try {
+#endif
+    for (::std::size_t chunk = 1; chunk < chunk_count; ++chunk) {
+      threads.emplace_back(write_chunk, chunk);
+    }
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+  } catch (const ::std::system_error &) {
+    // The system could not start another thread.  The chunks that did not get
+    // a thread are formatted on this thread instead, and the threads that did
+    // start are joined below as usual.
+  }
+#endif
+  for (::std::size_t chunk = threads.size() + 1; chunk < chunk_count;
+       ++chunk) {
+    write_chunk(chunk);
+  }
+  write_chunk(0);
+  for (auto &thread : threads) thread.join();
+
+  WriteArrayOpeningToTextStream(array, stream, options);
+  for (auto &chunk : chunks) stream->Write(::std::move(chunk).Result());
+  WriteArrayClosingToTextStream(stream, options);
+}
+
+}  // namespace support
+
+// Returns the text format of array, which must be a view of an Emboss array,
+// formatted using up to thread_count threads (or one thread per hardware
+// thread, if thread_count is 0).  The result is identical to
+// WriteToString(array, options).
+template <typename EmbossArrayViewType>
+inline ::std::string WriteToStringInParallel(const EmbossArrayViewType &array,
+                                             TextOutputOptions options,
+                                             unsigned thread_count = 0) {
+  support::TextOutputStream text_stream;
+  support::WriteArrayToTextStreamInParallel(&array, &text_stream, options,
+                                            thread_count);
+  return ::std::move(text_stream).Result();
+}
+
+template <typename EmbossArrayViewType>
+inline ::std::string WriteToStringInParallel(const EmbossArrayViewType &array) {
+  return WriteToStringInParallel(array, TextOutputOptions());
+}
+
+}  // namespace emboss
+
+#endif  // EMBOSS_RUNTIME_CPP_EMBOSS_PARALLEL_TEXT_UTIL_H_
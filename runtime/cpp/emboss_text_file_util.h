@@ -0,0 +1,187 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This header contains functionality for writing Emboss text output directly
+// to files, without first building the whole text in memory.
+//
+// It is separate from emboss_text_util.h so that generated code does not pull
+// in <unistd.h>.
+#ifndef EMBOSS_RUNTIME_CPP_EMBOSS_TEXT_FILE_UTIL_H_
+#define EMBOSS_RUNTIME_CPP_EMBOSS_TEXT_FILE_UTIL_H_
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "runtime/cpp/emboss_defines.h"
+#include "runtime/cpp/emboss_text_util.h"
+
+// EMBOSS_HAS_POSIX_FD is 1 if POSIX write() is available, in which case
+// WriteToFd() is provided.
+#if !defined(EMBOSS_HAS_POSIX_FD)
+#if defined(__unix__) || defined(__APPLE__)
+#define EMBOSS_HAS_POSIX_FD 1
+#else
+#define EMBOSS_HAS_POSIX_FD 0
+#endif
+#endif  // !defined(EMBOSS_HAS_POSIX_FD)
+
+#if EMBOSS_HAS_POSIX_FD
+#include <unistd.h>
+#endif  // EMBOSS_HAS_POSIX_FD
+
+namespace emboss {
+namespace support {
+
+// BufferedTextOutputStream provides the same Write() interface as
+// TextOutputStream, but collects text in a fixed-size buffer and hands it to
+// Sink in large batches, so that arbitrarily large views can be written in
+// constant memory.
+//
+// Sink must provide `bool Write(const char *data, ::std::size_t size)`, which
+// returns false if the data could not be written.  After a Sink failure, the
+// stream discards further output, and Ok() returns false.
+template <class Sink, ::std::size_t kBufferSize = 16384>
+class BufferedTextOutputStream final {
+  static_assert(kBufferSize > 0, "BufferedTextOutputStream needs a buffer.");
+
+ public:
+  explicit BufferedTextOutputStream(Sink sink) : sink_(sink) {}
+  BufferedTextOutputStream(const BufferedTextOutputStream &) = delete;
+  BufferedTextOutputStream &operator=(const BufferedTextOutputStream &) =
+      delete;
+  ~BufferedTextOutputStream() { Flush(); }
+
+  void Write(const ::std::string &text) { Write(text.data(), text.size()); }
+
+  void Write(const char *text) { Write(text, strlen(text)); }
+
+  void Write(const char c) {
+    if (used_ == kBufferSize) Flush();
+    buffer_[used_++] = c;
+  }
+
+  void Write(const char *text, ::std::size_t size) {
+    if (size > kBufferSize - used_) {
+      Flush();
+      // Text that would not fit in the buffer anyway bypasses it.
+      if (size >= kBufferSize) {
+        if (ok_) ok_ = sink_.Write(text, size);
+        return;
+      }
+    }
+    memcpy(&buffer_[used_], text, size);
+    used_ += size;
+  }
+
+  // Passes any buffered text to the sink.  Returns Ok().
+  bool Flush() {
+    if (used_ > 0 && ok_) ok_ = sink_.Write(&buffer_[0], used_);
+    used_ = 0;
+    return ok_;
+  }
+
+  // Returns false if the sink has failed.  Text that is still buffered has not
+  // been checked.
+  bool Ok() const { return ok_; }
+
+ private:
+  Sink sink_;
+  ::std::array<char, kBufferSize> buffer_;
+  ::std::size_t used_ = 0;
+  bool ok_ = true;
+};
+
+// FileTextSink writes to a stdio FILE.
+class FileTextSink final {
+ public:
+  explicit FileTextSink(::std::FILE *file) : file_(file) {}
+
+  bool Write(const char *data, ::std::size_t size) {
+    return ::std::fwrite(data, 1, size, file_) == size;
+  }
+
+ private:
+  ::std::FILE *file_;
+};
+
+#if EMBOSS_HAS_POSIX_FD
+// FdTextSink writes to a POSIX file descriptor, retrying short and interrupted
+// writes.
+class FdTextSink final {
+ public:
+  explicit FdTextSink(int fd) : fd_(fd) {}
+
+  bool Write(const char *data, ::std::size_t size) {
+    while (size > 0) {
+      const ::ssize_t written = ::write(fd_, data, size);
+      if (written < 0) {
+        if (errno == EINTR) continue;
+        return false;
+      }
+      data += written;
+      size -= static_cast</**/ ::std::size_t>(written);
+    }
+    return true;
+  }
+
+ private:
+  int fd_;
+};
+#endif  // EMBOSS_HAS_POSIX_FD
+
+}  // namespace support
+
+// Writes the text format of view to file.  The text is buffered internally and
+// written with large fwrite() calls; file is not flushed.  Returns false if any
+// write fails.
+template <typename EmbossViewType>
+inline bool WriteToFile(const EmbossViewType &view, ::std::FILE *file,
+                        TextOutputOptions options) {
+  support::BufferedTextOutputStream<support::FileTextSink> stream{
+      support::FileTextSink(file)};
+  view.WriteToTextStream(&stream, options);
+  return stream.Flush();
+}
+
+template <typename EmbossViewType>
+inline bool WriteToFile(const EmbossViewType &view, ::std::FILE *file) {
+  return WriteToFile(view, file, TextOutputOptions());
+}
+
+#if EMBOSS_HAS_POSIX_FD
+// Writes the text format of view to the file descriptor fd.  The text is
+// buffered internally and written with large write() calls.  Returns false if
+// any write fails.
+template <typename EmbossViewType>
+inline bool WriteToFd(const EmbossViewType &view, int fd,
+                      TextOutputOptions options) {
+  support::BufferedTextOutputStream<support::FdTextSink> stream{
+      support::FdTextSink(fd)};
+  view.WriteToTextStream(&stream, options);
+  return stream.Flush();
+}
+
+template <typename EmbossViewType>
+inline bool WriteToFd(const EmbossViewType &view, int fd) {
+  return WriteToFd(view, fd, TextOutputOptions());
+}
+#endif  // EMBOSS_HAS_POSIX_FD
+
+}  // namespace emboss
+
+#endif  // EMBOSS_RUNTIME_CPP_EMBOSS_TEXT_FILE_UTIL_H_
@@ -19,16 +19,36 @@
 #include <array>
 #include <climits>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <limits>
-#include <sstream>
+#include <ostream>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
 #include "runtime/cpp/emboss_defines.h"
 
+// EMBOSS_HAS_FLOAT_CHARCONV is 1 if std::to_chars and std::from_chars support
+// floating-point types, in which case they are used for Float text output and
+// input.  It may be predefined to 0 to force the portable fallback.
+#if !defined(EMBOSS_HAS_FLOAT_CHARCONV)
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define EMBOSS_HAS_FLOAT_CHARCONV 1
+#else
+#define EMBOSS_HAS_FLOAT_CHARCONV 0
+#endif
+#endif  // !defined(EMBOSS_HAS_FLOAT_CHARCONV)
+
 namespace emboss {
 
 // TextOutputOptions are used to configure text output.  Typically, one can just
@@ -40,7 +60,7 @@ class TextOutputOptions final {
 
   TextOutputOptions PlusOneIndent() const {
     TextOutputOptions result = *this;
-    result.current_indent_ += indent();
+    ++result.indent_depth_;
     return result;
   }
 
@@ -80,21 +100,63 @@ class TextOutputOptions final {
     return result;
   }
 
-  ::std::string current_indent() const { return current_indent_; }
+  TextOutputOptions WithHexByteArrays(bool new_value) const {
+    TextOutputOptions result = *this;
+    result.hex_byte_arrays_ = new_value;
+    return result;
+  }
+
+  ::std::string current_indent() const {
+    ::std::string result;
+    result.reserve(indent_.size() * indent_depth_);
+    for (int i = 0; i < indent_depth_; ++i) result += indent_;
+    return result;
+  }
+
+  // Writes current_indent() to stream, without building it as a string.
+  // Indents made of spaces (such as MultilineText()'s) are written with a
+  // single Write() from a static buffer.
+  template <class Stream>
+  void WriteCurrentIndent(Stream *stream) const {
+    const ::std::size_t size = indent_.size() * indent_depth_;
+    if (size == 0) return;
+    if (size <= kMaxSpaceRun &&
+        indent_.find_first_not_of(' ') == ::std::string::npos) {
+      stream->Write(Spaces(size));
+      return;
+    }
+    for (int i = 0; i < indent_depth_; ++i) stream->Write(indent_);
+  }
+
   ::std::string indent() const { return indent_; }
+  int indent_depth() const { return indent_depth_; }
   bool multiline() const { return multiline_; }
   bool digit_grouping() const { return digit_grouping_; }
   bool comments() const { return comments_; }
   ::std::uint8_t numeric_base() const { return numeric_base_; }
   bool allow_partial_output() const { return allow_partial_output_; }
+  bool hex_byte_arrays() const { return hex_byte_arrays_; }
 
  private:
+  static constexpr ::std::size_t kMaxSpaceRun = 64;
+
+  // Returns a NUL-terminated run of count spaces, for count <= kMaxSpaceRun.
+  static const char *Spaces(::std::size_t count) {
+    static const char kSpaces[kMaxSpaceRun + 1] =
+        "                                "
+        "                                ";
+    return kSpaces + (kMaxSpaceRun - count);
+  }
+
+  // Indents are short, so copying indent_ (once per nested element) does not
+  // allocate.
   ::std::string indent_;
-  ::std::string current_indent_;
+  int indent_depth_ = 0;
   bool comments_ = false;
   bool multiline_ = false;
   bool digit_grouping_ = false;
   bool allow_partial_output_ = false;
+  bool hex_byte_arrays_ = false;
   ::std::uint8_t numeric_base_ = 10;
 };
 
@@ -102,24 +164,145 @@ namespace support {
 
 // TextOutputStream puts a stream-like interface onto a std::string, for use by
 // DumpToTextStream.  It is used by UpdateFromText().
+//
+// Text is appended directly to the underlying std::string, which grows
+// geometrically; callers that know roughly how much text will be written can
+// pass a size hint to avoid intermediate reallocations.
 class TextOutputStream final {
  public:
   inline explicit TextOutputStream() = default;
+  inline explicit TextOutputStream(::std::size_t size_hint) {
+    text_.reserve(size_hint);
+  }
+
+  inline void Write(const ::std::string &text) { text_.append(text); }
+
+  inline void Write(const char *text) { text_.append(text, strlen(text)); }
+
+  inline void Write(const char *text, ::std::size_t size) {
+    text_.append(text, size);
+  }
+
+  inline void Write(const char c) { text_.push_back(c); }
+
+  inline ::std::size_t Size() const { return text_.size(); }
 
-  inline void Write(const ::std::string &text) {
-    text_.write(text.data(), text.size());
+  inline ::std::string Result() const & { return text_; }
+
+  // Moves the text out of the stream, leaving the stream empty.
+  inline ::std::string Result() && { return ::std::move(text_); }
+
+ private:
+  ::std::string text_;
+};
+
+// TextToken is a single token read from a text stream by ReadToken().  When the
+// stream is a TextStream, the token refers directly to the stream's text, so
+// that reading it does not allocate.  For other streams, the token holds a
+// copy of its text.
+class TextToken final {
+ public:
+  TextToken() = default;
+  TextToken(const TextToken &) = delete;
+  TextToken &operator=(const TextToken &) = delete;
+
+  const char *data() const {
+    return text_ != nullptr ? text_ : storage_.data();
+  }
+  ::std::size_t size() const {
+    return text_ != nullptr ? size_ : storage_.size();
   }
+  bool empty() const { return size() == 0; }
+  char operator[](::std::size_t index) const { return data()[index]; }
 
-  inline void Write(const char *text) { text_.write(text, strlen(text)); }
+  ::std::string ToString() const { return ::std::string(data(), size()); }
 
-  inline void Write(const char c) { text_.put(c); }
+  bool operator==(const char *other) const {
+    return strlen(other) == size() && memcmp(data(), other, size()) == 0;
+  }
+  bool operator!=(const char *other) const { return !(*this == other); }
+
+  // Makes this token refer to the given text, which must outlive the token.
+  void Refer(const char *text, ::std::size_t size) {
+    text_ = text;
+    size_ = size;
+    storage_.clear();
+  }
 
-  inline ::std::string Result() { return text_.str(); }
+  // Makes this token hold a copy of the text passed to Append().
+  void Clear() {
+    text_ = nullptr;
+    size_ = 0;
+    storage_.clear();
+  }
+  void Append(char c) { storage_.push_back(c); }
 
  private:
-  ::std::ostringstream text_;
+  const char *text_ = nullptr;
+  ::std::size_t size_ = 0;
+  ::std::string storage_;
 };
 
+// Returns the value of the hex digit c, or -1 if c is not a hex digit.
+inline int HexDigitValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+#if EMBOSS_SYSTEM_IS_LITTLE_ENDIAN
+// Decodes exactly eight decimal digits at text into *result, eight at a time
+// using SWAR (SIMD-within-a-register) arithmetic.  Returns false if any of the
+// eight characters is not a decimal digit.
+inline bool DecodeEightDecimalDigits(const char *text, ::std::uint32_t *result) {
+  ::std::uint64_t chunk;
+  memcpy(&chunk, text, sizeof chunk);
+  // Each byte must be 0x30-0x39: its high nibble must be 3, and adding 6 must
+  // not carry into the high nibble.
+  if (((chunk & 0xf0f0f0f0f0f0f0f0U) |
+       (((chunk + 0x0606060606060606U) & 0xf0f0f0f0f0f0f0f0U) >> 4)) !=
+      0x3333333333333333U) {
+    return false;
+  }
+  chunk -= 0x3030303030303030U;
+  // Combine adjacent digits into 2-digit values, then 2-digit values into
+  // 4-digit values and 4-digit values into the final 8-digit value.
+  chunk = chunk * 10 + (chunk >> 8);
+  chunk = ((chunk & 0x000000ff000000ffU) * (100 + (1000000ULL << 32)) +
+           ((chunk >> 16) & 0x000000ff000000ffU) * (1 + (10000ULL << 32))) >>
+          32;
+  *result = static_cast</**/ ::std::uint32_t>(chunk);
+  return true;
+}
+#endif  // EMBOSS_SYSTEM_IS_LITTLE_ENDIAN
+
+// Decodes a run of digits in base 2, 10, or 16, without prefix, sign, or digit
+// separators, into *result.  size must be small enough that the result cannot
+// overflow 64 bits: at most 19, 16, or 64 digits, respectively.  Returns false
+// if any character is not a digit in base.
+inline bool DecodePlainDigits(const char *text, ::std::size_t size,
+                              unsigned base, ::std::uint64_t *result) {
+  ::std::uint64_t accumulator = 0;
+  ::std::size_t offset = 0;
+#if EMBOSS_SYSTEM_IS_LITTLE_ENDIAN
+  if (base == 10) {
+    for (; size - offset >= 8; offset += 8) {
+      ::std::uint32_t eight_digits;
+      if (!DecodeEightDecimalDigits(text + offset, &eight_digits)) return false;
+      accumulator = accumulator * 100000000 + eight_digits;
+    }
+  }
+#endif  // EMBOSS_SYSTEM_IS_LITTLE_ENDIAN
+  for (; offset < size; ++offset) {
+    const int digit = HexDigitValue(text[offset]);
+    if (digit < 0 || static_cast<unsigned>(digit) >= base) return false;
+    accumulator = accumulator * base + static_cast<unsigned>(digit);
+  }
+  *result = accumulator;
+  return true;
+}
+
 // DecodeInteger decodes an integer from a string.  This is very similar to the
 // many, many existing integer decode routines in the world, except that a) it
 // accepts integers in any Emboss format, and b) it can run in environments that
@@ -127,17 +310,17 @@ class TextOutputStream final {
 //
 // Ideally, this would be replaced by someone else's code.
 template <class IntType>
-bool DecodeInteger(const ::std::string &text, IntType *result) {
+bool DecodeInteger(const char *text, ::std::size_t size, IntType *result) {
   IntType accumulator = 0;
   IntType base = 10;
   bool negative = false;
-  unsigned offset = 0;
-  if (::std::is_signed<IntType>::value && text.size() >= 1 + offset &&
+  ::std::size_t offset = 0;
+  if (::std::is_signed<IntType>::value && size >= 1 + offset &&
       text[offset] == '-') {
     negative = true;
     offset += 1;
   }
-  if (text.size() >= 2 + offset && text[offset] == '0') {
+  if (size >= 2 + offset && text[offset] == '0') {
     if (text[offset + 1] == 'x' || text[offset + 1] == 'X') {
       base = 16;
       offset += 2;
@@ -147,8 +330,29 @@ bool DecodeInteger(const ::std::string &text, IntType *result) {
     }
   }
   // "", "0x", "0b", "-", "-0x", and "-0b" are not valid numbers.
-  if (offset == text.size()) return false;
-  for (; offset < text.size(); ++offset) {
+  if (offset == size) return false;
+  // Most numbers are short and have no digit separators, so they can be
+  // decoded without checking for overflow on every digit.  Anything else takes
+  // the general path below.
+  const ::std::size_t max_plain_digits = base == 10 ? 19 : base == 16 ? 16 : 64;
+  ::std::uint64_t magnitude;
+  if (size - offset <= max_plain_digits &&
+      DecodePlainDigits(text + offset, size - offset,
+                        static_cast<unsigned>(base), &magnitude)) {
+    using UnsignedType = typename ::std::make_unsigned<IntType>::type;
+    const UnsignedType max_magnitude =
+        static_cast<UnsignedType>(::std::numeric_limits<IntType>::max()) +
+        (negative ? 1 : 0);
+    if (magnitude > max_magnitude) return false;
+    // Negate in the unsigned type, to avoid overflow when the result is
+    // ::std::numeric_limits<IntType>::min().
+    const UnsignedType bits =
+        negative ? static_cast<UnsignedType>(0 - magnitude)
+                 : static_cast<UnsignedType>(magnitude);
+    *result = static_cast<IntType>(bits);
+    return true;
+  }
+  for (; offset < size; ++offset) {
     char c = text[offset];
     IntType digit = 0;
     if (c == '_') {
@@ -186,6 +390,16 @@ bool DecodeInteger(const ::std::string &text, IntType *result) {
   return true;
 }
 
+template <class IntType>
+bool DecodeInteger(const ::std::string &text, IntType *result) {
+  return DecodeInteger(text.data(), text.size(), result);
+}
+
+template <class IntType>
+bool DecodeInteger(const TextToken &text, IntType *result) {
+  return DecodeInteger(text.data(), text.size(), result);
+}
+
 template <class Stream>
 bool DiscardWhitespace(Stream *stream) {
   char c;
@@ -198,39 +412,99 @@ bool DiscardWhitespace(Stream *stream) {
   return stream->Unread(c);
 }
 
+// IsTokenDelimiter returns true if c ends a non-punctuation token.
+inline bool IsTokenDelimiter(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '#' ||
+         strchr(":{}[],", c) != nullptr;
+}
+
 template <class Stream>
-bool ReadToken(Stream *stream, ::std::string *token) {
-  ::std::vector<char> result;
+bool ReadToken(Stream *stream, TextToken *token) {
   char c;
+  token->Clear();
   if (!DiscardWhitespace(stream)) return false;
-  if (!stream->Read(&c)) {
-    *token = "";
+  if (!stream->Read(&c)) return true;
+
+  token->Append(c);
+  if (strchr(":{}[],", c) != nullptr) return true;
+  // TODO(bolms): Only allow alphanumeric characters here?
+  for (;;) {
+    if (!stream->Read(&c)) return true;
+    if (IsTokenDelimiter(c)) return stream->Unread(c);
+    token->Append(c);
+  }
+}
+
+// TextStream puts a stream-like interface onto a std::string, for use by
+// UpdateFromTextStream.  It is used by UpdateFromText().
+class TextStream final {
+ public:
+  // This template handles std::string, std::string_view, and absl::string_view.
+  template <class String>
+  inline explicit TextStream(const String &text)
+      : text_(text.data()), length_(text.size()) {}
+
+  inline explicit TextStream(const char *text)
+      : text_(text), length_(strlen(text)) {}
+
+  inline TextStream(const char *text, ::std::size_t length)
+      : text_(text), length_(length) {}
+
+  inline bool Read(char *result) {
+    if (index_ >= length_) return false;
+    *result = text_[index_];
+    ++index_;
     return true;
   }
 
-  const char *const punctuation = ":{}[],";
-  if (strchr(punctuation, c) != nullptr) {
-    *token = ::std::string(1, c);
+  inline bool Unread(char c) {
+    if (index_ < 1) return false;
+    if (text_[index_ - 1] != c) return false;
+    --index_;
     return true;
-  } else {
-    // TODO(bolms): Only allow alphanumeric characters here?
-    do {
-      result.push_back(c);
-      if (!stream->Read(&c)) {
-        *token = ::std::string(&result[0], result.size());
-        return true;
-      }
-    } while (c != ' ' && c != '\t' && c != '\n' && c != '\r' && c != '#' &&
-             strchr(punctuation, c) == nullptr);
-    if (!stream->Unread(c)) return false;
-    *token = ::std::string(&result[0], result.size());
+  }
+
+ private:
+  friend bool ReadToken(TextStream *stream, TextToken *token);
+
+  // It would be nice to use string_view here, but that's not available until
+  // C++17.
+  const char *text_ = nullptr;
+  ::std::size_t length_ = 0;
+  ::std::size_t index_ = 0;
+};
+
+inline bool ReadToken(TextStream *stream, TextToken *token) {
+  char c;
+  if (!DiscardWhitespace(stream)) return false;
+  const ::std::size_t start = stream->index_;
+  if (!stream->Read(&c)) {
+    token->Refer(stream->text_ + start, 0);
     return true;
   }
+
+  if (strchr(":{}[],", c) == nullptr) {
+    // TODO(bolms): Only allow alphanumeric characters here?
+    while (stream->index_ < stream->length_ &&
+           !IsTokenDelimiter(stream->text_[stream->index_])) {
+      ++stream->index_;
+    }
+  }
+  token->Refer(stream->text_ + start, stream->index_ - start);
+  return true;
+}
+
+template <class Stream>
+bool ReadToken(Stream *stream, ::std::string *token) {
+  TextToken text_token;
+  if (!ReadToken(stream, &text_token)) return false;
+  *token = text_token.ToString();
+  return true;
 }
 
 template <class Stream, class View>
 bool ReadIntegerFromTextStream(View *view, Stream *stream) {
-  ::std::string token;
+  TextToken token;
   if (!::emboss::support::ReadToken(stream, &token)) return false;
   if (token.empty()) return false;
   typename View::ValueType value;
@@ -238,6 +512,124 @@ bool ReadIntegerFromTextStream(View *view, Stream *stream) {
   return view->TryToWrite(value);
 }
 
+// EncodeDigitsBackwards writes the digits of value in base kBase into the
+// bytes immediately before end, and returns a pointer to the first digit.  At
+// least one digit is always written.
+//
+// Bases 2 and 16 use shifts and masks instead of division; base 10 produces
+// two digits per division using a table of digit pairs.
+template <int kBase, typename UnsignedType>
+char *EncodeDigitsBackwards(UnsignedType value, char *end) {
+  static_assert(kBase == 2 || kBase == 10 || kBase == 16,
+                "EncodeDigitsBackwards only supports bases 2, 10, and 16.");
+  static_assert(!::std::numeric_limits<UnsignedType>::is_signed,
+                "EncodeDigitsBackwards only supports unsigned types.");
+  char *next = end;
+  if (kBase == 10) {
+    static constexpr char kDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    while (value >= 100) {
+      const unsigned pair = static_cast<unsigned>(value % 100) * 2;
+      value = static_cast<UnsignedType>(value / 100);
+      *--next = kDigitPairs[pair + 1];
+      *--next = kDigitPairs[pair];
+    }
+    if (value >= 10) {
+      const unsigned pair = static_cast<unsigned>(value) * 2;
+      *--next = kDigitPairs[pair + 1];
+      *--next = kDigitPairs[pair];
+    } else {
+      *--next = static_cast<char>('0' + value);
+    }
+  } else {
+    const int kBitsPerDigit = kBase == 16 ? 4 : 1;
+    do {
+      *--next = "0123456789abcdef"[static_cast<unsigned>(value) & (kBase - 1)];
+      value = static_cast<UnsignedType>(value >> kBitsPerDigit);
+    } while (value != 0);
+  }
+  return next;
+}
+
+// WriteIntegerInBaseToTextStream is WriteIntegerToTextStream (below) with the
+// base fixed at compile time.
+template <int kBase, class Stream, typename IntegralType>
+void WriteIntegerInBaseToTextStream(IntegralType value, Stream *stream,
+                                    bool digit_grouping) {
+  using UnsignedType = typename ::std::make_unsigned<
+      typename ::std::remove_cv<IntegralType>::type>::type;
+  const int kGrouping = kBase == 10 ? 3 : kBase == 16 ? 4 : 8;
+  // Binary has the most digits: one per bit.
+  const int kMaxDigits = (sizeof value) * CHAR_BIT;
+  // The maximum size 32-bit number is -2**31, which is:
+  //
+  // -0b10000000_00000000_00000000_00000000  (38 chars)
+  // -2_147_483_648  (14 chars)
+  // -0x8000_0000  (12 chars)
+  //
+  // Likewise, the maximum size 8-bit number is -128, which is:
+  // -0b10000000  (11 chars)
+  // -128  (4 chars)
+  // -0x80  (5 chars)
+  //
+  // Binary with separators is always the longest value: 9 chars per 8 bits,
+  // minus 1 char for the '_' that does not appear at the front of the number,
+  // plus 2 chars for "0b", plus 1 char for '-', plus 1 extra char for the
+  // trailing '\0', which is (sizeof value) * CHAR_BIT * 9 / 8 - 1 + 2 + 1 + 1.
+  const int kBufferSize = kMaxDigits * 9 / 8 + 3;
+  char digits[kMaxDigits];
+  char buffer[kBufferSize];
+
+  // Negating in the unsigned type handles the minimum two's-complement value,
+  // which has no corresponding positive value in IntegralType.
+  const bool negative = value < 0;
+  UnsignedType magnitude = static_cast<UnsignedType>(value);
+  if (negative) {
+    magnitude = static_cast<UnsignedType>(0U - magnitude);
+  }
+  const char *next_digit =
+      EncodeDigitsBackwards<kBase>(magnitude, digits + kMaxDigits);
+  const int digit_count = static_cast<int>(digits + kMaxDigits - next_digit);
+
+  char *next_char = buffer;
+  if (negative) *next_char++ = '-';
+  if (kBase == 16) {
+    *next_char++ = '0';
+    *next_char++ = 'x';
+  } else if (kBase == 2) {
+    *next_char++ = '0';
+    *next_char++ = 'b';
+  }
+  if (digit_grouping) {
+    // Separators go at fixed positions, counting from the least-significant
+    // digit, so only the leading group may be short.
+    int group_size = (digit_count - 1) % kGrouping + 1;
+    for (int remaining = digit_count; remaining > 0;
+         remaining -= group_size, group_size = kGrouping) {
+      if (remaining != digit_count) *next_char++ = '_';
+      memcpy(next_char, next_digit, group_size);
+      next_char += group_size;
+      next_digit += group_size;
+    }
+  } else {
+    memcpy(next_char, next_digit, digit_count);
+    next_char += digit_count;
+  }
+  EMBOSS_DCHECK_LT(next_char - buffer, kBufferSize);
+  *next_char = '\0';
+
+  stream->Write(buffer);
+}
+
 // WriteIntegerToTextStream encodes the given value in base 2, 10, or 16, with
 // or without digit group separators ('_'), and then calls stream->Write() with
 // a char * argument that is a C-style null-terminated string of the encoded
@@ -259,76 +651,17 @@ void WriteIntegerToTextStream(IntegralType value, Stream *stream,
                       typename ::std::remove_cv<IntegralType>::type>::value,
       "WriteIntegerToTextStream only supports integer types.");
   EMBOSS_CHECK(base == 10 || base == 2 || base == 16);
-  const char *const digits = "0123456789abcdef";
-  const int grouping = base == 10 ? 3 : base == 16 ? 4 : 8;
-  // The maximum size 32-bit number is -2**31, which is:
-  //
-  // -0b10000000_00000000_00000000_00000000  (38 chars)
-  // -2_147_483_648  (14 chars)
-  // -0x8000_0000  (12 chars)
-  //
-  // Likewise, the maximum size 8-bit number is -128, which is:
-  // -0b10000000  (11 chars)
-  // -128  (4 chars)
-  // -0x80  (5 chars)
-  //
-  // Binary with separators is always the longest value: 9 chars per 8 bits,
-  // minus 1 char for the '_' that does not appear at the front of the number,
-  // plus 2 chars for "0b", plus 1 char for '-', plus 1 extra char for the
-  // trailing '\0', which is (sizeof value) * CHAR_BIT * 9 / 8 - 1 + 2 + 1 + 1.
-  const int buffer_size = (sizeof value) * CHAR_BIT * 9 / 8 + 3;
-  char buffer[buffer_size];
-  buffer[buffer_size - 1] = '\0';
-  int next_char = buffer_size - 2;
-  if (value == 0) {
-    EMBOSS_DCHECK_GE(next_char, 0);
-    buffer[next_char] = digits[0];
-    --next_char;
-  }
-  int sign = value < 0 ? -1 : 1;
-  int digit_count = 0;
-  auto buffer_char = [&](char c) {
-    EMBOSS_DCHECK_GE(next_char, 0);
-    buffer[next_char] = c;
-    --next_char;
-  };
-  if (value < 0) {
-    if (value == ::std::numeric_limits<decltype(value)>::lowest()) {
-      // The minimum negative two's-complement value has no corresponding
-      // positive value, so 'value = -value' is not useful in that case.
-      // Instead, we do some trickery to buffer the lowest-order digit here.
-      auto digit = -(value + 1) % base + 1;
-      value = -(value + 1) / base;
-      if (digit == base) {
-        digit = 0;
-        ++value;
-      }
-      buffer_char(digits[digit]);
-      ++digit_count;
-    } else {
-      value = -value;
-    }
-  }
-  while (value > 0) {
-    if (digit_count && digit_count % grouping == 0 && digit_grouping) {
-      buffer_char('_');
-    }
-    buffer_char(digits[value % base]);
-    value /= base;
-    ++digit_count;
+  switch (base) {
+    case 16:
+      WriteIntegerInBaseToTextStream<16>(value, stream, digit_grouping);
+      break;
+    case 2:
+      WriteIntegerInBaseToTextStream<2>(value, stream, digit_grouping);
+      break;
+    default:
+      WriteIntegerInBaseToTextStream<10>(value, stream, digit_grouping);
+      break;
   }
-  if (base == 16) {
-    buffer_char('x');
-    buffer_char('0');
-  } else if (base == 2) {
-    buffer_char('b');
-    buffer_char('0');
-  }
-  if (sign < 0) {
-    buffer_char('-');
-  }
-
-  stream->Write(buffer + 1 + next_char);
 }
 
 // Writes an integer value in the base given in options, plus an optional
@@ -349,7 +682,7 @@ void WriteIntegerViewToTextStream(View *view, Stream *stream,
 
 template <class Stream, class View>
 bool ReadBooleanFromTextStream(View *view, Stream *stream) {
-  ::std::string token;
+  TextToken token;
   if (!::emboss::support::ReadToken(stream, &token)) return false;
   if (token == "true") {
     return view->TryToWrite(true);
@@ -411,7 +744,7 @@ struct FloatConstants<double> {
 
 // Decodes a floating-point number from text.
 template <class Float>
-bool DecodeFloat(const ::std::string &token, Float *result) {
+bool DecodeFloat(const char *token, ::std::size_t size, Float *result) {
   // The state of the world for reading floating-point values is somewhat better
   // than the situation for writing them, but there are still a few bits that
   // are underspecified.  This function is the mirror of WriteFloatToTextStream,
@@ -424,21 +757,20 @@ bool DecodeFloat(const ::std::string &token, Float *result) {
 
   using UInt = typename FloatConstants<Float>::MatchingIntegerType;
 
-  if (token.empty()) return false;
+  if (size == 0) return false;
 
   // First, check for negative.
   bool negative = token[0] == '-';
 
   // Second, check for NaN.
   ::std::size_t i = token[0] == '-' || token[0] == '+' ? 1 : 0;
-  if (token.size() >= i + 3 && (token[i] == 'N' || token[i] == 'n') &&
+  if (size >= i + 3 && (token[i] == 'N' || token[i] == 'n') &&
       (token[i + 1] == 'A' || token[i + 1] == 'a') &&
       (token[i + 2] == 'N' || token[i + 2] == 'n')) {
     UInt nan_payload;
-    if (token.size() >= i + 4) {
-      if (token[i + 3] == '(' && token[token.size() - 1] == ')') {
-        if (!DecodeInteger(token.substr(i + 4, token.size() - i - 5),
-                           &nan_payload)) {
+    if (size >= i + 4) {
+      if (token[i + 3] == '(' && token[size - 1] == ')') {
+        if (!DecodeInteger(token + i + 4, size - i - 5, &nan_payload)) {
           return false;
         }
       } else {
@@ -487,10 +819,10 @@ bool DecodeFloat(const ::std::string &token, Float *result) {
   }
 
   // If the value is not NaN, check for infinity.
-  if (token.size() >= i + 3 && (token[i] == 'I' || token[i] == 'i') &&
+  if (size >= i + 3 && (token[i] == 'I' || token[i] == 'i') &&
       (token[i + 1] == 'N' || token[i + 1] == 'n') &&
       (token[i + 2] == 'F' || token[i + 2] == 'f')) {
-    if (token.size() > i + 3) {
+    if (size > i + 3) {
       // Infinity must be exactly "Inf" or "-Inf" (case insensitive).  There
       // must not be trailing characters.
       return false;
@@ -506,31 +838,157 @@ bool DecodeFloat(const ::std::string &token, Float *result) {
     }
   }
 
+#if EMBOSS_HAS_FLOAT_CHARCONV
+  // std::from_chars does not accept a leading '+' or a "0x" prefix, so those
+  // are stripped here.
+  const char *begin = token + i;
+  const char *const end = token + size;
+  ::std::chars_format format = ::std::chars_format::general;
+  if (end - begin >= 2 && begin[0] == '0' &&
+      (begin[1] == 'x' || begin[1] == 'X')) {
+    begin += 2;
+    format = ::std::chars_format::hex;
+  }
+  if (begin == end || *begin == '-' || *begin == '+') return false;
+  Float magnitude;
+  const auto from_chars_result =
+      ::std::from_chars(begin, end, magnitude, format);
+  if (from_chars_result.ec == ::std::errc()) {
+    if (from_chars_result.ptr != end) return false;
+    *result = negative ? -magnitude : magnitude;
+    return true;
+  }
+  // Values which are too large or too small for Float fall through to scanf,
+  // which rounds them to infinity or zero.
+  if (from_chars_result.ec != ::std::errc::result_out_of_range) return false;
+#endif  // EMBOSS_HAS_FLOAT_CHARCONV
+
   // For non-NaN, non-Inf values, use the C scanf function, mirroring the use of
   // printf for writing the value, below.
+  //
+  // scanf requires a null-terminated string, so short tokens are copied to the
+  // stack.
+  ::std::array<char, 64> short_token;
+  ::std::string long_token;
+  const char *terminated_token;
+  if (size < short_token.size()) {
+    memcpy(&(short_token[0]), token, size);
+    short_token[size] = '\0';
+    terminated_token = &(short_token[0]);
+  } else {
+    long_token.assign(token, size);
+    terminated_token = long_token.c_str();
+  }
   int chars_used = -1;
-  if (::std::sscanf(token.c_str(), FloatConstants<Float>::kScanfFormat(),
+  if (::std::sscanf(terminated_token, FloatConstants<Float>::kScanfFormat(),
                     result, &chars_used) < 1) {
     return false;
   }
   if (chars_used < 0 ||
-      static_cast</**/ ::std::size_t>(chars_used) < token.size()) {
+      static_cast</**/ ::std::size_t>(chars_used) < size) {
     return false;
   }
   return true;
 }
 
+template <class Float>
+bool DecodeFloat(const ::std::string &token, Float *result) {
+  return DecodeFloat(token.data(), token.size(), result);
+}
+
+template <class Float>
+bool DecodeFloat(const TextToken &token, Float *result) {
+  return DecodeFloat(token.data(), token.size(), result);
+}
+
 // Decodes a floating-point number from a text stream and writes it to the
 // specified view.
 template <class Stream, class View>
 bool ReadFloatFromTextStream(View *view, Stream *stream) {
-  ::std::string token;
+  TextToken token;
   if (!ReadToken(stream, &token)) return false;
   typename View::ValueType value;
   if (!DecodeFloat(token, &value)) return false;
   return view->TryToWrite(value);
 }
 
+// ParseScientificDigits reads the significant digits and exponent from text in
+// the form produced by printf("%e") or std::to_chars(..., scientific):
+// "d.ddde+XX" or "de+XX".  Trailing zeros are dropped from the digits.  Returns
+// the number of digits written to digits.
+inline int ParseScientificDigits(const char *text, char *digits,
+                                 int *exponent) {
+  int digit_count = 0;
+  for (; *text != 'e'; ++text) {
+    // Anything other than a digit is a decimal point, which may vary by
+    // locale.
+    if (*text >= '0' && *text <= '9') digits[digit_count++] = *text;
+  }
+  ++text;
+  const bool negative_exponent = *text == '-';
+  ++text;
+  int exponent_value = 0;
+  for (; *text >= '0' && *text <= '9'; ++text) {
+    exponent_value = exponent_value * 10 + (*text - '0');
+  }
+  *exponent = negative_exponent ? -exponent_value : exponent_value;
+  while (digit_count > 1 && digits[digit_count - 1] == '0') --digit_count;
+  return digit_count;
+}
+
+// EncodeShortestFloatDigitsWithPrintf is the portable implementation of
+// EncodeShortestFloatDigits, below.  It formats n with increasing precision
+// until the result reads back as n.  For normal values, the search starts at
+// digits10, because any decimal with that many digits survives a round trip
+// through Float, so rounding n to digits10 digits yields the shortest decimal
+// (plus trailing zeros) if that decimal is no longer.  Subnormal values have
+// less precision, so the search starts at 1.
+template <class Float>
+int EncodeShortestFloatDigitsWithPrintf(Float n, char *digits, int *exponent) {
+  ::std::array<char, 32> buffer;
+  const int initial_precision = n < ::std::numeric_limits<Float>::min()
+                                    ? 1
+                                    : ::std::numeric_limits<Float>::digits10;
+  for (int precision = initial_precision;; ++precision) {
+    // TODO(bolms): Figure out how to get ::std::snprintf to work on
+    // microcontroller builds.
+    ::std::size_t snprintf_result = static_cast</**/ ::std::size_t>(
+        ::snprintf(&(buffer[0]), buffer.size(), "%.*e", precision - 1,
+                   static_cast<double>(n)));
+    (void)snprintf_result;  // Unused if EMBOSS_CHECK_LT is compiled out.
+    EMBOSS_CHECK_LT(snprintf_result, buffer.size());
+    Float round_trip;
+    int chars_used = -1;
+    if (precision >= FloatConstants<Float>::kPrintfPrecision() ||
+        (::std::sscanf(&(buffer[0]), FloatConstants<Float>::kScanfFormat(),
+                       &round_trip, &chars_used) >= 1 &&
+         round_trip == n)) {
+      return ParseScientificDigits(&(buffer[0]), digits, exponent);
+    }
+  }
+}
+
+// EncodeShortestFloatDigits finds the shortest sequence of significant digits
+// d0 d1 ... dk which, written as d0.d1...dk * 10**exponent, reads back as n,
+// which must be finite and positive.  When there are several such sequences,
+// the one closest to n is used.  digits must have room for
+// FloatConstants<Float>::kPrintfPrecision() chars.  Returns the number of
+// digits.
+template <class Float>
+int EncodeShortestFloatDigits(Float n, char *digits, int *exponent) {
+#if EMBOSS_HAS_FLOAT_CHARCONV
+  ::std::array<char, 32> buffer;
+  const auto to_chars_result =
+      ::std::to_chars(&(buffer[0]), &(buffer[0]) + buffer.size() - 1, n,
+                      ::std::chars_format::scientific);
+  EMBOSS_CHECK(to_chars_result.ec == ::std::errc());
+  *to_chars_result.ptr = '\0';
+  return ParseScientificDigits(&(buffer[0]), digits, exponent);
+#else
+  return EncodeShortestFloatDigitsWithPrintf(n, digits, exponent);
+#endif  // EMBOSS_HAS_FLOAT_CHARCONV
+}
+
 template <class Stream, class Float>
 void WriteFloatToTextStream(Float n, Stream *stream,
                             const TextOutputOptions &options) {
@@ -541,11 +999,10 @@ void WriteFloatToTextStream(Float n, Stream *stream,
   // ca. 2018, less than ideal.
   //
   // In C++ land, there is actually no stable facility in the standard library
-  // until to_chars() in C++17 -- which is not actually implemented yet in
-  // libc++.  to_string(), the printf() family, and the iostreams system all
-  // respect the current locale.  In most programs, the locale is permanently
-  // left on "C", but this is not guaranteed.  to_string() also uses a fixed and
-  // rather unfortunate format.
+  // until to_chars() in C++17.  to_string(), the printf() family, and the
+  // iostreams system all respect the current locale.  In most programs, the
+  // locale is permanently left on "C", but this is not guaranteed.
+  // to_string() also uses a fixed and rather unfortunate format.
   //
   // For integers, I (bolms@) chose to just implement custom read and write
   // routines, but those routines are quite small and straightforward compared
@@ -553,13 +1010,12 @@ void WriteFloatToTextStream(Float n, Stream *stream,
   // and writing correct and minimal output is the subject of a number of
   // academic papers.
   //
-  // For the moment, I'm just using snprintf("%.*g", 17, n), which is guaranteed
-  // to be read back as the same number, but can be longer than strictly
-  // necessary.
-  //
-  // TODO(bolms): Import a modified version of the double-to-string conversion
-  // from Swift's standard library, which appears to be best implementation
-  // currently available.
+  // Emboss writes the shortest decimal that reads back as the same number,
+  // using to_chars() where it is available.  Elsewhere, it searches for the
+  // shortest round-tripping printf("%e") precision, which finds the same
+  // digits more slowly.  The digits are then laid out like printf("%.*g"),
+  // with the maximum round-trip precision for Float, so that the choice
+  // between fixed and exponential notation does not depend on the toolchain.
 
   if (::std::isnan(n)) {
     // The printf format for NaN is just "NaN".  In the interests of keeping
@@ -593,24 +1049,82 @@ void WriteFloatToTextStream(Float n, Stream *stream,
     return;
   }
 
+  if (n == 0) {
+    stream->Write(::std::signbit(n) ? "-0" : "0");
+    return;
+  }
+
   // TODO(bolms): Should the current numeric base be honored here?  Should there
   // be a separate Float numeric base?
-  ::std::array<char, 30> buffer;
-  // TODO(bolms): Figure out how to get ::std::snprintf to work on
-  // microcontroller builds.
-  ::std::size_t snprintf_result = static_cast</**/ ::std::size_t>(::snprintf(
-      &(buffer[0]), buffer.size(), "%.*g",
-      FloatConstants<Float>::kPrintfPrecision(), static_cast<double>(n)));
-  (void)snprintf_result;  // Unused if EMBOSS_CHECK_LE is compiled out.
-  EMBOSS_CHECK_LE(snprintf_result, buffer.size());
-  stream->Write(&buffer[0]);
+  const int precision = FloatConstants<Float>::kPrintfPrecision();
+  char digits[precision];
+  int exponent;
+  const int digit_count =
+      EncodeShortestFloatDigits(n < 0 ? -n : n, digits, &exponent);
+
+  // The longest outputs are "-0.000ddddddddddddddddd" and
+  // "-d.dddddddddddddddde-308", plus the trailing '\0'.
+  ::std::array<char, precision + 8> buffer;
+  char *next_char = &(buffer[0]);
+  if (n < 0) *next_char++ = '-';
+  if (exponent < -4 || exponent >= precision) {
+    *next_char++ = digits[0];
+    if (digit_count > 1) {
+      *next_char++ = '.';
+      memcpy(next_char, digits + 1, digit_count - 1);
+      next_char += digit_count - 1;
+    }
+    *next_char++ = 'e';
+    *next_char++ = exponent < 0 ? '-' : '+';
+    const int exponent_magnitude = exponent < 0 ? -exponent : exponent;
+    if (exponent_magnitude >= 100) {
+      *next_char++ = static_cast<char>('0' + exponent_magnitude / 100);
+    }
+    *next_char++ = static_cast<char>('0' + exponent_magnitude / 10 % 10);
+    *next_char++ = static_cast<char>('0' + exponent_magnitude % 10);
+  } else if (exponent < 0) {
+    *next_char++ = '0';
+    *next_char++ = '.';
+    for (int i = -1; i > exponent; --i) *next_char++ = '0';
+    memcpy(next_char, digits, digit_count);
+    next_char += digit_count;
+  } else {
+    for (int i = 0; i <= exponent; ++i) {
+      *next_char++ = i < digit_count ? digits[i] : '0';
+    }
+    if (digit_count > exponent + 1) {
+      *next_char++ = '.';
+      memcpy(next_char, digits + exponent + 1, digit_count - exponent - 1);
+      next_char += digit_count - exponent - 1;
+    }
+  }
+  EMBOSS_DCHECK_LT(next_char - &(buffer[0]),
+                   static_cast</**/ ::std::ptrdiff_t>(buffer.size()));
+  *next_char = '\0';
+  stream->Write(&(buffer[0]));
 
   // TODO(bolms): Support digit grouping.
 }
 
+// TryToGetEnumFromToken looks up an enum value by name.  Emboss-generated
+// enums provide TryToGetEnumFromName(const char *, ::std::size_t, Enum *),
+// which can read the token in place; other enums only need to provide
+// TryToGetEnumFromName(const char *, Enum *), which is passed a
+// null-terminated copy of the token.
+template <class Enum>
+auto TryToGetEnumFromToken(const TextToken &token, Enum *value, int)
+    -> decltype(TryToGetEnumFromName(token.data(), token.size(), value)) {
+  return TryToGetEnumFromName(token.data(), token.size(), value);
+}
+
+template <class Enum>
+bool TryToGetEnumFromToken(const TextToken &token, Enum *value, long) {
+  return TryToGetEnumFromName(token.ToString().c_str(), value);
+}
+
 template <class Stream, class View>
 bool ReadEnumViewFromTextStream(View *view, Stream *stream) {
-  ::std::string token;
+  TextToken token;
   if (!ReadToken(stream, &token)) return false;
   if (token.empty()) return false;
   if (::std::isdigit(token[0])) {
@@ -626,7 +1140,7 @@ bool ReadEnumViewFromTextStream(View *view, Stream *stream) {
     return view->TryToWrite(static_cast<typename View::ValueType>(value));
   } else {
     typename View::ValueType value;
-    if (!TryToGetEnumFromName(token.c_str(), &value)) return false;
+    if (!TryToGetEnumFromToken(token, &value, 0)) return false;
     return view->TryToWrite(value);
   }
 }
@@ -651,6 +1165,112 @@ void WriteEnumViewToTextStream(View *view, Stream *stream,
   }
 }
 
+// Arrays of UInt:8 may also be represented as a single string of hex digits,
+// two per byte, which is much more compact than one element at a time:
+//
+// { hex: 48656c6c6f }
+//
+// The digits may be split into several whitespace-separated runs.  This form
+// is written when TextOutputOptions::hex_byte_arrays() is set, and is always
+// accepted by ReadArrayFromTextStream.
+
+// Writes elements [begin, end) of array, which must be Ok(), as hex digits.
+// The digits are built up in a local, NUL-terminated buffer, so that stream
+// sees one Write(const char *) per 64 bytes instead of one per element.
+template <class Array, class Stream>
+void WriteHexBytesToTextStream(const Array *array, ::std::size_t begin,
+                               ::std::size_t end, Stream *stream) {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  static constexpr ::std::size_t kBytesPerWrite = 64;
+  char buffer[2 * kBytesPerWrite + 1];
+  while (begin < end) {
+    const ::std::size_t count =
+        end - begin < kBytesPerWrite ? end - begin : kBytesPerWrite;
+    for (::std::size_t i = 0; i < count; ++i) {
+      const unsigned byte = (*array)[begin + i].UncheckedRead();
+      buffer[2 * i] = kHexDigits[byte >> 4];
+      buffer[2 * i + 1] = kHexDigits[byte & 0xf];
+    }
+    buffer[2 * count] = '\0';
+    stream->Write(static_cast<const char *>(buffer));
+    begin += count;
+  }
+}
+
+// Reads the hex form of a byte array, starting at the "hex" keyword.
+template <class Array, class Stream>
+bool ReadHexArrayFromTextStream(Array *array, Stream *stream,
+                                ::std::true_type) {
+  TextToken token;
+  if (!ReadToken(stream, &token)) return false;
+  if (token != "hex") return false;
+  if (!ReadToken(stream, &token)) return false;
+  if (token != ":") return false;
+  ::std::size_t index = 0;
+  for (;;) {
+    if (!ReadToken(stream, &token)) return false;
+    if (token.empty()) return false;
+    if (token == "}") return true;
+    if (token.size() % 2 != 0) return false;
+    if (token.size() / 2 > array->ElementCount() - index) return false;
+    for (::std::size_t i = 0; i < token.size(); i += 2) {
+      const int high = HexDigitValue(token[i]);
+      const int low = HexDigitValue(token[i + 1]);
+      if (high < 0 || low < 0) return false;
+      if (!(*array)[index].TryToWrite(high << 4 | low)) return false;
+      ++index;
+    }
+  }
+}
+
+template <class Array, class Stream>
+bool ReadHexArrayFromTextStream(Array *, Stream *, ::std::false_type) {
+  return false;
+}
+
+// Writes the hex form of a byte array.  Returns false, without writing
+// anything, if the array cannot be written that way.
+template <class Array, class Stream>
+bool WriteHexArrayToTextStream(Array *array, Stream *stream,
+                               const TextOutputOptions &options,
+                               ::std::true_type) {
+  if (!array->Ok()) return false;
+  const ::std::size_t count = array->ElementCount();
+  if (options.multiline()) {
+    static constexpr ::std::size_t kBytesPerLine = 32;
+    const TextOutputOptions element_options = options.PlusOneIndent();
+    stream->Write("{");
+    WriteShorthandArrayCommentToTextStream(array, stream, element_options);
+    stream->Write("\n");
+    element_options.WriteCurrentIndent(stream);
+    stream->Write("hex:");
+    for (::std::size_t i = 0; i < count; i += kBytesPerLine) {
+      stream->Write("\n");
+      element_options.WriteCurrentIndent(stream);
+      WriteHexBytesToTextStream(
+          array, i, count - i < kBytesPerLine ? count : i + kBytesPerLine,
+          stream);
+    }
+    stream->Write("\n");
+    options.WriteCurrentIndent(stream);
+    stream->Write("}");
+  } else {
+    stream->Write("{ hex:");
+    if (count > 0) {
+      stream->Write(" ");
+      WriteHexBytesToTextStream(array, 0, count, stream);
+    }
+    stream->Write(" }");
+  }
+  return true;
+}
+
+template <class Array, class Stream>
+bool WriteHexArrayToTextStream(Array *, Stream *, const TextOutputOptions &,
+                               ::std::false_type) {
+  return false;
+}
+
 // Updates an array from a text stream.  For an array of integers, the most
 // basic form of the text format looks like:
 //
@@ -669,6 +1289,8 @@ void WriteEnumViewToTextStream(View *view, Stream *stream,
 // If no index is present for the first element, the index 0 will be used.  If
 // no index is present for any elements after the first, the index one greater
 // than the previous index will be used.
+//
+// Arrays of UInt:8 may instead use the hex form described above.
 template <class Array, class Stream>
 bool ReadArrayFromTextStream(Array *array, Stream *stream) {
   // The text format allows any given index to be set more than once.  In
@@ -677,7 +1299,7 @@ bool ReadArrayFromTextStream(Array *array, Stream *stream) {
   // O(array->ElementCount()) extra space in the worst case.  It does not seem
   // worth it to impose the runtime cost here.
   ::std::size_t index = 0;
-  ::std::string brace;
+  TextToken brace;
   // Read out the opening brace.
   if (!ReadToken(stream, &brace)) return false;
   if (brace != "{") return false;
@@ -688,17 +1310,22 @@ bool ReadArrayFromTextStream(Array *array, Stream *stream) {
     if (!stream->Read(&c)) return false;
     if (c == '}') return true;
 
+    // Check for the hex form, which must be the entire contents of the array.
+    if (c == 'h' && index == 0 &&
+        decltype(IsByteArray(array))::value) {
+      if (!stream->Unread(c)) return false;
+      return ReadHexArrayFromTextStream(array, stream, IsByteArray(array));
+    }
+
     // If the element has an index, read it.
     if (c == '[') {
-      ::std::string index_text;
-      if (!ReadToken(stream, &index_text)) return false;
-      if (!::emboss::support::DecodeInteger(index_text, &index)) return false;
-      ::std::string closing_bracket;
-      if (!ReadToken(stream, &closing_bracket)) return false;
-      if (closing_bracket != "]") return false;
-      ::std::string colon;
-      if (!ReadToken(stream, &colon)) return false;
-      if (colon != ":") return false;
+      TextToken token;
+      if (!ReadToken(stream, &token)) return false;
+      if (!::emboss::support::DecodeInteger(token, &index)) return false;
+      if (!ReadToken(stream, &token)) return false;
+      if (token != "]") return false;
+      if (!ReadToken(stream, &token)) return false;
+      if (token != ":") return false;
     } else {
       if (!stream->Unread(c)) return false;
     }
@@ -729,7 +1356,7 @@ void WriteShorthandAsciiArrayCommentToTextStream(
   static constexpr char kStandInForNonPrintableChar = '.';
   auto start_new_line = [&]() {
     stream->Write("\n");
-    stream->Write(options.current_indent());
+    options.WriteCurrentIndent(stream);
     stream->Write("# ");
   };
   for (int i = 0, n = array->ElementCount(); i < n; ++i) {
@@ -742,28 +1369,30 @@ void WriteShorthandAsciiArrayCommentToTextStream(
   }
 }
 
-// Writes an array to a text stream.  This writes the array in a format
-// compatible with ReadArrayFromTextStream, above.  For multiline output, writes
-// one element per line.
-//
-// TODO(bolms): Make the output for arrays of small elements (like bytes) much
-// more compact.
-//
-// This will require several support functions like `MaxTextLength` on every
-// view type, and will substantially increase the number of tests required for
-// this function, but will make arrays of small elements much more readable.
-template <class Array, class Stream>
-void WriteArrayToTextStream(Array *array, Stream *stream,
+// Returns true if element i of array should be written, rather than skipped
+// (or commented) as unreadable.
+template <class Array>
+bool ArrayElementIsWritable(Array *array, ::std::size_t i,
                             const TextOutputOptions &options) {
+  return !options.allow_partial_output() || (*array)[i].IsAggregate() ||
+         (*array)[i].Ok();
+}
+
+// Writes elements [begin, end) of array to a text stream, exactly as
+// WriteArrayToTextStream would write them as part of the whole array.  The
+// text for each element depends only on the element's index and on whether the
+// element before it was writable, so disjoint ranges may be written separately
+// and concatenated.
+template <class Array, class Stream>
+void WriteArrayElementsToTextStream(Array *array, ::std::size_t begin,
+                                    ::std::size_t end, Stream *stream,
+                                    const TextOutputOptions &options) {
   TextOutputOptions element_options = options.PlusOneIndent();
   if (options.multiline()) {
-    stream->Write("{");
-    WriteShorthandArrayCommentToTextStream(array, stream, element_options);
-    for (::std::size_t i = 0; i < array->ElementCount(); ++i) {
-      if (!options.allow_partial_output() || (*array)[i].IsAggregate() ||
-          (*array)[i].Ok()) {
+    for (::std::size_t i = begin; i < end; ++i) {
+      if (ArrayElementIsWritable(array, i, options)) {
         stream->Write("\n");
-        stream->Write(element_options.current_indent());
+        element_options.WriteCurrentIndent(stream);
         stream->Write("[");
         // TODO(bolms): Put padding in here so that array elements start at the
         // same column.
@@ -777,22 +1406,18 @@ void WriteArrayToTextStream(Array *array, Stream *stream,
         (*array)[i].WriteToTextStream(stream, element_options);
       } else if (element_options.comments()) {
         stream->Write("\n");
-        stream->Write(element_options.current_indent());
+        element_options.WriteCurrentIndent(stream);
         stream->Write("# [");
         WriteIntegerToTextStream(i, stream, options.numeric_base(),
                                  options.digit_grouping());
         stream->Write("]: UNREADABLE");
       }
     }
-    stream->Write("\n");
-    stream->Write(options.current_indent());
-    stream->Write("}");
   } else {
-    stream->Write("{");
-    bool skipped_unreadable = false;
-    for (::std::size_t i = 0; i < array->ElementCount(); ++i) {
-      if (!options.allow_partial_output() || (*array)[i].IsAggregate() ||
-          (*array)[i].Ok()) {
+    bool skipped_unreadable =
+        begin > 0 && !ArrayElementIsWritable(array, begin - 1, options);
+    for (::std::size_t i = begin; i < end; ++i) {
+      if (ArrayElementIsWritable(array, i, options)) {
         stream->Write(" ");
         if (i % 8 == 0 || skipped_unreadable) {
           stream->Write("[");
@@ -819,46 +1444,56 @@ void WriteArrayToTextStream(Array *array, Stream *stream,
         skipped_unreadable = true;
       }
     }
-    stream->Write(" }");
   }
 }
 
-// TextStream puts a stream-like interface onto a std::string, for use by
-// UpdateFromTextStream.  It is used by UpdateFromText().
-class TextStream final {
- public:
-  // This template handles std::string, std::string_view, and absl::string_view.
-  template <class String>
-  inline explicit TextStream(const String &text)
-      : text_(text.data()), length_(text.size()) {}
-
-  inline explicit TextStream(const char *text)
-      : text_(text), length_(strlen(text)) {}
-
-  inline TextStream(const char *text, ::std::size_t length)
-      : text_(text), length_(length) {}
-
-  inline bool Read(char *result) {
-    if (index_ >= length_) return false;
-    *result = text_[index_];
-    ++index_;
-    return true;
+// Writes the text which comes before the elements of array.
+template <class Array, class Stream>
+void WriteArrayOpeningToTextStream(Array *array, Stream *stream,
+                                   const TextOutputOptions &options) {
+  stream->Write("{");
+  if (options.multiline()) {
+    WriteShorthandArrayCommentToTextStream(array, stream,
+                                           options.PlusOneIndent());
   }
+}
 
-  inline bool Unread(char c) {
-    if (index_ < 1) return false;
-    if (text_[index_ - 1] != c) return false;
-    --index_;
-    return true;
+// Writes the text which comes after the elements of an array.
+template <class Stream>
+void WriteArrayClosingToTextStream(Stream *stream,
+                                   const TextOutputOptions &options) {
+  if (options.multiline()) {
+    stream->Write("\n");
+    options.WriteCurrentIndent(stream);
+    stream->Write("}");
+  } else {
+    stream->Write(" }");
   }
+}
 
- private:
-  // It would be nice to use string_view here, but that's not available until
-  // C++17.
-  const char *text_ = nullptr;
-  ::std::size_t length_ = 0;
-  ::std::size_t index_ = 0;
-};
+// Writes an array to a text stream.  This writes the array in a format
+// compatible with ReadArrayFromTextStream, above.  For multiline output, writes
+// one element per line.  If options.hex_byte_arrays() is set, arrays of UInt:8
+// are written in hex form instead.
+//
+// TODO(bolms): Make the output for arrays of small elements (like bytes) much
+// more compact.
+//
+// This will require several support functions like `MaxTextLength` on every
+// view type, and will substantially increase the number of tests required for
+// this function, but will make arrays of small elements much more readable.
+template <class Array, class Stream>
+void WriteArrayToTextStream(Array *array, Stream *stream,
+                            const TextOutputOptions &options) {
+  if (options.hex_byte_arrays() &&
+      WriteHexArrayToTextStream(array, stream, options, IsByteArray(array))) {
+    return;
+  }
+  WriteArrayOpeningToTextStream(array, stream, options);
+  WriteArrayElementsToTextStream(array, 0, array->ElementCount(), stream,
+                                 options);
+  WriteArrayClosingToTextStream(stream, options);
+}
 
 }  // namespace support
 
@@ -886,7 +1521,20 @@ inline ::std::string WriteToString(const EmbossViewType &view,
                                    TextOutputOptions options) {
   support::TextOutputStream text_stream;
   view.WriteToTextStream(&text_stream, options);
-  return text_stream.Result();
+  return ::std::move(text_stream).Result();
+}
+
+// Like WriteToString(view, options), but reserves size_hint bytes for the text
+// before writing it, so that output of about that size needs only one
+// allocation.  The returned string keeps the reserved capacity, so size_hint
+// should not be much larger than the expected output.
+template <typename EmbossViewType>
+inline ::std::string WriteToString(const EmbossViewType &view,
+                                   TextOutputOptions options,
+                                   ::std::size_t size_hint) {
+  support::TextOutputStream text_stream(size_hint);
+  view.WriteToTextStream(&text_stream, options);
+  return ::std::move(text_stream).Result();
 }
 
 template <typename EmbossViewType>
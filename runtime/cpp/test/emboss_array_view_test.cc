@@ -279,6 +279,109 @@ TEST(ArrayView, TextFormatOutput_MultilineComment) {
   }
 }
 
+TEST(ArrayView, TextFormatOutput_HexByteArrays) {
+  ::std::uint8_t bytes[40];
+  for (::std::size_t i = 0; i < sizeof bytes; ++i) bytes[i] = 'A' + i;
+  bytes[0] = 0;
+  bytes[1] = 0xff;
+  const auto hex = TextOutputOptions().WithHexByteArrays(true);
+  auto buffer = ReadWriteContiguousBuffer{bytes, 4};
+  EXPECT_EQ("{ hex: 00ff4344 }",
+            WriteToString(
+                ArrayView<FixedUIntView<8>, ReadWriteContiguousBuffer, 1>{
+                    buffer},
+                hex));
+  EXPECT_EQ("{ hex: }",
+            WriteToString(
+                ArrayView<FixedUIntView<8>, ReadWriteContiguousBuffer, 1>{
+                    ReadWriteContiguousBuffer{bytes, 0}},
+                hex));
+  // Only arrays of UInt:8 are affected.
+  EXPECT_EQ(
+      "{ [0]: 0, -1, 67, 68 }",
+      WriteToString(
+          ArrayView<FixedIntView<8>, ReadWriteContiguousBuffer, 1>{buffer},
+          hex));
+  EXPECT_EQ(
+      "{ [0]: 65280, 17475 }",
+      WriteToString(
+          ArrayView<FixedUIntView<16>, ReadWriteContiguousBuffer, 2>{buffer},
+          hex));
+  EXPECT_EQ(
+      WriteToString(
+          ArrayView<FixedUIntView<8>, ReadWriteContiguousBuffer, 1>{
+              ReadWriteContiguousBuffer{bytes, sizeof bytes}},
+          MultilineText().WithHexByteArrays(true)),
+      R"({
+  # ..CDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefgh
+  hex:
+  00ff434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f60
+  6162636465666768
+})");
+}
+
+// A text output stream with only the Write() overloads that the stream
+// concept requires.
+class MinimalStream final {
+ public:
+  void Write(const char *text) { text_ += text; }
+  void Write(const ::std::string &text) { text_ += text; }
+  void Write(char c) { text_ += c; }
+  const ::std::string &Result() const { return text_; }
+
+ private:
+  ::std::string text_;
+};
+
+TEST(ArrayView, TextFormatOutput_HexByteArraysToMinimalStream) {
+  ::std::uint8_t bytes[4] = {0, 0xff, 0x43, 0x44};
+  auto byte_array = ArrayView<FixedUIntView<8>, ReadWriteContiguousBuffer, 1>{
+      ReadWriteContiguousBuffer{bytes, sizeof bytes}};
+  MinimalStream hex_stream;
+  byte_array.WriteToTextStream(&hex_stream,
+                               TextOutputOptions().WithHexByteArrays(true));
+  EXPECT_EQ("{ hex: 00ff4344 }", hex_stream.Result());
+  MinimalStream stream;
+  byte_array.WriteToTextStream(&stream, TextOutputOptions());
+  EXPECT_EQ("{ [0]: 0, 255, 67, 68 }", stream.Result());
+}
+
+TEST(ArrayView, TextFormatInput_HexByteArrays) {
+  ::std::uint8_t bytes[8] = {0};
+  auto byte_array = ArrayView<FixedUIntView<8>, ReadWriteContiguousBuffer, 1>{
+      ReadWriteContiguousBuffer{bytes, sizeof bytes}};
+  EXPECT_TRUE(UpdateFromText(byte_array, "{ hex: }"));
+  EXPECT_TRUE(UpdateFromText(byte_array, "{hex:00fF1a}"));
+  EXPECT_EQ(0x00, bytes[0]);
+  EXPECT_EQ(0xff, bytes[1]);
+  EXPECT_EQ(0x1a, bytes[2]);
+  EXPECT_EQ(0x00, bytes[3]);
+  EXPECT_TRUE(UpdateFromText(byte_array, "{\n  # comment\n  hex:\n  0102\n"
+                                         "  03040506  # more\n  0708\n}"));
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(i + 1, bytes[i]);
+  EXPECT_FALSE(UpdateFromText(byte_array, "{ hex: 010203040506070809 }"));
+  EXPECT_FALSE(UpdateFromText(byte_array, "{ hex: 012 }"));
+  EXPECT_FALSE(UpdateFromText(byte_array, "{ hex: 0g }"));
+  EXPECT_FALSE(UpdateFromText(byte_array, "{ hex 01 }"));
+  EXPECT_FALSE(UpdateFromText(byte_array, "{ hex: 01"));
+  EXPECT_FALSE(UpdateFromText(byte_array, "{ hex: 01, 02 }"));
+  // The hex form is only accepted for arrays of UInt:8.
+  EXPECT_FALSE(UpdateFromText(
+      ArrayView<FixedIntView<8>, ReadWriteContiguousBuffer, 1>{
+          ReadWriteContiguousBuffer{bytes, sizeof bytes}},
+      "{ hex: 01 }"));
+  // Round trip.
+  for (int i = 0; i < 8; ++i) bytes[i] = 0x11 * i;
+  const ::std::string text =
+      WriteToString(byte_array, TextOutputOptions().WithHexByteArrays(true));
+  ::std::uint8_t copy[8] = {0};
+  EXPECT_TRUE(UpdateFromText(
+      ArrayView<FixedUIntView<8>, ReadWriteContiguousBuffer, 1>{
+          ReadWriteContiguousBuffer{copy, sizeof copy}},
+      text));
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(bytes[i], copy[i]);
+}
+
 }  // namespace test
 }  // namespace support
 }  // namespace emboss
@@ -519,6 +519,87 @@ TEST(ContiguousBuffer, ToString) {
 #endif  // __cplusplus >= 201703L
 }
 
+TEST(VectorBackedBuffer, ReadsPastEndOfVectorAreZero) {
+  ::std::vector</**/ ::std::uint8_t> bytes = {{0x01, 0x02}};
+  const auto buffer = VectorBackedBuffer<>{&bytes};
+  EXPECT_TRUE(buffer.Ok());
+  EXPECT_EQ(0x00000201U, (buffer.GetOffsetStorage<1, 0>(0, 4)
+                              .ReadLittleEndianUInt<32>()));
+  EXPECT_EQ(0x01020000U,
+            (buffer.GetOffsetStorage<1, 0>(0, 4).ReadBigEndianUInt<32>()));
+  EXPECT_EQ(0U,
+            (buffer.GetOffsetStorage<1, 0>(8, 2).ReadBigEndianUInt<16>()));
+  // Reads never grow the vector.
+  EXPECT_EQ(2U, bytes.size());
+}
+
+TEST(VectorBackedBuffer, WritesGrowVector) {
+  ::std::vector</**/ ::std::uint8_t> bytes;
+  const auto buffer = VectorBackedBuffer<>{&bytes};
+  buffer.GetOffsetStorage<1, 0>(2, 2).WriteBigEndianUInt<16>(0x0102);
+  EXPECT_EQ((::std::vector</**/ ::std::uint8_t>{0x00, 0x00, 0x01, 0x02}),
+            bytes);
+  buffer.GetOffsetStorage<1, 0>(0, 2).WriteLittleEndianUInt<16>(0x0304);
+  EXPECT_EQ((::std::vector</**/ ::std::uint8_t>{0x04, 0x03, 0x01, 0x02}),
+            bytes);
+}
+
+TEST(VectorBackedBuffer, SubBuffersSurviveReallocation) {
+  ::std::vector</**/ ::std::uint8_t> bytes;
+  bytes.shrink_to_fit();
+  const auto buffer = VectorBackedBuffer<>{&bytes};
+  const auto first = buffer.GetOffsetStorage<1, 0>(0, 1);
+  const auto second = first.GetOffsetStorage<1, 0>(0, 1);
+  first.WriteLittleEndianUInt<8>(0x11);
+  // Force several reallocations.
+  buffer.GetOffsetStorage<1, 0>(4095, 1).WriteLittleEndianUInt<8>(0x22);
+  EXPECT_EQ(4096U, bytes.size());
+  EXPECT_EQ(0x11U, second.ReadLittleEndianUInt<8>());
+  second.WriteLittleEndianUInt<8>(0x33);
+  EXPECT_EQ(0x33U, bytes[0]);
+  EXPECT_EQ(0x22U, bytes[4095]);
+}
+
+TEST(VectorBackedBuffer, MaxSize) {
+  ::std::vector</**/ ::std::uint8_t> bytes;
+  const auto buffer = VectorBackedBuffer<>{&bytes, 4};
+  EXPECT_EQ(4U, buffer.SizeInBytes());
+  EXPECT_EQ(2U, (buffer.GetOffsetStorage<1, 0>(2, 4).SizeInBytes()));
+  EXPECT_EQ(0U, (buffer.GetOffsetStorage<1, 0>(6, 4).SizeInBytes()));
+#if EMBOSS_CHECK_ABORTS
+  EXPECT_DEATH(
+      (buffer.GetOffsetStorage<1, 0>(2, 4).WriteLittleEndianUInt<32>(0)), "");
+  EXPECT_DEATH(VectorBackedBuffer<>().ReadLittleEndianUInt<8>(), "");
+#endif  // EMBOSS_CHECK_ABORTS
+  EXPECT_EQ(0U, bytes.size());
+  EXPECT_FALSE(VectorBackedBuffer<>().Ok());
+  EXPECT_FALSE((VectorBackedBuffer<>().GetOffsetStorage<1, 0>(0, 1).Ok()));
+}
+
+TEST(VectorBackedBuffer, CopyFrom) {
+  ::std::vector</**/ ::std::uint8_t> source = {{1, 2, 3}};
+  ::std::vector</**/ ::std::uint8_t> bytes;
+  const auto buffer = VectorBackedBuffer<>{&bytes};
+  buffer.GetOffsetStorage<1, 0>(1, 3).CopyFrom(
+      ReadOnlyContiguousBuffer{source.data(), source.size()}, 3);
+  EXPECT_EQ((::std::vector</**/ ::std::uint8_t>{0, 1, 2, 3}), bytes);
+  // Bytes past the end of the source vector are copied as zeroes.
+  buffer.GetOffsetStorage<1, 0>(4, 4).CopyFrom(
+      buffer.GetOffsetStorage<1, 0>(2, 4), 4);
+  EXPECT_EQ((::std::vector</**/ ::std::uint8_t>{0, 1, 2, 3, 2, 3, 0, 0}),
+            bytes);
+  EXPECT_FALSE(buffer.TryToCopyFrom(VectorBackedBuffer<>(), 1));
+  EXPECT_TRUE(buffer.TryToCopyFrom(VectorBackedBuffer<>{&source}, 2));
+  EXPECT_EQ((::std::vector</**/ ::std::uint8_t>{1, 2, 2, 3, 2, 3, 0, 0}),
+            bytes);
+  // A source which starts past the end of its vector is all zeroes.
+  ::std::vector</**/ ::std::uint8_t> short_source = {{9}};
+  buffer.GetOffsetStorage<1, 0>(0, 2).CopyFrom(
+      VectorBackedBuffer<>{&short_source}.GetOffsetStorage<1, 0>(3, 2), 2);
+  EXPECT_EQ((::std::vector</**/ ::std::uint8_t>{0, 0, 2, 3, 2, 3, 0, 0}),
+            bytes);
+}
+
 TEST(LittleEndianByteOrderer, Methods) {
   ::std::vector</**/ ::std::uint8_t> bytes = {
       {21, 22, 1, 2, 3, 4, 5, 6, 7, 8, 23, 24}};
@@ -0,0 +1,106 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/cpp/emboss_parallel_text_util.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "runtime/cpp/emboss_array_view.h"
+#include "runtime/cpp/emboss_prelude.h"
+
+namespace emboss {
+namespace support {
+namespace test {
+
+using ::emboss::prelude::UIntView;
+
+// Values which are multiples of 7 are not Ok(), so that partial output has
+// unreadable elements to skip.
+struct NoMultiplesOfSeven {
+  template <typename ValueType>
+  static constexpr bool ValueIsOk(ValueType value) {
+    return value % 7 != 0;
+  }
+};
+
+template <class Verifier>
+using UInt16View =
+    UIntView<FixedSizeViewParameters<16, Verifier>,
+             BitBlock<LittleEndianByteOrderer<ReadWriteContiguousBuffer>, 16>>;
+
+template <class Verifier>
+using UInt16ArrayView =
+    GenericArrayView<UInt16View<Verifier>, ReadWriteContiguousBuffer, 2, 8>;
+
+class ParallelTextTest : public ::testing::Test {
+ protected:
+  ParallelTextTest() : bytes_(2 * 10001) {
+    for (::std::size_t i = 0; i < bytes_.size(); ++i) {
+      bytes_[i] = static_cast</**/ ::std::uint8_t>(i * 37 + i / 256);
+    }
+  }
+
+  template <class Verifier>
+  UInt16ArrayView<Verifier> Array() {
+    return UInt16ArrayView<Verifier>{
+        ReadWriteContiguousBuffer{bytes_.data(), bytes_.size()}};
+  }
+
+  ::std::vector</**/ ::std::uint8_t> bytes_;
+};
+
+TEST_F(ParallelTextTest, MatchesSequentialOutput) {
+  const auto array = Array<AllValuesAreOk>();
+  for (const auto &options :
+       {TextOutputOptions(), MultilineText(),
+        TextOutputOptions().WithNumericBase(16).WithDigitGrouping(true)}) {
+    const ::std::string expected = WriteToString(array, options);
+    for (const unsigned thread_count : {0U, 1U, 2U, 3U, 8U}) {
+      EXPECT_EQ(expected, WriteToStringInParallel(array, options, thread_count))
+          << thread_count;
+    }
+  }
+}
+
+TEST_F(ParallelTextTest, MatchesSequentialPartialOutput) {
+  const auto array = Array<NoMultiplesOfSeven>();
+  for (const auto &options :
+       {TextOutputOptions().WithAllowPartialOutput(true),
+        TextOutputOptions().WithAllowPartialOutput(true).WithComments(true),
+        MultilineText().WithAllowPartialOutput(true)}) {
+    const ::std::string expected = WriteToString(array, options);
+    for (const unsigned thread_count : {2U, 3U, 7U}) {
+      EXPECT_EQ(expected, WriteToStringInParallel(array, options, thread_count))
+          << thread_count;
+    }
+  }
+}
+
+TEST(WriteToStringInParallel, SmallArrays) {
+  ::std::uint8_t bytes[6] = {1, 0, 2, 0, 3, 0};
+  const auto array = UInt16ArrayView<AllValuesAreOk>{
+      ReadWriteContiguousBuffer{bytes, sizeof bytes}};
+  EXPECT_EQ("{ [0]: 1, 2, 3 }", WriteToStringInParallel(array));
+  const auto empty = UInt16ArrayView<AllValuesAreOk>{
+      ReadWriteContiguousBuffer{bytes, 0}};
+  EXPECT_EQ(WriteToString(empty, MultilineText()),
+            WriteToStringInParallel(empty, MultilineText(), 4));
+}
+
+}  // namespace test
+}  // namespace support
+}  // namespace emboss
@@ -0,0 +1,149 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/cpp/emboss_text_file_util.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace emboss {
+namespace support {
+namespace test {
+
+// A sink which records each batch it is given.
+class RecordingSink final {
+ public:
+  explicit RecordingSink(::std::vector</**/ ::std::string> *batches,
+                         bool ok = true)
+      : batches_(batches), ok_(ok) {}
+
+  bool Write(const char *data, ::std::size_t size) {
+    batches_->push_back(::std::string(data, size));
+    return ok_;
+  }
+
+ private:
+  ::std::vector</**/ ::std::string> *batches_;
+  bool ok_;
+};
+
+TEST(BufferedTextOutputStream, BatchesWrites) {
+  ::std::vector</**/ ::std::string> batches;
+  {
+    BufferedTextOutputStream<RecordingSink, 8> stream{RecordingSink(&batches)};
+    stream.Write("abc");
+    stream.Write('d');
+    stream.Write(::std::string("efg"));
+    EXPECT_TRUE(batches.empty());
+    stream.Write("hi");
+    ASSERT_EQ(1U, batches.size());
+    EXPECT_EQ("abcdefg", batches[0]);
+    // Text larger than the buffer is passed straight through, after any
+    // buffered text.
+    stream.Write("0123456789");
+    ASSERT_EQ(3U, batches.size());
+    EXPECT_EQ("hi", batches[1]);
+    EXPECT_EQ("0123456789", batches[2]);
+    stream.Write("jk");
+    EXPECT_TRUE(stream.Flush());
+    ASSERT_EQ(4U, batches.size());
+    EXPECT_EQ("jk", batches[3]);
+    stream.Write("lm");
+  }
+  // The destructor flushes.
+  ASSERT_EQ(5U, batches.size());
+  EXPECT_EQ("lm", batches[4]);
+}
+
+TEST(BufferedTextOutputStream, StopsAfterSinkFailure) {
+  ::std::vector</**/ ::std::string> batches;
+  BufferedTextOutputStream<RecordingSink, 4> stream{
+      RecordingSink(&batches, false)};
+  stream.Write("abcd");
+  EXPECT_TRUE(stream.Ok());
+  EXPECT_FALSE(stream.Flush());
+  EXPECT_FALSE(stream.Ok());
+  stream.Write("efgh");
+  stream.Write("ijklmnop");
+  EXPECT_FALSE(stream.Flush());
+  EXPECT_EQ(1U, batches.size());
+}
+
+// A stand-in for a view, which writes count copies of text.
+class RepeatedTextView final {
+ public:
+  RepeatedTextView(const char *text, int count) : text_(text), count_(count) {}
+
+  template <class Stream>
+  void WriteToTextStream(Stream *stream, TextOutputOptions options) const {
+    for (int i = 0; i < count_; ++i) {
+      options.WriteCurrentIndent(stream);
+      stream->Write(text_);
+    }
+  }
+
+ private:
+  const char *text_;
+  int count_;
+};
+
+::std::string ReadAll(::std::FILE *file) {
+  ::std::string result;
+  ::std::rewind(file);
+  char buffer[4096];
+  ::std::size_t size;
+  while ((size = ::std::fread(buffer, 1, sizeof buffer, file)) > 0) {
+    result.append(buffer, size);
+  }
+  return result;
+}
+
+TEST(WriteToFile, WritesText) {
+  ::std::FILE *file = ::std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  const RepeatedTextView view("0123456789", 10000);
+  EXPECT_TRUE(WriteToFile(view, file));
+  EXPECT_TRUE(WriteToFile(view, file,
+                          TextOutputOptions().WithIndent("-").PlusOneIndent()));
+  ::std::string expected;
+  for (int i = 0; i < 10000; ++i) expected += "0123456789";
+  for (int i = 0; i < 10000; ++i) expected += "-0123456789";
+  EXPECT_EQ(expected, ReadAll(file));
+  ::std::fclose(file);
+}
+
+#if EMBOSS_HAS_POSIX_FD
+TEST(WriteToFd, WritesText) {
+  ::std::FILE *file = ::std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  const RepeatedTextView view("0123456789", 10000);
+  EXPECT_TRUE(WriteToFd(view, fileno(file)));
+  ::std::string expected;
+  for (int i = 0; i < 10000; ++i) expected += "0123456789";
+  EXPECT_EQ(expected, ReadAll(file));
+  ::std::fclose(file);
+}
+
+TEST(WriteToFd, ReportsErrors) {
+  const RepeatedTextView view("0123456789", 10);
+  EXPECT_FALSE(WriteToFd(view, -1));
+}
+#endif  // EMBOSS_HAS_POSIX_FD
+
+}  // namespace test
+}  // namespace support
+}  // namespace emboss
@@ -16,6 +16,8 @@
 
 #include <cmath>
 #include <limits>
+#include <string>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -263,6 +265,60 @@ TEST(DecodeInteger, DecodeInt64) {
   EXPECT_EQ(-9223372036854775807LL - 1LL, result);
 }
 
+// Numbers without digit separators take a fast path through DecodeInteger;
+// adding a separator forces the general path, which must agree.
+TEST(DecodeInteger, PlainDigitsMatchGroupedDigits) {
+  ::std::uint64_t seed = 1;
+  for (int i = 0; i < 10000; ++i) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    const ::std::uint64_t value = seed >> (i % 64);
+    const ::std::string decimal = ::std::to_string(value);
+    ::std::uint64_t plain = 0, grouped = 1;
+    EXPECT_TRUE(DecodeInteger(decimal, &plain)) << decimal;
+    EXPECT_TRUE(DecodeInteger("0_" + decimal, &grouped)) << decimal;
+    EXPECT_EQ(value, plain);
+    EXPECT_EQ(value, grouped);
+
+    const ::std::int64_t signed_value =
+        -static_cast</**/ ::std::int64_t>(value >> 1) - 1;
+    const ::std::string signed_decimal = ::std::to_string(signed_value);
+    ::std::int64_t signed_plain = 0, signed_grouped = 1;
+    EXPECT_TRUE(DecodeInteger(signed_decimal, &signed_plain))
+        << signed_decimal;
+    EXPECT_TRUE(DecodeInteger("-0_" + signed_decimal.substr(1),
+                              &signed_grouped))
+        << signed_decimal;
+    EXPECT_EQ(signed_value, signed_plain);
+    EXPECT_EQ(signed_value, signed_grouped);
+
+    ::std::uint32_t narrow_plain = 0, narrow_grouped = 1;
+    const bool fits = value <= 0xffffffffU;
+    EXPECT_EQ(fits, DecodeInteger(decimal, &narrow_plain)) << decimal;
+    EXPECT_EQ(fits, DecodeInteger("0_" + decimal, &narrow_grouped)) << decimal;
+    if (fits) {
+      EXPECT_EQ(narrow_plain, narrow_grouped);
+    }
+  }
+}
+
+TEST(DecodeInteger, RejectsNonDigitsAtAnyPosition) {
+  // '/' and ':' are the characters immediately before '0' and after '9'.
+  for (const char bad : {'/', ':', 'a', ' ', '\x80'}) {
+    for (int position = 0; position < 18; ++position) {
+      ::std::string text(18, '1');
+      text[position] = bad;
+      ::std::uint64_t result = 7;
+      EXPECT_FALSE(DecodeInteger(text, &result)) << text;
+      EXPECT_EQ(7U, result);
+    }
+  }
+  ::std::uint64_t result;
+  EXPECT_TRUE(DecodeInteger("1234567890123456789", &result));
+  EXPECT_EQ(1234567890123456789ULL, result);
+  EXPECT_TRUE(DecodeInteger("0x0123456789abcdef", &result));
+  EXPECT_EQ(0x0123456789abcdefULL, result);
+}
+
 TEST(TextStream, Construction) {
   ::std::string string_text = "ab";
   auto text_stream = TextStream(string_text);
@@ -319,6 +375,24 @@ TEST(TextStream, Methods) {
   EXPECT_EQ('g', result);
 }
 
+TEST(TextOutputStream, Write) {
+  auto stream = TextOutputStream{};
+  stream.Write(::std::string("abc"));
+  stream.Write("def");
+  stream.Write("ghijk", 2);
+  stream.Write('!');
+  EXPECT_EQ(9U, stream.Size());
+  EXPECT_EQ("abcdefgh!", stream.Result());
+  EXPECT_EQ("abcdefgh!", stream.Result());
+  EXPECT_EQ("abcdefgh!", ::std::move(stream).Result());
+}
+
+TEST(TextOutputStream, SizeHint) {
+  auto stream = TextOutputStream{1000};
+  stream.Write("abc");
+  EXPECT_EQ("abc", ::std::move(stream).Result());
+}
+
 TEST(ReadToken, ReadsToken) {
   auto text_stream = TextStream{"abc"};
   ::std::string result;
@@ -363,6 +437,61 @@ TEST(ReadToken, SkipsComments) {
   EXPECT_EQ("", result);
 }
 
+TEST(ReadToken, ReadsPunctuation) {
+  auto text_stream = TextStream{"{a:1,b:[2]}"};
+  ::std::string result;
+  for (const char *expected :
+       {"{", "a", ":", "1", ",", "b", ":", "[", "2", "]", "}", ""}) {
+    EXPECT_TRUE(ReadToken(&text_stream, &result));
+    EXPECT_EQ(expected, result);
+  }
+}
+
+// When reading from a TextStream, a TextToken refers directly to the stream's
+// text instead of copying it.
+TEST(ReadToken, TextTokenRefersToTextStream) {
+  const char *text = " abc:def";
+  auto text_stream = TextStream{text};
+  TextToken token;
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_EQ(text + 1, token.data());
+  EXPECT_EQ(3U, token.size());
+  EXPECT_TRUE(token == "abc");
+  EXPECT_FALSE(token == "ab");
+  EXPECT_FALSE(token == "abcd");
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_EQ(text + 4, token.data());
+  EXPECT_TRUE(token == ":");
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_EQ("def", token.ToString());
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_TRUE(token.empty());
+}
+
+// A stream with only Read() and Unread(), to exercise the generic ReadToken().
+class CharByCharStream final {
+ public:
+  explicit CharByCharStream(const char *text) : stream_(text) {}
+  bool Read(char *result) { return stream_.Read(result); }
+  bool Unread(char c) { return stream_.Unread(c); }
+
+ private:
+  TextStream stream_;
+};
+
+TEST(ReadToken, TextTokenCopiesFromOtherStreams) {
+  auto text_stream = CharByCharStream{" abc # comment\n{def"};
+  TextToken token;
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_EQ("abc", token.ToString());
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_TRUE(token == "{");
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_EQ("def", token.ToString());
+  EXPECT_TRUE(ReadToken(&text_stream, &token));
+  EXPECT_TRUE(token.empty());
+}
+
 TEST(TextOutputOptions, Defaults) {
   TextOutputOptions options;
   EXPECT_EQ("", options.current_indent());
@@ -390,6 +519,63 @@ TEST(TextOutputOptions, PlusOneIndent) {
   EXPECT_EQ("xyz", new_options.current_indent());
   EXPECT_EQ("xyz", new_options.indent());
   EXPECT_EQ("xyzxyz", new_options.PlusOneIndent().current_indent());
+  EXPECT_EQ(0, options.indent_depth());
+  EXPECT_EQ(1, new_options.indent_depth());
+  EXPECT_EQ(2, new_options.PlusOneIndent().indent_depth());
+}
+
+TEST(TextOutputOptions, WriteCurrentIndent) {
+  TextOutputStream stream;
+  TextOutputOptions().PlusOneIndent().WriteCurrentIndent(&stream);
+  EXPECT_EQ("", stream.Result());
+  TextOutputOptions options = TextOutputOptions().WithIndent("ab");
+  options.WriteCurrentIndent(&stream);
+  EXPECT_EQ("", stream.Result());
+  options.PlusOneIndent().PlusOneIndent().WriteCurrentIndent(&stream);
+  EXPECT_EQ("abab", stream.Result());
+}
+
+// A stream which records how many times Write() was called.
+class CountingTextOutputStream final {
+ public:
+  void Write(const ::std::string &text) { Write(text.c_str()); }
+  void Write(const char *text) {
+    ++writes_;
+    text_ += text;
+  }
+
+  int writes() const { return writes_; }
+  const ::std::string &text() const { return text_; }
+
+ private:
+  int writes_ = 0;
+  ::std::string text_;
+};
+
+TEST(TextOutputOptions, WriteCurrentIndentOfSpaces) {
+  TextOutputOptions options = TextOutputOptions().WithIndent("  ");
+  for (int i = 0; i < 3; ++i) options = options.PlusOneIndent();
+  CountingTextOutputStream stream;
+  options.WriteCurrentIndent(&stream);
+  EXPECT_EQ(::std::string(6, ' '), stream.text());
+  EXPECT_EQ(1, stream.writes());
+
+  // Indents longer than the static run of spaces are written one level at a
+  // time.
+  for (int i = 3; i < 40; ++i) options = options.PlusOneIndent();
+  CountingTextOutputStream deep_stream;
+  options.WriteCurrentIndent(&deep_stream);
+  EXPECT_EQ(::std::string(80, ' '), deep_stream.text());
+  EXPECT_EQ(40, deep_stream.writes());
+}
+
+// The indent is applied at every depth, even if it is changed after
+// PlusOneIndent().
+TEST(TextOutputOptions, WithIndentAfterPlusOneIndent) {
+  TextOutputOptions options =
+      TextOutputOptions().WithIndent("ab").PlusOneIndent().WithIndent("x");
+  EXPECT_EQ("x", options.current_indent());
+  EXPECT_EQ("xx", options.PlusOneIndent().current_indent());
 }
 
 TEST(TextOutputOptions, WithComments) {
@@ -600,6 +786,37 @@ TEST(WriteIntegerToTextStream, Decimal) {
           static_cast</**/ ::std::int64_t>(9223372036854775807L), 10, true));
 }
 
+// The table-driven encoders agree with a straightforward digit-at-a-time
+// encoding for every 16-bit value, in every base.
+TEST(WriteIntegerToTextStream, MatchesReferenceEncoding) {
+  for (int base : {2, 10, 16}) {
+    const ::std::size_t grouping = base == 10 ? 3 : base == 16 ? 4 : 8;
+    const ::std::string prefix = base == 16 ? "0x" : base == 2 ? "0b" : "";
+    for (int i = -32768; i <= 32767; ++i) {
+      ::std::string digits;
+      ::std::string grouped_digits;
+      int magnitude = i < 0 ? -i : i;
+      do {
+        if (!digits.empty() && digits.size() % grouping == 0) {
+          grouped_digits.insert(0, 1, '_');
+        }
+        const char digit = "0123456789abcdef"[magnitude % base];
+        digits.insert(0, 1, digit);
+        grouped_digits.insert(0, 1, digit);
+        magnitude /= base;
+      } while (magnitude > 0);
+      const ::std::string sign = i < 0 ? "-" : "";
+      const auto value = static_cast</**/ ::std::int16_t>(i);
+      ASSERT_EQ(sign + prefix + digits,
+                WriteIntegerToString(value, base, false))
+          << i;
+      ASSERT_EQ(sign + prefix + grouped_digits,
+                WriteIntegerToString(value, base, true))
+          << i;
+    }
+  }
+}
+
 TEST(WriteIntegerToTextStream, Binary) {
   EXPECT_EQ("0b0", WriteIntegerToString(static_cast</**/ ::std::uint8_t>(0), 2,
                                         false));
@@ -942,8 +1159,13 @@ TEST(WriteFloatToTextStream, RegularNumbers) {
   EXPECT_EQ("0", WriteFloatToString(0.0, TextOutputOptions()));
   EXPECT_EQ("1", WriteFloatToString(1.0, TextOutputOptions()));
   EXPECT_EQ("1.5", WriteFloatToString(1.5, TextOutputOptions()));
-  // TODO(bolms): Figure out how to get minimal-length output.
-  EXPECT_EQ("1.6000000000000001", WriteFloatToString(1.6, TextOutputOptions()));
+  EXPECT_EQ("1.6", WriteFloatToString(1.6, TextOutputOptions()));
+  EXPECT_EQ("-0", WriteFloatToString(-0.0, TextOutputOptions()));
+  EXPECT_EQ("0.0001", WriteFloatToString(0.0001, TextOutputOptions()));
+  EXPECT_EQ("1.5e-05", WriteFloatToString(0.000015, TextOutputOptions()));
+  EXPECT_EQ("100", WriteFloatToString(100.0, TextOutputOptions()));
+  EXPECT_EQ("10000000000000000", WriteFloatToString(1e16, TextOutputOptions()));
+  EXPECT_EQ("1e+17", WriteFloatToString(1e17, TextOutputOptions()));
   EXPECT_EQ("123456789", WriteFloatToString(123456789.0, TextOutputOptions()));
   EXPECT_EQ("12345678901234568",
             WriteFloatToString(12345678901234567.0, TextOutputOptions()));
@@ -951,7 +1173,7 @@ TEST(WriteFloatToTextStream, RegularNumbers) {
             WriteFloatToString(-12345678901234567.0, TextOutputOptions()));
   EXPECT_EQ("-1.2345678901234568e+17",
             WriteFloatToString(-123456789012345678.0, TextOutputOptions()));
-  EXPECT_EQ("4.9406564584124654e-324",
+  EXPECT_EQ("5e-324",
             WriteFloatToString(::std::numeric_limits<double>::denorm_min(),
                                TextOutputOptions()));
   EXPECT_EQ("1.7976931348623157e+308",
@@ -961,22 +1183,65 @@ TEST(WriteFloatToTextStream, RegularNumbers) {
   EXPECT_EQ("0", WriteFloatToString(0.0f, TextOutputOptions()));
   EXPECT_EQ("1", WriteFloatToString(1.0f, TextOutputOptions()));
   EXPECT_EQ("1.5", WriteFloatToString(1.5f, TextOutputOptions()));
-  EXPECT_EQ("1.60000002", WriteFloatToString(1.6f, TextOutputOptions()));
-  EXPECT_EQ("123456792", WriteFloatToString(123456789.0f, TextOutputOptions()));
-  EXPECT_EQ("1.23456784e+16",
+  EXPECT_EQ("1.6", WriteFloatToString(1.6f, TextOutputOptions()));
+  EXPECT_EQ("123456790", WriteFloatToString(123456789.0f, TextOutputOptions()));
+  EXPECT_EQ("1.2345678e+16",
             WriteFloatToString(12345678901234567.0f, TextOutputOptions()));
-  EXPECT_EQ("-1.23456784e+16",
+  EXPECT_EQ("-1.2345678e+16",
             WriteFloatToString(-12345678901234567.0f, TextOutputOptions()));
-  EXPECT_EQ("-1.00000003e+16",
+  EXPECT_EQ("-1e+16",
             WriteFloatToString(-10000000000000000.0f, TextOutputOptions()));
-  EXPECT_EQ("1.40129846e-45",
+  EXPECT_EQ("1e-45",
             WriteFloatToString(::std::numeric_limits<float>::denorm_min(),
                                TextOutputOptions()));
-  EXPECT_EQ("3.40282347e+38",
+  EXPECT_EQ("3.4028235e+38",
             WriteFloatToString(::std::numeric_limits<float>::max(),
                                TextOutputOptions()));
 }
 
+// The printf-based fallback finds the same digits as the default encoder, and
+// every output reads back as the original value.
+template <class Float>
+void CheckShortestFloatEncoding(Float n) {
+  if (!::std::isfinite(n) || n == 0) return;
+  char digits[FloatConstants<Float>::kPrintfPrecision()];
+  char fallback_digits[FloatConstants<Float>::kPrintfPrecision()];
+  int exponent, fallback_exponent;
+  const int digit_count =
+      EncodeShortestFloatDigits(n < 0 ? -n : n, digits, &exponent);
+  const int fallback_digit_count = EncodeShortestFloatDigitsWithPrintf(
+      n < 0 ? -n : n, fallback_digits, &fallback_exponent);
+  const ::std::string text = WriteFloatToString(n, TextOutputOptions());
+  ASSERT_EQ(::std::string(digits, digit_count),
+            ::std::string(fallback_digits, fallback_digit_count))
+      << text;
+  ASSERT_EQ(exponent, fallback_exponent) << text;
+  Float round_trip;
+  ASSERT_TRUE(DecodeFloat(text, &round_trip)) << text;
+  ASSERT_EQ(n, round_trip) << text;
+}
+
+TEST(WriteFloatToTextStream, ShortestRoundTrip) {
+  ::std::uint64_t state = 0x0123456789abcdefU;
+  for (int i = 0; i < 20000; ++i) {
+    // xorshift64, so that the test does not depend on <random>.
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    double random_double;
+    ::std::memcpy(&random_double, &state, sizeof random_double);
+    CheckShortestFloatEncoding(random_double);
+    const auto low_bits = static_cast</**/ ::std::uint32_t>(state);
+    float random_float;
+    ::std::memcpy(&random_float, &low_bits, sizeof random_float);
+    CheckShortestFloatEncoding(random_float);
+    // Values with few significant digits exercise the shorter encodings.
+    CheckShortestFloatEncoding(static_cast<double>(state % 100000000) / 1e4);
+    CheckShortestFloatEncoding(static_cast<float>(state % 100000) / 1e3f);
+    CheckShortestFloatEncoding(static_cast<float>(state % 100000) * 1e-43f);
+  }
+}
+
 TEST(WriteFloatToTextStream, Infinities) {
   EXPECT_EQ("Inf", WriteFloatToString(2 * ::std::numeric_limits<double>::max(),
                                       TextOutputOptions()));
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_ABSOLUTE_CPP_NAMESPACE_EMB_H_
 #define TESTDATA_ABSOLUTE_CPP_NAMESPACE_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -40,7 +42,17 @@ class EnumTraits<Foo> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    Foo *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("VALUE", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Foo *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("VALUE", emboss_reserved_local_name, 5)) {
       *emboss_reserved_local_result = Foo::VALUE;
       return true;
     }
@@ -88,6 +100,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Foo *emboss_reserved_local_result) {
+  return EnumTraits<Foo>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     Foo emboss_reserved_local_value) {
   return EnumTraits<Foo>::TryToGetNameFromEnum(
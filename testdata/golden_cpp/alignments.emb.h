@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_ALIGNMENTS_EMB_H_
 #define TESTDATA_ALIGNMENTS_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -66,6 +68,7 @@ namespace Alignments {
 }  // namespace Alignments
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericAlignmentsView;
 
@@ -564,13 +567,13 @@ class GenericAlignmentsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -579,97 +582,181 @@ class GenericAlignmentsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "zero_offset") {
-        if (!zero_offset().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "zero_offset_substructure") {
-        if (!zero_offset_substructure().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "two_offset_substructure") {
-        if (!two_offset_substructure().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "three_offset") {
-        if (!three_offset().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "four_offset") {
-        if (!four_offset().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "eleven_offset") {
-        if (!eleven_offset().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "twelve_offset") {
-        if (!twelve_offset().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "zero_offset_four_stride_array") {
-        if (!zero_offset_four_stride_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "zero_offset_six_stride_array") {
-        if (!zero_offset_six_stride_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "three_offset_four_stride_array") {
-        if (!three_offset_four_stride_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_offset") {
+                if (!four_offset().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'z':
+              if (emboss_reserved_local_name == "zero_offset") {
+                if (!zero_offset().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 12:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "three_offset") {
+                if (!three_offset().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 13:
+          switch (emboss_reserved_local_name[0]) {
+            case 'e':
+              if (emboss_reserved_local_name == "eleven_offset") {
+                if (!eleven_offset().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "twelve_offset") {
+                if (!twelve_offset().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 23:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "two_offset_substructure") {
+                if (!two_offset_substructure().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 24:
+          switch (emboss_reserved_local_name[0]) {
+            case 'z':
+              if (emboss_reserved_local_name == "zero_offset_substructure") {
+                if (!zero_offset_substructure().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 28:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_offset_six_stride_array") {
+                if (!four_offset_six_stride_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'z':
+              if (emboss_reserved_local_name == "zero_offset_six_stride_array") {
+                if (!zero_offset_six_stride_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 29:
+          switch (emboss_reserved_local_name[0]) {
+            case 'z':
+              if (emboss_reserved_local_name == "zero_offset_four_stride_array") {
+                if (!zero_offset_four_stride_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 30:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "three_offset_four_stride_array") {
+                if (!three_offset_four_stride_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "four_offset_six_stride_array") {
-        if (!four_offset_six_stride_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -692,8 +779,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           zero_offset().IsAggregate() || zero_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -711,8 +798,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !zero_offset().IsAggregate() && !zero_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# zero_offset: UNREADABLE\n");
       }
@@ -722,8 +809,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           zero_offset_substructure().IsAggregate() || zero_offset_substructure().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -741,8 +828,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !zero_offset_substructure().IsAggregate() && !zero_offset_substructure().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# zero_offset_substructure: UNREADABLE\n");
       }
@@ -752,8 +839,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_offset_substructure().IsAggregate() || two_offset_substructure().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -771,8 +858,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_offset_substructure().IsAggregate() && !two_offset_substructure().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_offset_substructure: UNREADABLE\n");
       }
@@ -782,8 +869,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           three_offset().IsAggregate() || three_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -801,8 +888,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !three_offset().IsAggregate() && !three_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# three_offset: UNREADABLE\n");
       }
@@ -812,8 +899,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_offset().IsAggregate() || four_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -831,8 +918,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_offset().IsAggregate() && !four_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_offset: UNREADABLE\n");
       }
@@ -842,8 +929,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           eleven_offset().IsAggregate() || eleven_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -861,8 +948,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !eleven_offset().IsAggregate() && !eleven_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# eleven_offset: UNREADABLE\n");
       }
@@ -872,8 +959,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           twelve_offset().IsAggregate() || twelve_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -891,8 +978,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !twelve_offset().IsAggregate() && !twelve_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# twelve_offset: UNREADABLE\n");
       }
@@ -902,8 +989,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           zero_offset_four_stride_array().IsAggregate() || zero_offset_four_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -921,8 +1008,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !zero_offset_four_stride_array().IsAggregate() && !zero_offset_four_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# zero_offset_four_stride_array: UNREADABLE\n");
       }
@@ -932,8 +1019,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           zero_offset_six_stride_array().IsAggregate() || zero_offset_six_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -951,8 +1038,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !zero_offset_six_stride_array().IsAggregate() && !zero_offset_six_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# zero_offset_six_stride_array: UNREADABLE\n");
       }
@@ -962,8 +1049,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           three_offset_four_stride_array().IsAggregate() || three_offset_four_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -981,8 +1068,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !three_offset_four_stride_array().IsAggregate() && !three_offset_four_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# three_offset_four_stride_array: UNREADABLE\n");
       }
@@ -992,8 +1079,8 @@ class GenericAlignmentsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_offset_six_stride_array().IsAggregate() || four_offset_six_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1011,8 +1098,8 @@ class GenericAlignmentsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_offset_six_stride_array().IsAggregate() && !four_offset_six_stride_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_offset_six_stride_array: UNREADABLE\n");
       }
@@ -1020,8 +1107,8 @@ class GenericAlignmentsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1030,6 +1117,92 @@ class GenericAlignmentsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_zero_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("zero_offset", zero_offset());
+    }
+
+    if (has_zero_offset_substructure().ValueOr(false)) {
+      emboss_reserved_local_visitor("zero_offset_substructure", zero_offset_substructure());
+    }
+
+    if (has_two_offset_substructure().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_offset_substructure", two_offset_substructure());
+    }
+
+    if (has_three_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("three_offset", three_offset());
+    }
+
+    if (has_four_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_offset", four_offset());
+    }
+
+    if (has_eleven_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("eleven_offset", eleven_offset());
+    }
+
+    if (has_twelve_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("twelve_offset", twelve_offset());
+    }
+
+    if (has_zero_offset_four_stride_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("zero_offset_four_stride_array", zero_offset_four_stride_array());
+    }
+
+    if (has_zero_offset_six_stride_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("zero_offset_six_stride_array", zero_offset_six_stride_array());
+    }
+
+    if (has_three_offset_four_stride_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("three_offset_four_stride_array", three_offset_four_stride_array());
+    }
+
+    if (has_four_offset_six_stride_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_offset_six_stride_array", four_offset_six_stride_array());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 11; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "zero_offset", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "zero_offset_substructure", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "two_offset_substructure", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "three_offset", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "four_offset", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "eleven_offset", false, false} :
+           emboss_reserved_local_index == 6 ? ::emboss::support::FieldDescriptor{
+               "twelve_offset", false, false} :
+           emboss_reserved_local_index == 7 ? ::emboss::support::FieldDescriptor{
+               "zero_offset_four_stride_array", false, false} :
+           emboss_reserved_local_index == 8 ? ::emboss::support::FieldDescriptor{
+               "zero_offset_six_stride_array", false, false} :
+           emboss_reserved_local_index == 9 ? ::emboss::support::FieldDescriptor{
+               "three_offset_four_stride_array", false, false} :
+           emboss_reserved_local_index == 10 ? ::emboss::support::FieldDescriptor{
+               "four_offset_six_stride_array", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1288,6 +1461,18 @@ namespace Placeholder4 {
 }  // namespace Placeholder4
 
 
+struct EMBOSS_MAY_ALIAS EmbossReservedNativePlaceholder4 {
+  ::std::uint32_t dummy;
+};
+static_assert(sizeof(EmbossReservedNativePlaceholder4) == 4,
+              "EmbossReservedNativePlaceholder4 does not match the layout of "
+              "Placeholder4.");
+static_assert(offsetof(EmbossReservedNativePlaceholder4, dummy) == 0,
+              "EmbossReservedNativePlaceholder4::dummy is not at the same "
+              "offset as Placeholder4::dummy.");
+
+
+
 template <class View>
 struct EmbossReservedInternalIsGenericPlaceholder4View;
 
@@ -1436,13 +1621,13 @@ class GenericPlaceholder4View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1451,17 +1636,32 @@ class GenericPlaceholder4View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "dummy") {
-        if (!dummy().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'd':
+              if (emboss_reserved_local_name == "dummy") {
+                if (!dummy().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -1484,8 +1684,8 @@ class GenericPlaceholder4View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           dummy().IsAggregate() || dummy().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1503,8 +1703,8 @@ class GenericPlaceholder4View final {
                  emboss_reserved_local_field_options.comments() &&
                  !dummy().IsAggregate() && !dummy().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# dummy: UNREADABLE\n");
       }
@@ -1512,8 +1712,8 @@ class GenericPlaceholder4View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1522,6 +1722,50 @@ class GenericPlaceholder4View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_dummy().ValueOr(false)) {
+      emboss_reserved_local_visitor("dummy", dummy());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "dummy", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  using Native = EmbossReservedNativePlaceholder4;
+
+  static constexpr bool HasNativeLayout() { return EMBOSS_HAS_MAY_ALIAS && EMBOSS_SYSTEM_IS_BIG_ENDIAN; }
+
+  template <class EmbossReservedStorage = Storage>
+  typename ::std::conditional<
+      ::std::is_const<typename ::std::remove_reference<decltype(
+          *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+      const Native *, Native *>::type
+  AsNative() const {
+    static_assert(HasNativeLayout() || sizeof(EmbossReservedStorage) == 0,
+                  "Placeholder4 does not have a native layout on this system.");
+    EMBOSS_CHECK_GE(backing_.SizeInBytes(), sizeof(Native));
+    EMBOSS_CHECK_POINTER_ALIGNMENT(backing_.data(), alignof(Native), 0);
+    return reinterpret_cast<typename ::std::conditional<
+        ::std::is_const<typename ::std::remove_reference<decltype(
+            *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+        const Native *, Native *>::type>(backing_.data());
+  }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1707,6 +1951,7 @@ namespace Placeholder6 {
 }  // namespace Placeholder6
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericPlaceholder6View;
 
@@ -1890,13 +2135,13 @@ class GenericPlaceholder6View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1905,25 +2150,49 @@ class GenericPlaceholder6View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "zero_offset") {
-        if (!zero_offset().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "two_offset") {
+                if (!two_offset().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'z':
+              if (emboss_reserved_local_name == "zero_offset") {
+                if (!zero_offset().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "two_offset") {
-        if (!two_offset().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1946,8 +2215,8 @@ class GenericPlaceholder6View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           zero_offset().IsAggregate() || zero_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1965,8 +2234,8 @@ class GenericPlaceholder6View final {
                  emboss_reserved_local_field_options.comments() &&
                  !zero_offset().IsAggregate() && !zero_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# zero_offset: UNREADABLE\n");
       }
@@ -1976,8 +2245,8 @@ class GenericPlaceholder6View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_offset().IsAggregate() || two_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1995,8 +2264,8 @@ class GenericPlaceholder6View final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_offset().IsAggregate() && !two_offset().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_offset: UNREADABLE\n");
       }
@@ -2004,8 +2273,8 @@ class GenericPlaceholder6View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2014,6 +2283,38 @@ class GenericPlaceholder6View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_zero_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("zero_offset", zero_offset());
+    }
+
+    if (has_two_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_offset", two_offset());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "zero_offset", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "two_offset", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
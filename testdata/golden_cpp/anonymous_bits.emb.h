@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_ANONYMOUS_BITS_EMB_H_
 #define TESTDATA_ANONYMOUS_BITS_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -72,6 +74,7 @@ namespace EmbossReservedAnonymousField2 {
 }  // namespace EmbossReservedAnonymousField2
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericEmbossReservedAnonymousField2View;
 
@@ -290,13 +293,13 @@ class GenericEmbossReservedAnonymousField2View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -305,33 +308,66 @@ class GenericEmbossReservedAnonymousField2View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "high_bit") {
-        if (!high_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "bar") {
-        if (!bar().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 3:
+          switch (emboss_reserved_local_name[0]) {
+            case 'b':
+              if (emboss_reserved_local_name == "bar") {
+                if (!bar().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "high_bit") {
+                if (!high_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "first_bit") {
+                if (!first_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "first_bit") {
-        if (!first_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -354,8 +390,8 @@ class GenericEmbossReservedAnonymousField2View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           high_bit().IsAggregate() || high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -373,8 +409,8 @@ class GenericEmbossReservedAnonymousField2View final {
                  emboss_reserved_local_field_options.comments() &&
                  !high_bit().IsAggregate() && !high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# high_bit: UNREADABLE\n");
       }
@@ -384,8 +420,8 @@ class GenericEmbossReservedAnonymousField2View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           bar().IsAggregate() || bar().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -403,8 +439,8 @@ class GenericEmbossReservedAnonymousField2View final {
                  emboss_reserved_local_field_options.comments() &&
                  !bar().IsAggregate() && !bar().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# bar: UNREADABLE\n");
       }
@@ -414,8 +450,8 @@ class GenericEmbossReservedAnonymousField2View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           first_bit().IsAggregate() || first_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -433,8 +469,8 @@ class GenericEmbossReservedAnonymousField2View final {
                  emboss_reserved_local_field_options.comments() &&
                  !first_bit().IsAggregate() && !first_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# first_bit: UNREADABLE\n");
       }
@@ -442,8 +478,8 @@ class GenericEmbossReservedAnonymousField2View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -452,6 +488,44 @@ class GenericEmbossReservedAnonymousField2View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_high_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("high_bit", high_bit());
+    }
+
+    if (has_bar().ValueOr(false)) {
+      emboss_reserved_local_visitor("bar", bar());
+    }
+
+    if (has_first_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("first_bit", first_bit());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "high_bit", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "bar", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "first_bit", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -660,12 +734,23 @@ class EnumTraits<Bar> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    Bar *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("BAR", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Bar *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 3 &&
+        !memcmp("BAR", emboss_reserved_local_name, 3)) {
       *emboss_reserved_local_result = Bar::BAR;
       return true;
     }
 
-    if (!strcmp("BAZ", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 3 &&
+        !memcmp("BAZ", emboss_reserved_local_name, 3)) {
       *emboss_reserved_local_result = Bar::BAZ;
       return true;
     }
@@ -717,6 +802,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Bar *emboss_reserved_local_result) {
+  return EnumTraits<Bar>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     Bar emboss_reserved_local_value) {
   return EnumTraits<Bar>::TryToGetNameFromEnum(
@@ -743,6 +837,7 @@ namespace EmbossReservedAnonymousField1 {
 }  // namespace EmbossReservedAnonymousField1
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericEmbossReservedAnonymousField1View;
 
@@ -926,13 +1021,13 @@ class GenericEmbossReservedAnonymousField1View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -941,25 +1036,49 @@ class GenericEmbossReservedAnonymousField1View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "bit_23") {
-        if (!bit_23().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 'b':
+              if (emboss_reserved_local_name == "bit_23") {
+                if (!bit_23().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "low_bit") {
+                if (!low_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "low_bit") {
-        if (!low_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -982,8 +1101,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           bit_23().IsAggregate() || bit_23().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1001,8 +1120,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !bit_23().IsAggregate() && !bit_23().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# bit_23: UNREADABLE\n");
       }
@@ -1012,8 +1131,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           low_bit().IsAggregate() || low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1031,8 +1150,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !low_bit().IsAggregate() && !low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# low_bit: UNREADABLE\n");
       }
@@ -1040,8 +1159,8 @@ class GenericEmbossReservedAnonymousField1View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1050,6 +1169,38 @@ class GenericEmbossReservedAnonymousField1View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_bit_23().ValueOr(false)) {
+      emboss_reserved_local_visitor("bit_23", bit_23());
+    }
+
+    if (has_low_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("low_bit", low_bit());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "bit_23", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "low_bit", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1238,6 +1389,7 @@ MakeAlignedEmbossReservedAnonymousField1View(
 }  // namespace Foo
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericFooView;
 
@@ -1441,13 +1593,13 @@ class GenericFooView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1456,49 +1608,100 @@ class GenericFooView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "high_bit") {
-        if (!high_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "bar") {
-        if (!bar().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "first_bit") {
-        if (!first_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 3:
+          switch (emboss_reserved_local_name[0]) {
+            case 'b':
+              if (emboss_reserved_local_name == "bar") {
+                if (!bar().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 'b':
+              if (emboss_reserved_local_name == "bit_23") {
+                if (!bit_23().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "low_bit") {
+                if (!low_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "high_bit") {
+                if (!high_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "first_bit") {
+                if (!first_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "bit_23") {
-        if (!bit_23().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "low_bit") {
-        if (!low_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1521,8 +1724,8 @@ class GenericFooView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           high_bit().IsAggregate() || high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1540,8 +1743,8 @@ class GenericFooView final {
                  emboss_reserved_local_field_options.comments() &&
                  !high_bit().IsAggregate() && !high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# high_bit: UNREADABLE\n");
       }
@@ -1551,8 +1754,8 @@ class GenericFooView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           bar().IsAggregate() || bar().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1570,8 +1773,8 @@ class GenericFooView final {
                  emboss_reserved_local_field_options.comments() &&
                  !bar().IsAggregate() && !bar().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# bar: UNREADABLE\n");
       }
@@ -1581,8 +1784,8 @@ class GenericFooView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           first_bit().IsAggregate() || first_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1600,8 +1803,8 @@ class GenericFooView final {
                  emboss_reserved_local_field_options.comments() &&
                  !first_bit().IsAggregate() && !first_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# first_bit: UNREADABLE\n");
       }
@@ -1611,8 +1814,8 @@ class GenericFooView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           bit_23().IsAggregate() || bit_23().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1630,8 +1833,8 @@ class GenericFooView final {
                  emboss_reserved_local_field_options.comments() &&
                  !bit_23().IsAggregate() && !bit_23().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# bit_23: UNREADABLE\n");
       }
@@ -1641,8 +1844,8 @@ class GenericFooView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           low_bit().IsAggregate() || low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1660,8 +1863,8 @@ class GenericFooView final {
                  emboss_reserved_local_field_options.comments() &&
                  !low_bit().IsAggregate() && !low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# low_bit: UNREADABLE\n");
       }
@@ -1669,8 +1872,8 @@ class GenericFooView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1679,6 +1882,56 @@ class GenericFooView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_high_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("high_bit", high_bit());
+    }
+
+    if (has_bar().ValueOr(false)) {
+      emboss_reserved_local_visitor("bar", bar());
+    }
+
+    if (has_first_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("first_bit", first_bit());
+    }
+
+    if (has_bit_23().ValueOr(false)) {
+      emboss_reserved_local_visitor("bit_23", bit_23());
+    }
+
+    if (has_low_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("low_bit", low_bit());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 5; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "high_bit", true, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "bar", true, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "first_bit", true, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "bit_23", true, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "low_bit", true, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  private:
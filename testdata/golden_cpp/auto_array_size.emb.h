@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_AUTO_ARRAY_SIZE_EMB_H_
 #define TESTDATA_AUTO_ARRAY_SIZE_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -49,6 +51,22 @@ namespace Element {
 }  // namespace Element
 
 
+struct EMBOSS_MAY_ALIAS EmbossReservedNativeElement {
+  ::std::uint8_t a;
+  ::std::uint8_t b;
+};
+static_assert(sizeof(EmbossReservedNativeElement) == 2,
+              "EmbossReservedNativeElement does not match the layout of "
+              "Element.");
+static_assert(offsetof(EmbossReservedNativeElement, a) == 0,
+              "EmbossReservedNativeElement::a is not at the same "
+              "offset as Element::a.");
+static_assert(offsetof(EmbossReservedNativeElement, b) == 1,
+              "EmbossReservedNativeElement::b is not at the same "
+              "offset as Element::b.");
+
+
+
 template <class View>
 struct EmbossReservedInternalIsGenericElementView;
 
@@ -232,13 +250,13 @@ class GenericElementView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -247,25 +265,42 @@ class GenericElementView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -288,8 +323,8 @@ class GenericElementView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -307,8 +342,8 @@ class GenericElementView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -318,8 +353,8 @@ class GenericElementView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -337,8 +372,8 @@ class GenericElementView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -346,8 +381,8 @@ class GenericElementView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -356,6 +391,56 @@ class GenericElementView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  using Native = EmbossReservedNativeElement;
+
+  static constexpr bool HasNativeLayout() { return EMBOSS_HAS_MAY_ALIAS; }
+
+  template <class EmbossReservedStorage = Storage>
+  typename ::std::conditional<
+      ::std::is_const<typename ::std::remove_reference<decltype(
+          *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+      const Native *, Native *>::type
+  AsNative() const {
+    static_assert(HasNativeLayout() || sizeof(EmbossReservedStorage) == 0,
+                  "Element does not have a native layout on this system.");
+    EMBOSS_CHECK_GE(backing_.SizeInBytes(), sizeof(Native));
+    EMBOSS_CHECK_POINTER_ALIGNMENT(backing_.data(), alignof(Native), 0);
+    return reinterpret_cast<typename ::std::conditional<
+        ::std::is_const<typename ::std::remove_reference<decltype(
+            *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+        const Native *, Native *>::type>(backing_.data());
+  }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -552,6 +637,7 @@ namespace AutoSize {
 }  // namespace AutoSize
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericAutoSizeView;
 
@@ -839,13 +925,13 @@ class GenericAutoSizeView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -854,49 +940,100 @@ class GenericAutoSizeView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "array_size") {
-        if (!array_size().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "four_byte_array") {
-        if (!four_byte_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "four_struct_array") {
-        if (!four_struct_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "dynamic_byte_array") {
-        if (!dynamic_byte_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "array_size") {
+                if (!array_size().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 15:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_byte_array") {
+                if (!four_byte_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 17:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_struct_array") {
+                if (!four_struct_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 18:
+          switch (emboss_reserved_local_name[0]) {
+            case 'd':
+              if (emboss_reserved_local_name == "dynamic_byte_array") {
+                if (!dynamic_byte_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 20:
+          switch (emboss_reserved_local_name[0]) {
+            case 'd':
+              if (emboss_reserved_local_name == "dynamic_struct_array") {
+                if (!dynamic_struct_array().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "dynamic_struct_array") {
-        if (!dynamic_struct_array().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -919,8 +1056,8 @@ class GenericAutoSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           array_size().IsAggregate() || array_size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -938,8 +1075,8 @@ class GenericAutoSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !array_size().IsAggregate() && !array_size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# array_size: UNREADABLE\n");
       }
@@ -949,8 +1086,8 @@ class GenericAutoSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_byte_array().IsAggregate() || four_byte_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -968,8 +1105,8 @@ class GenericAutoSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_byte_array().IsAggregate() && !four_byte_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_byte_array: UNREADABLE\n");
       }
@@ -979,8 +1116,8 @@ class GenericAutoSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_struct_array().IsAggregate() || four_struct_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -998,8 +1135,8 @@ class GenericAutoSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_struct_array().IsAggregate() && !four_struct_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_struct_array: UNREADABLE\n");
       }
@@ -1009,8 +1146,8 @@ class GenericAutoSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           dynamic_byte_array().IsAggregate() || dynamic_byte_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1028,8 +1165,8 @@ class GenericAutoSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !dynamic_byte_array().IsAggregate() && !dynamic_byte_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# dynamic_byte_array: UNREADABLE\n");
       }
@@ -1039,8 +1176,8 @@ class GenericAutoSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           dynamic_struct_array().IsAggregate() || dynamic_struct_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1058,8 +1195,8 @@ class GenericAutoSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !dynamic_struct_array().IsAggregate() && !dynamic_struct_array().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# dynamic_struct_array: UNREADABLE\n");
       }
@@ -1067,8 +1204,8 @@ class GenericAutoSizeView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1077,6 +1214,56 @@ class GenericAutoSizeView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_array_size().ValueOr(false)) {
+      emboss_reserved_local_visitor("array_size", array_size());
+    }
+
+    if (has_four_byte_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_byte_array", four_byte_array());
+    }
+
+    if (has_four_struct_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_struct_array", four_struct_array());
+    }
+
+    if (has_dynamic_byte_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("dynamic_byte_array", dynamic_byte_array());
+    }
+
+    if (has_dynamic_struct_array().ValueOr(false)) {
+      emboss_reserved_local_visitor("dynamic_struct_array", dynamic_struct_array());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 5; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "array_size", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "four_byte_array", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "four_struct_array", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "dynamic_byte_array", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "dynamic_struct_array", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_BCD_EMB_H_
 #define TESTDATA_BCD_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -75,6 +77,7 @@ namespace EmbossReservedAnonymousField1 {
 }  // namespace EmbossReservedAnonymousField1
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericEmbossReservedAnonymousField1View;
 
@@ -328,13 +331,13 @@ class GenericEmbossReservedAnonymousField1View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -343,41 +346,76 @@ class GenericEmbossReservedAnonymousField1View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "four_bit") {
-        if (!four_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "six_bit") {
-        if (!six_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "ten_bit") {
-        if (!ten_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "six_bit") {
+                if (!six_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "ten_bit") {
+                if (!ten_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_bit") {
+                if (!four_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "twelve_bit") {
+                if (!twelve_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "twelve_bit") {
-        if (!twelve_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -400,8 +438,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_bit().IsAggregate() || four_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -419,8 +457,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_bit().IsAggregate() && !four_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_bit: UNREADABLE\n");
       }
@@ -430,8 +468,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           six_bit().IsAggregate() || six_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -449,8 +487,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !six_bit().IsAggregate() && !six_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# six_bit: UNREADABLE\n");
       }
@@ -460,8 +498,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           ten_bit().IsAggregate() || ten_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -479,8 +517,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !ten_bit().IsAggregate() && !ten_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# ten_bit: UNREADABLE\n");
       }
@@ -490,8 +528,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           twelve_bit().IsAggregate() || twelve_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -509,8 +547,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !twelve_bit().IsAggregate() && !twelve_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# twelve_bit: UNREADABLE\n");
       }
@@ -518,8 +556,8 @@ class GenericEmbossReservedAnonymousField1View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -528,6 +566,50 @@ class GenericEmbossReservedAnonymousField1View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_four_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_bit", four_bit());
+    }
+
+    if (has_six_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("six_bit", six_bit());
+    }
+
+    if (has_ten_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("ten_bit", ten_bit());
+    }
+
+    if (has_twelve_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("twelve_bit", twelve_bit());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 4; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "four_bit", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "six_bit", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "ten_bit", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "twelve_bit", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -732,6 +814,7 @@ MakeAlignedEmbossReservedAnonymousField1View(
 }  // namespace BcdSizes
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericBcdSizesView;
 
@@ -1176,13 +1259,13 @@ class GenericBcdSizesView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1191,105 +1274,157 @@ class GenericBcdSizesView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "one_byte") {
-        if (!one_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "two_byte") {
-        if (!two_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "three_byte") {
-        if (!three_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "four_byte") {
-        if (!four_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "five_byte") {
-        if (!five_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "six_byte") {
-        if (!six_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "seven_byte") {
-        if (!seven_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "eight_byte") {
-        if (!eight_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "four_bit") {
-        if (!four_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "six_bit") {
-        if (!six_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "ten_bit") {
-        if (!ten_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "six_bit") {
+                if (!six_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "ten_bit") {
+                if (!ten_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_bit") {
+                if (!four_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'o':
+              if (emboss_reserved_local_name == "one_byte") {
+                if (!one_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 's':
+              if (emboss_reserved_local_name == "six_byte") {
+                if (!six_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "two_byte") {
+                if (!two_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_byte") {
+                if (!four_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "five_byte") {
+                if (!five_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'e':
+              if (emboss_reserved_local_name == "eight_byte") {
+                if (!eight_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 's':
+              if (emboss_reserved_local_name == "seven_byte") {
+                if (!seven_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "three_byte") {
+                if (!three_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "twelve_bit") {
+                if (!twelve_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "twelve_bit") {
-        if (!twelve_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1312,8 +1447,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           one_byte().IsAggregate() || one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1331,8 +1466,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !one_byte().IsAggregate() && !one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# one_byte: UNREADABLE\n");
       }
@@ -1342,8 +1477,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_byte().IsAggregate() || two_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1361,8 +1496,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_byte().IsAggregate() && !two_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_byte: UNREADABLE\n");
       }
@@ -1372,8 +1507,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           three_byte().IsAggregate() || three_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1391,8 +1526,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !three_byte().IsAggregate() && !three_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# three_byte: UNREADABLE\n");
       }
@@ -1402,8 +1537,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_byte().IsAggregate() || four_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1421,8 +1556,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_byte().IsAggregate() && !four_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_byte: UNREADABLE\n");
       }
@@ -1432,8 +1567,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           five_byte().IsAggregate() || five_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1451,8 +1586,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !five_byte().IsAggregate() && !five_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# five_byte: UNREADABLE\n");
       }
@@ -1462,8 +1597,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           six_byte().IsAggregate() || six_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1481,8 +1616,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !six_byte().IsAggregate() && !six_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# six_byte: UNREADABLE\n");
       }
@@ -1492,8 +1627,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           seven_byte().IsAggregate() || seven_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1511,8 +1646,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !seven_byte().IsAggregate() && !seven_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# seven_byte: UNREADABLE\n");
       }
@@ -1522,8 +1657,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           eight_byte().IsAggregate() || eight_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1541,8 +1676,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !eight_byte().IsAggregate() && !eight_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# eight_byte: UNREADABLE\n");
       }
@@ -1552,8 +1687,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_bit().IsAggregate() || four_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1571,8 +1706,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_bit().IsAggregate() && !four_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_bit: UNREADABLE\n");
       }
@@ -1582,8 +1717,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           six_bit().IsAggregate() || six_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1601,8 +1736,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !six_bit().IsAggregate() && !six_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# six_bit: UNREADABLE\n");
       }
@@ -1612,8 +1747,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           ten_bit().IsAggregate() || ten_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1631,8 +1766,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !ten_bit().IsAggregate() && !ten_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# ten_bit: UNREADABLE\n");
       }
@@ -1642,8 +1777,8 @@ class GenericBcdSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           twelve_bit().IsAggregate() || twelve_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1661,8 +1796,8 @@ class GenericBcdSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !twelve_bit().IsAggregate() && !twelve_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# twelve_bit: UNREADABLE\n");
       }
@@ -1670,8 +1805,8 @@ class GenericBcdSizesView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1680,6 +1815,98 @@ class GenericBcdSizesView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_one_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("one_byte", one_byte());
+    }
+
+    if (has_two_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_byte", two_byte());
+    }
+
+    if (has_three_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("three_byte", three_byte());
+    }
+
+    if (has_four_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_byte", four_byte());
+    }
+
+    if (has_five_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("five_byte", five_byte());
+    }
+
+    if (has_six_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("six_byte", six_byte());
+    }
+
+    if (has_seven_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("seven_byte", seven_byte());
+    }
+
+    if (has_eight_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("eight_byte", eight_byte());
+    }
+
+    if (has_four_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_bit", four_bit());
+    }
+
+    if (has_six_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("six_bit", six_bit());
+    }
+
+    if (has_ten_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("ten_bit", ten_bit());
+    }
+
+    if (has_twelve_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("twelve_bit", twelve_bit());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 12; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "one_byte", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "two_byte", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "three_byte", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "four_byte", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "five_byte", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "six_byte", false, false} :
+           emboss_reserved_local_index == 6 ? ::emboss::support::FieldDescriptor{
+               "seven_byte", false, false} :
+           emboss_reserved_local_index == 7 ? ::emboss::support::FieldDescriptor{
+               "eight_byte", false, false} :
+           emboss_reserved_local_index == 8 ? ::emboss::support::FieldDescriptor{
+               "four_bit", true, false} :
+           emboss_reserved_local_index == 9 ? ::emboss::support::FieldDescriptor{
+               "six_bit", true, false} :
+           emboss_reserved_local_index == 10 ? ::emboss::support::FieldDescriptor{
+               "ten_bit", true, false} :
+           emboss_reserved_local_index == 11 ? ::emboss::support::FieldDescriptor{
+               "twelve_bit", true, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1954,6 +2181,7 @@ namespace BcdBigEndian {
 }  // namespace BcdBigEndian
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericBcdBigEndianView;
 
@@ -2102,13 +2330,13 @@ class GenericBcdBigEndianView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2117,17 +2345,32 @@ class GenericBcdBigEndianView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "four_byte") {
-        if (!four_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_byte") {
+                if (!four_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -2150,8 +2393,8 @@ class GenericBcdBigEndianView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_byte().IsAggregate() || four_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2169,8 +2412,8 @@ class GenericBcdBigEndianView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_byte().IsAggregate() && !four_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_byte: UNREADABLE\n");
       }
@@ -2178,8 +2421,8 @@ class GenericBcdBigEndianView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2188,6 +2431,32 @@ class GenericBcdBigEndianView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_four_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_byte", four_byte());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "four_byte", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
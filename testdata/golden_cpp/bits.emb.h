@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_BITS_EMB_H_
 #define TESTDATA_BITS_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -92,6 +94,7 @@ namespace OneByte {
 }  // namespace OneByte
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericOneByteView;
 
@@ -380,13 +383,13 @@ class GenericOneByteView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -395,49 +398,100 @@ class GenericOneByteView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "high_bit") {
-        if (!high_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "less_high_bit") {
-        if (!less_high_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "mid_nibble") {
-        if (!mid_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "less_low_bit") {
-        if (!less_low_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "low_bit") {
+                if (!low_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "high_bit") {
+                if (!high_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'm':
+              if (emboss_reserved_local_name == "mid_nibble") {
+                if (!mid_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 12:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "less_low_bit") {
+                if (!less_low_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 13:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "less_high_bit") {
+                if (!less_high_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "low_bit") {
-        if (!low_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -460,8 +514,8 @@ class GenericOneByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           high_bit().IsAggregate() || high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -479,8 +533,8 @@ class GenericOneByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !high_bit().IsAggregate() && !high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# high_bit: UNREADABLE\n");
       }
@@ -490,8 +544,8 @@ class GenericOneByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           less_high_bit().IsAggregate() || less_high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -509,8 +563,8 @@ class GenericOneByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !less_high_bit().IsAggregate() && !less_high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# less_high_bit: UNREADABLE\n");
       }
@@ -520,8 +574,8 @@ class GenericOneByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           mid_nibble().IsAggregate() || mid_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -539,8 +593,8 @@ class GenericOneByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !mid_nibble().IsAggregate() && !mid_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# mid_nibble: UNREADABLE\n");
       }
@@ -550,8 +604,8 @@ class GenericOneByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           less_low_bit().IsAggregate() || less_low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -569,8 +623,8 @@ class GenericOneByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !less_low_bit().IsAggregate() && !less_low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# less_low_bit: UNREADABLE\n");
       }
@@ -580,8 +634,8 @@ class GenericOneByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           low_bit().IsAggregate() || low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -599,8 +653,8 @@ class GenericOneByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !low_bit().IsAggregate() && !low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# low_bit: UNREADABLE\n");
       }
@@ -608,8 +662,8 @@ class GenericOneByteView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -618,6 +672,56 @@ class GenericOneByteView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_high_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("high_bit", high_bit());
+    }
+
+    if (has_less_high_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("less_high_bit", less_high_bit());
+    }
+
+    if (has_mid_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("mid_nibble", mid_nibble());
+    }
+
+    if (has_less_low_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("less_low_bit", less_low_bit());
+    }
+
+    if (has_low_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("low_bit", low_bit());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 5; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "high_bit", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "less_high_bit", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "mid_nibble", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "less_low_bit", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "low_bit", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -857,6 +961,7 @@ namespace TwoByteWithGaps {
 }  // namespace TwoByteWithGaps
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericTwoByteWithGapsView;
 
@@ -1075,13 +1180,13 @@ class GenericTwoByteWithGapsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1090,33 +1195,66 @@ class GenericTwoByteWithGapsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "high_bit") {
-        if (!high_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "mid_nibble") {
-        if (!mid_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "low_bit") {
+                if (!low_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "high_bit") {
+                if (!high_bit().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'm':
+              if (emboss_reserved_local_name == "mid_nibble") {
+                if (!mid_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "low_bit") {
-        if (!low_bit().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1139,8 +1277,8 @@ class GenericTwoByteWithGapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           high_bit().IsAggregate() || high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1158,8 +1296,8 @@ class GenericTwoByteWithGapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !high_bit().IsAggregate() && !high_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# high_bit: UNREADABLE\n");
       }
@@ -1169,8 +1307,8 @@ class GenericTwoByteWithGapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           mid_nibble().IsAggregate() || mid_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1188,8 +1326,8 @@ class GenericTwoByteWithGapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !mid_nibble().IsAggregate() && !mid_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# mid_nibble: UNREADABLE\n");
       }
@@ -1199,8 +1337,8 @@ class GenericTwoByteWithGapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           low_bit().IsAggregate() || low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1218,8 +1356,8 @@ class GenericTwoByteWithGapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !low_bit().IsAggregate() && !low_bit().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# low_bit: UNREADABLE\n");
       }
@@ -1227,8 +1365,8 @@ class GenericTwoByteWithGapsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1237,6 +1375,44 @@ class GenericTwoByteWithGapsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_high_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("high_bit", high_bit());
+    }
+
+    if (has_mid_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("mid_nibble", mid_nibble());
+    }
+
+    if (has_low_bit().ValueOr(false)) {
+      emboss_reserved_local_visitor("low_bit", low_bit());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "high_bit", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "mid_nibble", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "low_bit", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1433,6 +1609,7 @@ MakeAlignedTwoByteWithGapsView(
 }  // namespace FourByte
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericFourByteView;
 
@@ -1690,13 +1867,13 @@ class GenericFourByteView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1705,49 +1882,93 @@ class GenericFourByteView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "high_nibble") {
-        if (!high_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "one_byte") {
-        if (!one_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "two_byte") {
-        if (!two_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'o':
+              if (emboss_reserved_local_name == "one_byte") {
+                if (!one_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "two_byte") {
+                if (!two_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "low_nibble") {
+                if (!low_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "high_nibble") {
+                if (!high_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 14:
+          switch (emboss_reserved_local_name[0]) {
+            case 'r':
+              if (emboss_reserved_local_name == "raw_low_nibble") {
+                if (!raw_low_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "raw_low_nibble") {
-        if (!raw_low_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "low_nibble") {
-        if (!low_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1770,8 +1991,8 @@ class GenericFourByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           high_nibble().IsAggregate() || high_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1789,8 +2010,8 @@ class GenericFourByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !high_nibble().IsAggregate() && !high_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# high_nibble: UNREADABLE\n");
       }
@@ -1800,8 +2021,8 @@ class GenericFourByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           one_byte().IsAggregate() || one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1819,8 +2040,8 @@ class GenericFourByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !one_byte().IsAggregate() && !one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# one_byte: UNREADABLE\n");
       }
@@ -1830,8 +2051,8 @@ class GenericFourByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_byte().IsAggregate() || two_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1849,8 +2070,8 @@ class GenericFourByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_byte().IsAggregate() && !two_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_byte: UNREADABLE\n");
       }
@@ -1860,8 +2081,8 @@ class GenericFourByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           raw_low_nibble().IsAggregate() || raw_low_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1879,8 +2100,8 @@ class GenericFourByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !raw_low_nibble().IsAggregate() && !raw_low_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# raw_low_nibble: UNREADABLE\n");
       }
@@ -1890,8 +2111,8 @@ class GenericFourByteView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           low_nibble().IsAggregate() || low_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1909,8 +2130,8 @@ class GenericFourByteView final {
                  emboss_reserved_local_field_options.comments() &&
                  !low_nibble().IsAggregate() && !low_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# low_nibble: UNREADABLE\n");
       }
@@ -1918,8 +2139,8 @@ class GenericFourByteView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1928,6 +2149,56 @@ class GenericFourByteView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_high_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("high_nibble", high_nibble());
+    }
+
+    if (has_one_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("one_byte", one_byte());
+    }
+
+    if (has_two_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_byte", two_byte());
+    }
+
+    if (has_raw_low_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("raw_low_nibble", raw_low_nibble());
+    }
+
+    if (has_low_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("low_nibble", low_nibble());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 5; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "high_nibble", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "one_byte", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "two_byte", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "raw_low_nibble", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "low_nibble", true, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -2224,6 +2495,7 @@ namespace ArrayInBits {
 }  // namespace ArrayInBits
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericArrayInBitsView;
 
@@ -2407,13 +2679,13 @@ class GenericArrayInBitsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2422,25 +2694,49 @@ class GenericArrayInBitsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "lone_flag") {
-        if (!lone_flag().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "flags") {
+                if (!flags().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "lone_flag") {
+                if (!lone_flag().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "flags") {
-        if (!flags().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -2463,8 +2759,8 @@ class GenericArrayInBitsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           lone_flag().IsAggregate() || lone_flag().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2482,8 +2778,8 @@ class GenericArrayInBitsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !lone_flag().IsAggregate() && !lone_flag().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# lone_flag: UNREADABLE\n");
       }
@@ -2493,8 +2789,8 @@ class GenericArrayInBitsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           flags().IsAggregate() || flags().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2512,8 +2808,8 @@ class GenericArrayInBitsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !flags().IsAggregate() && !flags().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# flags: UNREADABLE\n");
       }
@@ -2521,8 +2817,8 @@ class GenericArrayInBitsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2531,6 +2827,38 @@ class GenericArrayInBitsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_lone_flag().ValueOr(false)) {
+      emboss_reserved_local_visitor("lone_flag", lone_flag());
+    }
+
+    if (has_flags().ValueOr(false)) {
+      emboss_reserved_local_visitor("flags", flags());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "lone_flag", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "flags", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -2727,6 +3055,7 @@ namespace ArrayInBitsInStruct {
 }  // namespace ArrayInBitsInStruct
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericArrayInBitsInStructView;
 
@@ -2875,13 +3204,13 @@ class GenericArrayInBitsInStructView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2890,17 +3219,32 @@ class GenericArrayInBitsInStructView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "array_in_bits") {
-        if (!array_in_bits().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 13:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "array_in_bits") {
+                if (!array_in_bits().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -2923,8 +3267,8 @@ class GenericArrayInBitsInStructView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           array_in_bits().IsAggregate() || array_in_bits().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2942,8 +3286,8 @@ class GenericArrayInBitsInStructView final {
                  emboss_reserved_local_field_options.comments() &&
                  !array_in_bits().IsAggregate() && !array_in_bits().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# array_in_bits: UNREADABLE\n");
       }
@@ -2951,8 +3295,8 @@ class GenericArrayInBitsInStructView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2961,6 +3305,32 @@ class GenericArrayInBitsInStructView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_array_in_bits().ValueOr(false)) {
+      emboss_reserved_local_visitor("array_in_bits", array_in_bits());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "array_in_bits", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3146,6 +3516,7 @@ namespace StructOfBits {
 }  // namespace StructOfBits
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericStructOfBitsView;
 
@@ -3398,13 +3769,13 @@ class GenericStructOfBitsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -3413,41 +3784,76 @@ class GenericStructOfBitsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "one_byte") {
-        if (!one_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "two_byte") {
-        if (!two_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'o':
+              if (emboss_reserved_local_name == "one_byte") {
+                if (!one_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "two_byte") {
+                if (!two_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_byte") {
+                if (!four_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 12:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "located_byte") {
+                if (!located_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "four_byte") {
-        if (!four_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "located_byte") {
-        if (!located_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -3470,8 +3876,8 @@ class GenericStructOfBitsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           one_byte().IsAggregate() || one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3489,8 +3895,8 @@ class GenericStructOfBitsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !one_byte().IsAggregate() && !one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# one_byte: UNREADABLE\n");
       }
@@ -3500,8 +3906,8 @@ class GenericStructOfBitsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_byte().IsAggregate() || two_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3519,8 +3925,8 @@ class GenericStructOfBitsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_byte().IsAggregate() && !two_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_byte: UNREADABLE\n");
       }
@@ -3530,8 +3936,8 @@ class GenericStructOfBitsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_byte().IsAggregate() || four_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3549,8 +3955,8 @@ class GenericStructOfBitsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_byte().IsAggregate() && !four_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_byte: UNREADABLE\n");
       }
@@ -3560,8 +3966,8 @@ class GenericStructOfBitsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           located_byte().IsAggregate() || located_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3579,8 +3985,8 @@ class GenericStructOfBitsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !located_byte().IsAggregate() && !located_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# located_byte: UNREADABLE\n");
       }
@@ -3588,8 +3994,8 @@ class GenericStructOfBitsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -3598,6 +4004,50 @@ class GenericStructOfBitsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_one_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("one_byte", one_byte());
+    }
+
+    if (has_two_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_byte", two_byte());
+    }
+
+    if (has_four_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_byte", four_byte());
+    }
+
+    if (has_located_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("located_byte", located_byte());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 4; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "one_byte", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "two_byte", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "four_byte", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "located_byte", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3831,6 +4281,7 @@ namespace BitArray {
 }  // namespace BitArray
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericBitArrayView;
 
@@ -3979,13 +4430,13 @@ class GenericBitArrayView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -3994,17 +4445,32 @@ class GenericBitArrayView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "one_byte") {
-        if (!one_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'o':
+              if (emboss_reserved_local_name == "one_byte") {
+                if (!one_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -4027,8 +4493,8 @@ class GenericBitArrayView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           one_byte().IsAggregate() || one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -4046,8 +4512,8 @@ class GenericBitArrayView final {
                  emboss_reserved_local_field_options.comments() &&
                  !one_byte().IsAggregate() && !one_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# one_byte: UNREADABLE\n");
       }
@@ -4055,8 +4521,8 @@ class GenericBitArrayView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -4065,6 +4531,32 @@ class GenericBitArrayView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_one_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("one_byte", one_byte());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "one_byte", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_COMPLEX_OFFSET_EMB_H_
 #define TESTDATA_COMPLEX_OFFSET_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -56,6 +58,18 @@ namespace Length {
 }  // namespace Length
 
 
+struct EMBOSS_MAY_ALIAS EmbossReservedNativeLength {
+  ::std::uint8_t length;
+};
+static_assert(sizeof(EmbossReservedNativeLength) == 1,
+              "EmbossReservedNativeLength does not match the layout of "
+              "Length.");
+static_assert(offsetof(EmbossReservedNativeLength, length) == 0,
+              "EmbossReservedNativeLength::length is not at the same "
+              "offset as Length::length.");
+
+
+
 template <class View>
 struct EmbossReservedInternalIsGenericLengthView;
 
@@ -204,13 +218,13 @@ class GenericLengthView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -219,17 +233,32 @@ class GenericLengthView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "length") {
-        if (!length().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "length") {
+                if (!length().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -252,8 +281,8 @@ class GenericLengthView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length().IsAggregate() || length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -271,8 +300,8 @@ class GenericLengthView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length().IsAggregate() && !length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length: UNREADABLE\n");
       }
@@ -280,8 +309,8 @@ class GenericLengthView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -290,6 +319,50 @@ class GenericLengthView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_length().ValueOr(false)) {
+      emboss_reserved_local_visitor("length", length());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "length", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  using Native = EmbossReservedNativeLength;
+
+  static constexpr bool HasNativeLayout() { return EMBOSS_HAS_MAY_ALIAS; }
+
+  template <class EmbossReservedStorage = Storage>
+  typename ::std::conditional<
+      ::std::is_const<typename ::std::remove_reference<decltype(
+          *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+      const Native *, Native *>::type
+  AsNative() const {
+    static_assert(HasNativeLayout() || sizeof(EmbossReservedStorage) == 0,
+                  "Length does not have a native layout on this system.");
+    EMBOSS_CHECK_GE(backing_.SizeInBytes(), sizeof(Native));
+    EMBOSS_CHECK_POINTER_ALIGNMENT(backing_.data(), alignof(Native), 0);
+    return reinterpret_cast<typename ::std::conditional<
+        ::std::is_const<typename ::std::remove_reference<decltype(
+            *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+        const Native *, Native *>::type>(backing_.data());
+  }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -475,6 +548,7 @@ namespace Data {
 }  // namespace Data
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericDataView;
 
@@ -657,13 +731,13 @@ class GenericDataView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -672,25 +746,49 @@ class GenericDataView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "length") {
-        if (!length().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 'd':
+              if (emboss_reserved_local_name == "data") {
+                if (!data().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "length") {
+                if (!length().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "data") {
-        if (!data().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -713,8 +811,8 @@ class GenericDataView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length().IsAggregate() || length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -732,8 +830,8 @@ class GenericDataView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length().IsAggregate() && !length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length: UNREADABLE\n");
       }
@@ -743,8 +841,8 @@ class GenericDataView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data().IsAggregate() || data().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -762,8 +860,8 @@ class GenericDataView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data().IsAggregate() && !data().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data: UNREADABLE\n");
       }
@@ -771,8 +869,8 @@ class GenericDataView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -781,6 +879,38 @@ class GenericDataView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_length().ValueOr(false)) {
+      emboss_reserved_local_visitor("length", length());
+    }
+
+    if (has_data().ValueOr(false)) {
+      emboss_reserved_local_visitor("data", data());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "length", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "data", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1022,6 +1152,7 @@ namespace PackedFields {
 }  // namespace PackedFields
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericPackedFieldsView;
 
@@ -1574,13 +1705,13 @@ class GenericPackedFieldsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1589,105 +1720,119 @@ class GenericPackedFieldsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "length1") {
-        if (!length1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "data1") {
-        if (!data1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "length2") {
-        if (!length2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "data2") {
-        if (!data2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "length3") {
-        if (!length3().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "data3") {
-        if (!data3().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "length4") {
-        if (!length4().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "data4") {
-        if (!data4().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "length5") {
-        if (!length5().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "data5") {
-        if (!data5().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'd':
+              if (emboss_reserved_local_name == "data1") {
+                if (!data1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "data2") {
+                if (!data2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "data3") {
+                if (!data3().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "data4") {
+                if (!data4().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "data5") {
+                if (!data5().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "data6") {
+                if (!data6().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "length1") {
+                if (!length1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "length2") {
+                if (!length2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "length3") {
+                if (!length3().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "length4") {
+                if (!length4().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "length5") {
+                if (!length5().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "length6") {
+                if (!length6().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "length6") {
-        if (!length6().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "data6") {
-        if (!data6().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1710,8 +1855,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length1().IsAggregate() || length1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1729,8 +1874,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length1().IsAggregate() && !length1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length1: UNREADABLE\n");
       }
@@ -1740,8 +1885,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data1().IsAggregate() || data1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1759,8 +1904,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data1().IsAggregate() && !data1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data1: UNREADABLE\n");
       }
@@ -1770,16 +1915,16 @@ class GenericPackedFieldsView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           o1().IsAggregate() || o1().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# o1: ");
         o1().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# o1: UNREADABLE\n");
       }
@@ -1789,8 +1934,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length2().IsAggregate() || length2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1808,8 +1953,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length2().IsAggregate() && !length2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length2: UNREADABLE\n");
       }
@@ -1819,8 +1964,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data2().IsAggregate() || data2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1838,8 +1983,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data2().IsAggregate() && !data2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data2: UNREADABLE\n");
       }
@@ -1849,16 +1994,16 @@ class GenericPackedFieldsView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           o2().IsAggregate() || o2().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# o2: ");
         o2().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# o2: UNREADABLE\n");
       }
@@ -1868,8 +2013,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length3().IsAggregate() || length3().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1887,8 +2032,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length3().IsAggregate() && !length3().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length3: UNREADABLE\n");
       }
@@ -1898,8 +2043,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data3().IsAggregate() || data3().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1917,8 +2062,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data3().IsAggregate() && !data3().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data3: UNREADABLE\n");
       }
@@ -1928,16 +2073,16 @@ class GenericPackedFieldsView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           o3().IsAggregate() || o3().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# o3: ");
         o3().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# o3: UNREADABLE\n");
       }
@@ -1947,8 +2092,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length4().IsAggregate() || length4().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1966,8 +2111,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length4().IsAggregate() && !length4().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length4: UNREADABLE\n");
       }
@@ -1977,8 +2122,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data4().IsAggregate() || data4().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1996,8 +2141,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data4().IsAggregate() && !data4().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data4: UNREADABLE\n");
       }
@@ -2007,16 +2152,16 @@ class GenericPackedFieldsView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           o4().IsAggregate() || o4().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# o4: ");
         o4().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# o4: UNREADABLE\n");
       }
@@ -2026,8 +2171,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length5().IsAggregate() || length5().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2045,8 +2190,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length5().IsAggregate() && !length5().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length5: UNREADABLE\n");
       }
@@ -2056,8 +2201,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data5().IsAggregate() || data5().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2075,8 +2220,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data5().IsAggregate() && !data5().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data5: UNREADABLE\n");
       }
@@ -2086,16 +2231,16 @@ class GenericPackedFieldsView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           o5().IsAggregate() || o5().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# o5: ");
         o5().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# o5: UNREADABLE\n");
       }
@@ -2105,8 +2250,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           length6().IsAggregate() || length6().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2124,8 +2269,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !length6().IsAggregate() && !length6().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# length6: UNREADABLE\n");
       }
@@ -2135,8 +2280,8 @@ class GenericPackedFieldsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data6().IsAggregate() || data6().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2154,8 +2299,8 @@ class GenericPackedFieldsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data6().IsAggregate() && !data6().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data6: UNREADABLE\n");
       }
@@ -2163,8 +2308,8 @@ class GenericPackedFieldsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2173,6 +2318,128 @@ class GenericPackedFieldsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_length1().ValueOr(false)) {
+      emboss_reserved_local_visitor("length1", length1());
+    }
+
+    if (has_data1().ValueOr(false)) {
+      emboss_reserved_local_visitor("data1", data1());
+    }
+
+    if (has_o1().ValueOr(false)) {
+      emboss_reserved_local_visitor("o1", o1());
+    }
+
+    if (has_length2().ValueOr(false)) {
+      emboss_reserved_local_visitor("length2", length2());
+    }
+
+    if (has_data2().ValueOr(false)) {
+      emboss_reserved_local_visitor("data2", data2());
+    }
+
+    if (has_o2().ValueOr(false)) {
+      emboss_reserved_local_visitor("o2", o2());
+    }
+
+    if (has_length3().ValueOr(false)) {
+      emboss_reserved_local_visitor("length3", length3());
+    }
+
+    if (has_data3().ValueOr(false)) {
+      emboss_reserved_local_visitor("data3", data3());
+    }
+
+    if (has_o3().ValueOr(false)) {
+      emboss_reserved_local_visitor("o3", o3());
+    }
+
+    if (has_length4().ValueOr(false)) {
+      emboss_reserved_local_visitor("length4", length4());
+    }
+
+    if (has_data4().ValueOr(false)) {
+      emboss_reserved_local_visitor("data4", data4());
+    }
+
+    if (has_o4().ValueOr(false)) {
+      emboss_reserved_local_visitor("o4", o4());
+    }
+
+    if (has_length5().ValueOr(false)) {
+      emboss_reserved_local_visitor("length5", length5());
+    }
+
+    if (has_data5().ValueOr(false)) {
+      emboss_reserved_local_visitor("data5", data5());
+    }
+
+    if (has_o5().ValueOr(false)) {
+      emboss_reserved_local_visitor("o5", o5());
+    }
+
+    if (has_length6().ValueOr(false)) {
+      emboss_reserved_local_visitor("length6", length6());
+    }
+
+    if (has_data6().ValueOr(false)) {
+      emboss_reserved_local_visitor("data6", data6());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 17; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "length1", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "data1", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "o1", true, true} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "length2", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "data2", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "o2", true, true} :
+           emboss_reserved_local_index == 6 ? ::emboss::support::FieldDescriptor{
+               "length3", false, false} :
+           emboss_reserved_local_index == 7 ? ::emboss::support::FieldDescriptor{
+               "data3", false, false} :
+           emboss_reserved_local_index == 8 ? ::emboss::support::FieldDescriptor{
+               "o3", true, true} :
+           emboss_reserved_local_index == 9 ? ::emboss::support::FieldDescriptor{
+               "length4", false, false} :
+           emboss_reserved_local_index == 10 ? ::emboss::support::FieldDescriptor{
+               "data4", false, false} :
+           emboss_reserved_local_index == 11 ? ::emboss::support::FieldDescriptor{
+               "o4", true, true} :
+           emboss_reserved_local_index == 12 ? ::emboss::support::FieldDescriptor{
+               "length5", false, false} :
+           emboss_reserved_local_index == 13 ? ::emboss::support::FieldDescriptor{
+               "data5", false, false} :
+           emboss_reserved_local_index == 14 ? ::emboss::support::FieldDescriptor{
+               "o5", true, true} :
+           emboss_reserved_local_index == 15 ? ::emboss::support::FieldDescriptor{
+               "length6", false, false} :
+           emboss_reserved_local_index == 16 ? ::emboss::support::FieldDescriptor{
+               "data6", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_COMPLEX_STRUCTURE_EMB_H_
 #define TESTDATA_COMPLEX_STRUCTURE_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -65,6 +67,7 @@ namespace RegisterLayout {
 }  // namespace RegisterLayout
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericRegisterLayoutView;
 
@@ -283,13 +286,13 @@ class GenericRegisterLayoutView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -298,33 +301,52 @@ class GenericRegisterLayoutView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "x") {
-        if (!x().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "l") {
-        if (!l().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "h") {
+                if (!h().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'l':
+              if (emboss_reserved_local_name == "l") {
+                if (!l().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'x':
+              if (emboss_reserved_local_name == "x") {
+                if (!x().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "h") {
-        if (!h().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -347,8 +369,8 @@ class GenericRegisterLayoutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           x().IsAggregate() || x().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -366,8 +388,8 @@ class GenericRegisterLayoutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !x().IsAggregate() && !x().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# x: UNREADABLE\n");
       }
@@ -377,8 +399,8 @@ class GenericRegisterLayoutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           l().IsAggregate() || l().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -396,8 +418,8 @@ class GenericRegisterLayoutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !l().IsAggregate() && !l().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# l: UNREADABLE\n");
       }
@@ -407,8 +429,8 @@ class GenericRegisterLayoutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           h().IsAggregate() || h().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -426,8 +448,8 @@ class GenericRegisterLayoutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !h().IsAggregate() && !h().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# h: UNREADABLE\n");
       }
@@ -435,8 +457,8 @@ class GenericRegisterLayoutView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -445,6 +467,44 @@ class GenericRegisterLayoutView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_x().ValueOr(false)) {
+      emboss_reserved_local_visitor("x", x());
+    }
+
+    if (has_l().ValueOr(false)) {
+      emboss_reserved_local_visitor("l", l());
+    }
+
+    if (has_h().ValueOr(false)) {
+      emboss_reserved_local_visitor("h", h());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "x", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "l", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "h", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -645,6 +705,7 @@ namespace ArrayElement {
 }  // namespace ArrayElement
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericArrayElementView;
 
@@ -793,13 +854,13 @@ class GenericArrayElementView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -808,17 +869,32 @@ class GenericArrayElementView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -841,8 +917,8 @@ class GenericArrayElementView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -860,8 +936,8 @@ class GenericArrayElementView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -869,8 +945,8 @@ class GenericArrayElementView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -879,6 +955,32 @@ class GenericArrayElementView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1084,6 +1186,7 @@ namespace EmbossReservedAnonymousField1 {
 }  // namespace EmbossReservedAnonymousField1
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericEmbossReservedAnonymousField1View;
 
@@ -1337,13 +1440,13 @@ class GenericEmbossReservedAnonymousField1View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1352,41 +1455,62 @@ class GenericEmbossReservedAnonymousField1View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a0") {
-        if (!a0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "s0") {
-        if (!s0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "l0") {
-        if (!l0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 2:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a0") {
+                if (!a0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'h':
+              if (emboss_reserved_local_name == "h0") {
+                if (!h0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'l':
+              if (emboss_reserved_local_name == "l0") {
+                if (!l0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 's':
+              if (emboss_reserved_local_name == "s0") {
+                if (!s0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "h0") {
-        if (!h0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1409,8 +1533,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a0().IsAggregate() || a0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1428,8 +1552,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !a0().IsAggregate() && !a0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a0: UNREADABLE\n");
       }
@@ -1439,8 +1563,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           s0().IsAggregate() || s0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1458,8 +1582,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !s0().IsAggregate() && !s0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# s0: UNREADABLE\n");
       }
@@ -1469,8 +1593,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           l0().IsAggregate() || l0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1488,8 +1612,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !l0().IsAggregate() && !l0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# l0: UNREADABLE\n");
       }
@@ -1499,8 +1623,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           h0().IsAggregate() || h0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1518,8 +1642,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !h0().IsAggregate() && !h0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# h0: UNREADABLE\n");
       }
@@ -1527,8 +1651,8 @@ class GenericEmbossReservedAnonymousField1View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1537,6 +1661,50 @@ class GenericEmbossReservedAnonymousField1View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a0().ValueOr(false)) {
+      emboss_reserved_local_visitor("a0", a0());
+    }
+
+    if (has_s0().ValueOr(false)) {
+      emboss_reserved_local_visitor("s0", s0());
+    }
+
+    if (has_l0().ValueOr(false)) {
+      emboss_reserved_local_visitor("l0", l0());
+    }
+
+    if (has_h0().ValueOr(false)) {
+      emboss_reserved_local_visitor("h0", h0());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 4; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a0", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "s0", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "l0", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "h0", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1741,6 +1909,7 @@ MakeAlignedEmbossReservedAnonymousField1View(
 }  // namespace Complex
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericComplexView;
 
@@ -2324,13 +2493,13 @@ class GenericComplexView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2339,137 +2508,174 @@ class GenericComplexView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "s") {
-        if (!s().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "u") {
-        if (!u().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "i") {
-        if (!i().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a0") {
-        if (!a0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "s0") {
-        if (!s0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "l0") {
-        if (!l0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "h0") {
-        if (!h0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "e1") {
-        if (!e1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "e2") {
-        if (!e2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b2") {
-        if (!b2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "e3") {
-        if (!e3().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "e4") {
-        if (!e4().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "e5") {
-        if (!e5().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'i':
+              if (emboss_reserved_local_name == "i") {
+                if (!i().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 's':
+              if (emboss_reserved_local_name == "s") {
+                if (!s().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'u':
+              if (emboss_reserved_local_name == "u") {
+                if (!u().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 2:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a0") {
+                if (!a0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b2") {
+                if (!b2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'e':
+              if (emboss_reserved_local_name == "e1") {
+                if (!e1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "e2") {
+                if (!e2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "e3") {
+                if (!e3().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "e4") {
+                if (!e4().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "e5") {
+                if (!e5().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "e0") {
+                if (!e0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'h':
+              if (emboss_reserved_local_name == "h0") {
+                if (!h0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'l':
+              if (emboss_reserved_local_name == "l0") {
+                if (!l0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 's':
+              if (emboss_reserved_local_name == "s0") {
+                if (!s0().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "e0") {
-        if (!e0().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -2492,8 +2698,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           s().IsAggregate() || s().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2511,8 +2717,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !s().IsAggregate() && !s().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# s: UNREADABLE\n");
       }
@@ -2522,8 +2728,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           u().IsAggregate() || u().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2541,8 +2747,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !u().IsAggregate() && !u().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# u: UNREADABLE\n");
       }
@@ -2552,8 +2758,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           i().IsAggregate() || i().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2571,8 +2777,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !i().IsAggregate() && !i().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# i: UNREADABLE\n");
       }
@@ -2582,8 +2788,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2601,8 +2807,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -2612,8 +2818,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2631,8 +2837,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -2642,8 +2848,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a0().IsAggregate() || a0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2661,8 +2867,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a0().IsAggregate() && !a0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a0: UNREADABLE\n");
       }
@@ -2672,8 +2878,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           s0().IsAggregate() || s0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2691,8 +2897,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !s0().IsAggregate() && !s0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# s0: UNREADABLE\n");
       }
@@ -2702,8 +2908,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           l0().IsAggregate() || l0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2721,8 +2927,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !l0().IsAggregate() && !l0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# l0: UNREADABLE\n");
       }
@@ -2732,8 +2938,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           h0().IsAggregate() || h0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2751,8 +2957,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !h0().IsAggregate() && !h0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# h0: UNREADABLE\n");
       }
@@ -2762,8 +2968,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           e1().IsAggregate() || e1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2781,8 +2987,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !e1().IsAggregate() && !e1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# e1: UNREADABLE\n");
       }
@@ -2792,8 +2998,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           e2().IsAggregate() || e2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2811,8 +3017,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !e2().IsAggregate() && !e2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# e2: UNREADABLE\n");
       }
@@ -2822,8 +3028,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b2().IsAggregate() || b2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2841,8 +3047,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b2().IsAggregate() && !b2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b2: UNREADABLE\n");
       }
@@ -2852,8 +3058,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           e3().IsAggregate() || e3().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2871,8 +3077,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !e3().IsAggregate() && !e3().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# e3: UNREADABLE\n");
       }
@@ -2882,8 +3088,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           e4().IsAggregate() || e4().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2901,8 +3107,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !e4().IsAggregate() && !e4().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# e4: UNREADABLE\n");
       }
@@ -2912,8 +3118,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           e5().IsAggregate() || e5().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2931,8 +3137,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !e5().IsAggregate() && !e5().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# e5: UNREADABLE\n");
       }
@@ -2942,8 +3148,8 @@ class GenericComplexView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           e0().IsAggregate() || e0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2961,8 +3167,8 @@ class GenericComplexView final {
                  emboss_reserved_local_field_options.comments() &&
                  !e0().IsAggregate() && !e0().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# e0: UNREADABLE\n");
       }
@@ -2970,8 +3176,8 @@ class GenericComplexView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2980,6 +3186,122 @@ class GenericComplexView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_s().ValueOr(false)) {
+      emboss_reserved_local_visitor("s", s());
+    }
+
+    if (has_u().ValueOr(false)) {
+      emboss_reserved_local_visitor("u", u());
+    }
+
+    if (has_i().ValueOr(false)) {
+      emboss_reserved_local_visitor("i", i());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_a0().ValueOr(false)) {
+      emboss_reserved_local_visitor("a0", a0());
+    }
+
+    if (has_s0().ValueOr(false)) {
+      emboss_reserved_local_visitor("s0", s0());
+    }
+
+    if (has_l0().ValueOr(false)) {
+      emboss_reserved_local_visitor("l0", l0());
+    }
+
+    if (has_h0().ValueOr(false)) {
+      emboss_reserved_local_visitor("h0", h0());
+    }
+
+    if (has_e1().ValueOr(false)) {
+      emboss_reserved_local_visitor("e1", e1());
+    }
+
+    if (has_e2().ValueOr(false)) {
+      emboss_reserved_local_visitor("e2", e2());
+    }
+
+    if (has_b2().ValueOr(false)) {
+      emboss_reserved_local_visitor("b2", b2());
+    }
+
+    if (has_e3().ValueOr(false)) {
+      emboss_reserved_local_visitor("e3", e3());
+    }
+
+    if (has_e4().ValueOr(false)) {
+      emboss_reserved_local_visitor("e4", e4());
+    }
+
+    if (has_e5().ValueOr(false)) {
+      emboss_reserved_local_visitor("e5", e5());
+    }
+
+    if (has_e0().ValueOr(false)) {
+      emboss_reserved_local_visitor("e0", e0());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 16; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "s", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "u", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "i", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "a0", true, false} :
+           emboss_reserved_local_index == 6 ? ::emboss::support::FieldDescriptor{
+               "s0", true, false} :
+           emboss_reserved_local_index == 7 ? ::emboss::support::FieldDescriptor{
+               "l0", true, false} :
+           emboss_reserved_local_index == 8 ? ::emboss::support::FieldDescriptor{
+               "h0", true, false} :
+           emboss_reserved_local_index == 9 ? ::emboss::support::FieldDescriptor{
+               "e1", false, false} :
+           emboss_reserved_local_index == 10 ? ::emboss::support::FieldDescriptor{
+               "e2", false, false} :
+           emboss_reserved_local_index == 11 ? ::emboss::support::FieldDescriptor{
+               "b2", false, false} :
+           emboss_reserved_local_index == 12 ? ::emboss::support::FieldDescriptor{
+               "e3", false, false} :
+           emboss_reserved_local_index == 13 ? ::emboss::support::FieldDescriptor{
+               "e4", false, false} :
+           emboss_reserved_local_index == 14 ? ::emboss::support::FieldDescriptor{
+               "e5", false, false} :
+           emboss_reserved_local_index == 15 ? ::emboss::support::FieldDescriptor{
+               "e0", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_DYNAMIC_SIZE_EMB_H_
 #define TESTDATA_DYNAMIC_SIZE_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -31,6 +33,8 @@ namespace Message {
 template <class Storage>
 class GenericMessageView;
 
+class EmbossReservedBuilderMessage;
+
 namespace Image {
 
 }  // namespace Image
@@ -39,6 +43,8 @@ namespace Image {
 template <class Storage>
 class GenericImageView;
 
+class EmbossReservedBuilderImage;
+
 namespace TwoRegions {
 
 }  // namespace TwoRegions
@@ -124,6 +130,7 @@ namespace Message {
 }  // namespace Message
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericMessageView;
 
@@ -411,13 +418,13 @@ class GenericMessageView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -426,49 +433,93 @@ class GenericMessageView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "header_length") {
-        if (!header_length().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "message_length") {
-        if (!message_length().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "padding") {
-        if (!padding().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "message") {
-        if (!message().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'c':
+              if (emboss_reserved_local_name == "crc32") {
+                if (!crc32().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'm':
+              if (emboss_reserved_local_name == "message") {
+                if (!message().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'p':
+              if (emboss_reserved_local_name == "padding") {
+                if (!padding().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 13:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "header_length") {
+                if (!header_length().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 14:
+          switch (emboss_reserved_local_name[0]) {
+            case 'm':
+              if (emboss_reserved_local_name == "message_length") {
+                if (!message_length().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "crc32") {
-        if (!crc32().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -491,8 +542,8 @@ class GenericMessageView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           header_length().IsAggregate() || header_length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -510,8 +561,8 @@ class GenericMessageView final {
                  emboss_reserved_local_field_options.comments() &&
                  !header_length().IsAggregate() && !header_length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# header_length: UNREADABLE\n");
       }
@@ -521,8 +572,8 @@ class GenericMessageView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           message_length().IsAggregate() || message_length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -540,8 +591,8 @@ class GenericMessageView final {
                  emboss_reserved_local_field_options.comments() &&
                  !message_length().IsAggregate() && !message_length().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# message_length: UNREADABLE\n");
       }
@@ -551,8 +602,8 @@ class GenericMessageView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           padding().IsAggregate() || padding().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -570,8 +621,8 @@ class GenericMessageView final {
                  emboss_reserved_local_field_options.comments() &&
                  !padding().IsAggregate() && !padding().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# padding: UNREADABLE\n");
       }
@@ -581,8 +632,8 @@ class GenericMessageView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           message().IsAggregate() || message().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -600,8 +651,8 @@ class GenericMessageView final {
                  emboss_reserved_local_field_options.comments() &&
                  !message().IsAggregate() && !message().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# message: UNREADABLE\n");
       }
@@ -611,8 +662,8 @@ class GenericMessageView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           crc32().IsAggregate() || crc32().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -630,8 +681,8 @@ class GenericMessageView final {
                  emboss_reserved_local_field_options.comments() &&
                  !crc32().IsAggregate() && !crc32().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# crc32: UNREADABLE\n");
       }
@@ -639,8 +690,8 @@ class GenericMessageView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -649,6 +700,57 @@ class GenericMessageView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_header_length().ValueOr(false)) {
+      emboss_reserved_local_visitor("header_length", header_length());
+    }
+
+    if (has_message_length().ValueOr(false)) {
+      emboss_reserved_local_visitor("message_length", message_length());
+    }
+
+    if (has_padding().ValueOr(false)) {
+      emboss_reserved_local_visitor("padding", padding());
+    }
+
+    if (has_message().ValueOr(false)) {
+      emboss_reserved_local_visitor("message", message());
+    }
+
+    if (has_crc32().ValueOr(false)) {
+      emboss_reserved_local_visitor("crc32", crc32());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 5; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "header_length", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "message_length", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "padding", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "message", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "crc32", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+  using Builder = EmbossReservedBuilderMessage;
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -904,6 +1006,83 @@ MakeAlignedMessageView(
       emboss_reserved_local_size);
 }
 
+class EmbossReservedBuilderMessage final {
+ public:
+  explicit EmbossReservedBuilderMessage(
+      ::std::vector</**/ ::std::uint8_t> *emboss_reserved_local_output)
+      : output_(emboss_reserved_local_output),
+        start_(emboss_reserved_local_output->size()) {
+    output_->resize(start_ + 2);
+  }
+  EmbossReservedBuilderMessage(const EmbossReservedBuilderMessage &) = delete;
+  EmbossReservedBuilderMessage &operator=(
+      const EmbossReservedBuilderMessage &) = delete;
+
+  decltype(::std::declval<MessageWriter>().padding()) append_padding(
+      ::std::size_t emboss_reserved_local_element_count) {
+    EMBOSS_CHECK_EQ(next_field_, 0);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    padding_size_in_bytes_ = emboss_reserved_local_element_count * 1;
+    output_->resize(emboss_reserved_local_offset +
+                    padding_size_in_bytes_);
+    return decltype(::std::declval<MessageWriter>().padding())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset,
+            padding_size_in_bytes_});
+  }
+
+  decltype(::std::declval<MessageWriter>().message()) append_message(
+      ::std::size_t emboss_reserved_local_element_count) {
+    EMBOSS_CHECK_EQ(next_field_, 1);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    message_size_in_bytes_ = emboss_reserved_local_element_count * 1;
+    output_->resize(emboss_reserved_local_offset +
+                    message_size_in_bytes_);
+    return decltype(::std::declval<MessageWriter>().message())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset,
+            message_size_in_bytes_});
+  }
+
+  decltype(::std::declval<MessageWriter>().crc32()) append_crc32() {
+    EMBOSS_CHECK_EQ(next_field_, 2);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    output_->resize(emboss_reserved_local_offset + 4);
+    return decltype(::std::declval<MessageWriter>().crc32())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset, 4});
+  }
+
+  ::std::size_t Finish() {
+    EMBOSS_CHECK_EQ(next_field_, 3);
+    if (!decltype(::std::declval<MessageWriter>().header_length())(
+             ::emboss::support::ReadWriteContiguousBuffer{
+                 output_->data() + start_ + 0, 1})
+             .TryToWrite((static_cast</**/ ::std::int64_t>(padding_size_in_bytes_) + 2))) {
+      return 0;
+    }
+    if (!decltype(::std::declval<MessageWriter>().message_length())(
+             ::emboss::support::ReadWriteContiguousBuffer{
+                 output_->data() + start_ + 1, 1})
+             .TryToWrite(static_cast</**/ ::std::int64_t>(message_size_in_bytes_))) {
+      return 0;
+    }
+
+    return output_->size() - start_;
+  }
+
+ private:
+  ::std::vector</**/ ::std::uint8_t> *output_;
+  ::std::size_t start_;
+  int next_field_ = 0;
+  ::std::size_t padding_size_in_bytes_ = 0;
+  ::std::size_t message_size_in_bytes_ = 0;
+};
+
+
 
 
 
@@ -912,6 +1091,7 @@ namespace Image {
 }  // namespace Image
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericImageView;
 
@@ -1094,13 +1274,13 @@ class GenericImageView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1109,25 +1289,49 @@ class GenericImageView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "size") {
-        if (!size().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "size") {
+                if (!size().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 'p':
+              if (emboss_reserved_local_name == "pixels") {
+                if (!pixels().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "pixels") {
-        if (!pixels().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1150,8 +1354,8 @@ class GenericImageView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           size().IsAggregate() || size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1169,8 +1373,8 @@ class GenericImageView final {
                  emboss_reserved_local_field_options.comments() &&
                  !size().IsAggregate() && !size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# size: UNREADABLE\n");
       }
@@ -1180,8 +1384,8 @@ class GenericImageView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           pixels().IsAggregate() || pixels().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1199,8 +1403,8 @@ class GenericImageView final {
                  emboss_reserved_local_field_options.comments() &&
                  !pixels().IsAggregate() && !pixels().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# pixels: UNREADABLE\n");
       }
@@ -1208,8 +1412,8 @@ class GenericImageView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1218,6 +1422,39 @@ class GenericImageView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_size().ValueOr(false)) {
+      emboss_reserved_local_visitor("size", size());
+    }
+
+    if (has_pixels().ValueOr(false)) {
+      emboss_reserved_local_visitor("pixels", pixels());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "size", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "pixels", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+  using Builder = EmbossReservedBuilderImage;
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1447,6 +1684,52 @@ MakeAlignedImageView(
       emboss_reserved_local_size);
 }
 
+class EmbossReservedBuilderImage final {
+ public:
+  explicit EmbossReservedBuilderImage(
+      ::std::vector</**/ ::std::uint8_t> *emboss_reserved_local_output)
+      : output_(emboss_reserved_local_output),
+        start_(emboss_reserved_local_output->size()) {
+    output_->resize(start_ + 1);
+  }
+  EmbossReservedBuilderImage(const EmbossReservedBuilderImage &) = delete;
+  EmbossReservedBuilderImage &operator=(
+      const EmbossReservedBuilderImage &) = delete;
+
+  decltype(::std::declval<ImageWriter>().pixels()) append_pixels(
+      ::std::size_t emboss_reserved_local_element_count) {
+    EMBOSS_CHECK_EQ(next_field_, 0);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    pixels_size_in_bytes_ = emboss_reserved_local_element_count * 15;
+    output_->resize(emboss_reserved_local_offset +
+                    pixels_size_in_bytes_);
+    return decltype(::std::declval<ImageWriter>().pixels())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset,
+            pixels_size_in_bytes_});
+  }
+
+  ::std::size_t Finish() {
+    EMBOSS_CHECK_EQ(next_field_, 1);
+    if (!decltype(::std::declval<ImageWriter>().size())(
+             ::emboss::support::ReadWriteContiguousBuffer{
+                 output_->data() + start_ + 0, 1})
+             .TryToWrite(static_cast</**/ ::std::int64_t>(pixels_size_in_bytes_) / 15)) {
+      return 0;
+    }
+
+    return output_->size() - start_;
+  }
+
+ private:
+  ::std::vector</**/ ::std::uint8_t> *output_;
+  ::std::size_t start_;
+  int next_field_ = 0;
+  ::std::size_t pixels_size_in_bytes_ = 0;
+};
+
+
 
 
 
@@ -1459,6 +1742,7 @@ namespace TwoRegions {
 }  // namespace TwoRegions
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericTwoRegionsView;
 
@@ -1781,13 +2065,13 @@ class GenericTwoRegionsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1796,57 +2080,100 @@ class GenericTwoRegionsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "b_end") {
-        if (!b_end().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b_start") {
-        if (!b_start().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a_size") {
-        if (!a_size().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a_start") {
-        if (!a_start().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "region_a") {
-        if (!region_a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'b':
+              if (emboss_reserved_local_name == "b_end") {
+                if (!b_end().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a_size") {
+                if (!a_size().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a_start") {
+                if (!a_start().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b_start") {
+                if (!b_start().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'r':
+              if (emboss_reserved_local_name == "region_a") {
+                if (!region_a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "region_b") {
+                if (!region_b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "region_b") {
-        if (!region_b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1869,8 +2196,8 @@ class GenericTwoRegionsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b_end().IsAggregate() || b_end().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1888,8 +2215,8 @@ class GenericTwoRegionsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b_end().IsAggregate() && !b_end().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b_end: UNREADABLE\n");
       }
@@ -1899,8 +2226,8 @@ class GenericTwoRegionsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b_start().IsAggregate() || b_start().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1918,8 +2245,8 @@ class GenericTwoRegionsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b_start().IsAggregate() && !b_start().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b_start: UNREADABLE\n");
       }
@@ -1929,8 +2256,8 @@ class GenericTwoRegionsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a_size().IsAggregate() || a_size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1948,8 +2275,8 @@ class GenericTwoRegionsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a_size().IsAggregate() && !a_size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a_size: UNREADABLE\n");
       }
@@ -1959,8 +2286,8 @@ class GenericTwoRegionsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a_start().IsAggregate() || a_start().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1978,8 +2305,8 @@ class GenericTwoRegionsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a_start().IsAggregate() && !a_start().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a_start: UNREADABLE\n");
       }
@@ -1989,8 +2316,8 @@ class GenericTwoRegionsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           region_a().IsAggregate() || region_a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2008,8 +2335,8 @@ class GenericTwoRegionsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !region_a().IsAggregate() && !region_a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# region_a: UNREADABLE\n");
       }
@@ -2019,8 +2346,8 @@ class GenericTwoRegionsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           region_b().IsAggregate() || region_b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2038,8 +2365,8 @@ class GenericTwoRegionsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !region_b().IsAggregate() && !region_b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# region_b: UNREADABLE\n");
       }
@@ -2047,8 +2374,8 @@ class GenericTwoRegionsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2057,6 +2384,62 @@ class GenericTwoRegionsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_b_end().ValueOr(false)) {
+      emboss_reserved_local_visitor("b_end", b_end());
+    }
+
+    if (has_b_start().ValueOr(false)) {
+      emboss_reserved_local_visitor("b_start", b_start());
+    }
+
+    if (has_a_size().ValueOr(false)) {
+      emboss_reserved_local_visitor("a_size", a_size());
+    }
+
+    if (has_a_start().ValueOr(false)) {
+      emboss_reserved_local_visitor("a_start", a_start());
+    }
+
+    if (has_region_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("region_a", region_a());
+    }
+
+    if (has_region_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("region_b", region_b());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 6; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "b_end", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b_start", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "a_size", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "a_start", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "region_a", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "region_b", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -2331,6 +2714,7 @@ namespace MultipliedSize {
 }  // namespace MultipliedSize
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericMultipliedSizeView;
 
@@ -2548,13 +2932,13 @@ class GenericMultipliedSizeView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2563,33 +2947,66 @@ class GenericMultipliedSizeView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "width") {
-        if (!width().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "height") {
-        if (!height().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 'd':
+              if (emboss_reserved_local_name == "data") {
+                if (!data().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'w':
+              if (emboss_reserved_local_name == "width") {
+                if (!width().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 'h':
+              if (emboss_reserved_local_name == "height") {
+                if (!height().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "data") {
-        if (!data().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -2612,8 +3029,8 @@ class GenericMultipliedSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           width().IsAggregate() || width().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2631,8 +3048,8 @@ class GenericMultipliedSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !width().IsAggregate() && !width().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# width: UNREADABLE\n");
       }
@@ -2642,8 +3059,8 @@ class GenericMultipliedSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           height().IsAggregate() || height().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2661,8 +3078,8 @@ class GenericMultipliedSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !height().IsAggregate() && !height().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# height: UNREADABLE\n");
       }
@@ -2672,8 +3089,8 @@ class GenericMultipliedSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           data().IsAggregate() || data().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2691,8 +3108,8 @@ class GenericMultipliedSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !data().IsAggregate() && !data().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# data: UNREADABLE\n");
       }
@@ -2700,8 +3117,8 @@ class GenericMultipliedSizeView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2710,6 +3127,44 @@ class GenericMultipliedSizeView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_width().ValueOr(false)) {
+      emboss_reserved_local_visitor("width", width());
+    }
+
+    if (has_height().ValueOr(false)) {
+      emboss_reserved_local_visitor("height", height());
+    }
+
+    if (has_data().ValueOr(false)) {
+      emboss_reserved_local_visitor("data", data());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "width", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "height", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "data", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -2956,6 +3411,7 @@ namespace NegativeTermsInSizes {
 }  // namespace NegativeTermsInSizes
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericNegativeTermsInSizesView;
 
@@ -3383,13 +3839,13 @@ class GenericNegativeTermsInSizesView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -3398,81 +3854,134 @@ class GenericNegativeTermsInSizesView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "c") {
-        if (!c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a_minus_b") {
-        if (!a_minus_b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a_minus_2b") {
-        if (!a_minus_2b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a_minus_b_minus_c") {
-        if (!a_minus_b_minus_c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "ten_minus_a") {
-        if (!ten_minus_a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "a_minus_2c") {
-        if (!a_minus_2c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'c':
+              if (emboss_reserved_local_name == "c") {
+                if (!c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a_minus_b") {
+                if (!a_minus_b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "a_minus_c") {
+                if (!a_minus_c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a_minus_2b") {
+                if (!a_minus_2b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "a_minus_2c") {
+                if (!a_minus_2c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "ten_minus_a") {
+                if (!ten_minus_a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 17:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a_minus_b_minus_c") {
+                if (!a_minus_b_minus_c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "a_minus_c") {
-        if (!a_minus_c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -3495,8 +4004,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3514,8 +4023,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -3525,8 +4034,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3544,8 +4053,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -3555,8 +4064,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           c().IsAggregate() || c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3574,8 +4083,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !c().IsAggregate() && !c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# c: UNREADABLE\n");
       }
@@ -3585,8 +4094,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a_minus_b().IsAggregate() || a_minus_b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3604,8 +4113,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a_minus_b().IsAggregate() && !a_minus_b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a_minus_b: UNREADABLE\n");
       }
@@ -3615,8 +4124,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a_minus_2b().IsAggregate() || a_minus_2b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3634,8 +4143,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a_minus_2b().IsAggregate() && !a_minus_2b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a_minus_2b: UNREADABLE\n");
       }
@@ -3645,8 +4154,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a_minus_b_minus_c().IsAggregate() || a_minus_b_minus_c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3664,8 +4173,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a_minus_b_minus_c().IsAggregate() && !a_minus_b_minus_c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a_minus_b_minus_c: UNREADABLE\n");
       }
@@ -3675,8 +4184,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           ten_minus_a().IsAggregate() || ten_minus_a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3694,8 +4203,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !ten_minus_a().IsAggregate() && !ten_minus_a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# ten_minus_a: UNREADABLE\n");
       }
@@ -3705,8 +4214,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a_minus_2c().IsAggregate() || a_minus_2c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3724,8 +4233,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a_minus_2c().IsAggregate() && !a_minus_2c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a_minus_2c: UNREADABLE\n");
       }
@@ -3735,8 +4244,8 @@ class GenericNegativeTermsInSizesView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a_minus_c().IsAggregate() || a_minus_c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -3754,8 +4263,8 @@ class GenericNegativeTermsInSizesView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a_minus_c().IsAggregate() && !a_minus_c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a_minus_c: UNREADABLE\n");
       }
@@ -3763,8 +4272,8 @@ class GenericNegativeTermsInSizesView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -3773,6 +4282,80 @@ class GenericNegativeTermsInSizesView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+    if (has_c().ValueOr(false)) {
+      emboss_reserved_local_visitor("c", c());
+    }
+
+    if (has_a_minus_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("a_minus_b", a_minus_b());
+    }
+
+    if (has_a_minus_2b().ValueOr(false)) {
+      emboss_reserved_local_visitor("a_minus_2b", a_minus_2b());
+    }
+
+    if (has_a_minus_b_minus_c().ValueOr(false)) {
+      emboss_reserved_local_visitor("a_minus_b_minus_c", a_minus_b_minus_c());
+    }
+
+    if (has_ten_minus_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("ten_minus_a", ten_minus_a());
+    }
+
+    if (has_a_minus_2c().ValueOr(false)) {
+      emboss_reserved_local_visitor("a_minus_2c", a_minus_2c());
+    }
+
+    if (has_a_minus_c().ValueOr(false)) {
+      emboss_reserved_local_visitor("a_minus_c", a_minus_c());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 9; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "c", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "a_minus_b", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "a_minus_2b", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "a_minus_b_minus_c", false, false} :
+           emboss_reserved_local_index == 6 ? ::emboss::support::FieldDescriptor{
+               "ten_minus_a", false, false} :
+           emboss_reserved_local_index == 7 ? ::emboss::support::FieldDescriptor{
+               "a_minus_2c", false, false} :
+           emboss_reserved_local_index == 8 ? ::emboss::support::FieldDescriptor{
+               "a_minus_c", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -4104,6 +4687,7 @@ namespace NegativeTermInLocation {
 }  // namespace NegativeTermInLocation
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericNegativeTermInLocationView;
 
@@ -4286,13 +4870,13 @@ class GenericNegativeTermInLocationView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -4301,25 +4885,42 @@ class GenericNegativeTermInLocationView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -4342,8 +4943,8 @@ class GenericNegativeTermInLocationView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -4361,8 +4962,8 @@ class GenericNegativeTermInLocationView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -4372,8 +4973,8 @@ class GenericNegativeTermInLocationView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -4391,8 +4992,8 @@ class GenericNegativeTermInLocationView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -4400,8 +5001,8 @@ class GenericNegativeTermInLocationView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -4410,6 +5011,38 @@ class GenericNegativeTermInLocationView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -4637,6 +5270,7 @@ namespace ChainedSize {
 }  // namespace ChainedSize
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericChainedSizeView;
 
@@ -4889,13 +5523,13 @@ class GenericChainedSizeView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -4904,41 +5538,62 @@ class GenericChainedSizeView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "c") {
-        if (!c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'c':
+              if (emboss_reserved_local_name == "c") {
+                if (!c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'd':
+              if (emboss_reserved_local_name == "d") {
+                if (!d().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "d") {
-        if (!d().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -4961,8 +5616,8 @@ class GenericChainedSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -4980,8 +5635,8 @@ class GenericChainedSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -4991,8 +5646,8 @@ class GenericChainedSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -5010,8 +5665,8 @@ class GenericChainedSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -5021,8 +5676,8 @@ class GenericChainedSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           c().IsAggregate() || c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -5040,8 +5695,8 @@ class GenericChainedSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !c().IsAggregate() && !c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# c: UNREADABLE\n");
       }
@@ -5051,8 +5706,8 @@ class GenericChainedSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           d().IsAggregate() || d().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -5070,8 +5725,8 @@ class GenericChainedSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !d().IsAggregate() && !d().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# d: UNREADABLE\n");
       }
@@ -5079,8 +5734,8 @@ class GenericChainedSizeView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -5089,6 +5744,50 @@ class GenericChainedSizeView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+    if (has_c().ValueOr(false)) {
+      emboss_reserved_local_visitor("c", c());
+    }
+
+    if (has_d().ValueOr(false)) {
+      emboss_reserved_local_visitor("d", d());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 4; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "c", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "d", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -5338,6 +6037,7 @@ namespace FinalFieldOverlaps {
 }  // namespace FinalFieldOverlaps
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericFinalFieldOverlapsView;
 
@@ -5556,13 +6256,13 @@ class GenericFinalFieldOverlapsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -5571,33 +6271,52 @@ class GenericFinalFieldOverlapsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'c':
+              if (emboss_reserved_local_name == "c") {
+                if (!c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "c") {
-        if (!c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -5620,8 +6339,8 @@ class GenericFinalFieldOverlapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -5639,8 +6358,8 @@ class GenericFinalFieldOverlapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -5650,8 +6369,8 @@ class GenericFinalFieldOverlapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -5669,8 +6388,8 @@ class GenericFinalFieldOverlapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -5680,8 +6399,8 @@ class GenericFinalFieldOverlapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           c().IsAggregate() || c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -5699,8 +6418,8 @@ class GenericFinalFieldOverlapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !c().IsAggregate() && !c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# c: UNREADABLE\n");
       }
@@ -5708,8 +6427,8 @@ class GenericFinalFieldOverlapsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -5718,6 +6437,44 @@ class GenericFinalFieldOverlapsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+    if (has_c().ValueOr(false)) {
+      emboss_reserved_local_visitor("c", c());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "c", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -5921,6 +6678,7 @@ namespace DynamicFinalFieldOverlaps {
 }  // namespace DynamicFinalFieldOverlaps
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericDynamicFinalFieldOverlapsView;
 
@@ -6173,13 +6931,13 @@ class GenericDynamicFinalFieldOverlapsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -6188,41 +6946,62 @@ class GenericDynamicFinalFieldOverlapsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "c") {
-        if (!c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'c':
+              if (emboss_reserved_local_name == "c") {
+                if (!c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'd':
+              if (emboss_reserved_local_name == "d") {
+                if (!d().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "d") {
-        if (!d().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -6245,8 +7024,8 @@ class GenericDynamicFinalFieldOverlapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -6264,8 +7043,8 @@ class GenericDynamicFinalFieldOverlapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -6275,8 +7054,8 @@ class GenericDynamicFinalFieldOverlapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -6294,8 +7073,8 @@ class GenericDynamicFinalFieldOverlapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -6305,8 +7084,8 @@ class GenericDynamicFinalFieldOverlapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           c().IsAggregate() || c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -6324,8 +7103,8 @@ class GenericDynamicFinalFieldOverlapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !c().IsAggregate() && !c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# c: UNREADABLE\n");
       }
@@ -6335,8 +7114,8 @@ class GenericDynamicFinalFieldOverlapsView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           d().IsAggregate() || d().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -6354,8 +7133,8 @@ class GenericDynamicFinalFieldOverlapsView final {
                  emboss_reserved_local_field_options.comments() &&
                  !d().IsAggregate() && !d().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# d: UNREADABLE\n");
       }
@@ -6363,8 +7142,8 @@ class GenericDynamicFinalFieldOverlapsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -6373,6 +7152,50 @@ class GenericDynamicFinalFieldOverlapsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+    if (has_c().ValueOr(false)) {
+      emboss_reserved_local_visitor("c", c());
+    }
+
+    if (has_d().ValueOr(false)) {
+      emboss_reserved_local_visitor("d", d());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 4; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "c", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "d", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -6616,6 +7439,7 @@ namespace DynamicFieldDependsOnLaterField {
 }  // namespace DynamicFieldDependsOnLaterField
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericDynamicFieldDependsOnLaterFieldView;
 
@@ -6798,13 +7622,13 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -6813,25 +7637,42 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -6854,8 +7695,8 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -6873,8 +7714,8 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -6884,8 +7725,8 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -6903,8 +7744,8 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -6912,8 +7753,8 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -6922,6 +7763,38 @@ class GenericDynamicFieldDependsOnLaterFieldView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -7148,6 +8021,7 @@ namespace DynamicFieldDoesNotAffectSize {
 }  // namespace DynamicFieldDoesNotAffectSize
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericDynamicFieldDoesNotAffectSizeView;
 
@@ -7366,13 +8240,13 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -7381,33 +8255,52 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "a") {
-        if (!a().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "b") {
-        if (!b().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'a':
+              if (emboss_reserved_local_name == "a") {
+                if (!a().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'b':
+              if (emboss_reserved_local_name == "b") {
+                if (!b().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'c':
+              if (emboss_reserved_local_name == "c") {
+                if (!c().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "c") {
-        if (!c().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -7430,8 +8323,8 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           a().IsAggregate() || a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -7449,8 +8342,8 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !a().IsAggregate() && !a().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# a: UNREADABLE\n");
       }
@@ -7460,8 +8353,8 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           b().IsAggregate() || b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -7479,8 +8372,8 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !b().IsAggregate() && !b().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# b: UNREADABLE\n");
       }
@@ -7490,8 +8383,8 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           c().IsAggregate() || c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -7509,8 +8402,8 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !c().IsAggregate() && !c().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# c: UNREADABLE\n");
       }
@@ -7518,8 +8411,8 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -7528,6 +8421,44 @@ class GenericDynamicFieldDoesNotAffectSizeView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_a().ValueOr(false)) {
+      emboss_reserved_local_visitor("a", a());
+    }
+
+    if (has_b().ValueOr(false)) {
+      emboss_reserved_local_visitor("b", b());
+    }
+
+    if (has_c().ValueOr(false)) {
+      emboss_reserved_local_visitor("c", c());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "a", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "b", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "c", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_ENUM_EMB_H_
 #define TESTDATA_ENUM_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -89,6 +91,7 @@ namespace Constants {
 }  // namespace Constants
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericConstantsView;
 
@@ -212,13 +215,13 @@ class GenericConstantsView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -227,7 +230,7 @@ class GenericConstantsView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
@@ -253,16 +256,16 @@ class GenericConstantsView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           sprocket().IsAggregate() || sprocket().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# sprocket: ");
         sprocket().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# sprocket: UNREADABLE\n");
       }
@@ -272,16 +275,16 @@ class GenericConstantsView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           geegaw().IsAggregate() || geegaw().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# geegaw: ");
         geegaw().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# geegaw: UNREADABLE\n");
       }
@@ -289,8 +292,8 @@ class GenericConstantsView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -299,6 +302,38 @@ class GenericConstantsView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_sprocket().ValueOr(false)) {
+      emboss_reserved_local_visitor("sprocket", sprocket());
+    }
+
+    if (has_geegaw().ValueOr(false)) {
+      emboss_reserved_local_visitor("geegaw", geegaw());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "sprocket", true, true} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "geegaw", true, true} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -557,42 +592,59 @@ class EnumTraits<Kind> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    Kind *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("WIDGET", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Kind *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("WIDGET", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = Kind::WIDGET;
       return true;
     }
 
-    if (!strcmp("SPROCKET", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("SPROCKET", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = Kind::SPROCKET;
       return true;
     }
 
-    if (!strcmp("GEEGAW", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("GEEGAW", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = Kind::GEEGAW;
       return true;
     }
 
-    if (!strcmp("COMPUTED", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("COMPUTED", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = Kind::COMPUTED;
       return true;
     }
 
-    if (!strcmp("LARGE_VALUE", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 11 &&
+        !memcmp("LARGE_VALUE", emboss_reserved_local_name, 11)) {
       *emboss_reserved_local_result = Kind::LARGE_VALUE;
       return true;
     }
 
-    if (!strcmp("DUPLICATE_LARGE_VALUE", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 21 &&
+        !memcmp("DUPLICATE_LARGE_VALUE", emboss_reserved_local_name, 21)) {
       *emboss_reserved_local_result = Kind::DUPLICATE_LARGE_VALUE;
       return true;
     }
 
-    if (!strcmp("MAX32BIT", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("MAX32BIT", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = Kind::MAX32BIT;
       return true;
     }
 
-    if (!strcmp("MAX64BIT", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("MAX64BIT", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = Kind::MAX64BIT;
       return true;
     }
@@ -664,6 +716,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Kind *emboss_reserved_local_result) {
+  return EnumTraits<Kind>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     Kind emboss_reserved_local_value) {
   return EnumTraits<Kind>::TryToGetNameFromEnum(
@@ -694,12 +755,23 @@ class EnumTraits<Signed> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    Signed *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("MIN64BIT", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Signed *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("MIN64BIT", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = Signed::MIN64BIT;
       return true;
     }
 
-    if (!strcmp("MAX64BIT", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("MAX64BIT", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = Signed::MAX64BIT;
       return true;
     }
@@ -751,6 +823,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Signed *emboss_reserved_local_result) {
+  return EnumTraits<Signed>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     Signed emboss_reserved_local_value) {
   return EnumTraits<Signed>::TryToGetNameFromEnum(
@@ -781,12 +862,23 @@ class EnumTraits<OnlyShortValues> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    OnlyShortValues *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      OnlyShortValues *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = OnlyShortValues::ZERO;
       return true;
     }
 
-    if (!strcmp("ONE", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 3 &&
+        !memcmp("ONE", emboss_reserved_local_name, 3)) {
       *emboss_reserved_local_result = OnlyShortValues::ONE;
       return true;
     }
@@ -838,6 +930,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    OnlyShortValues *emboss_reserved_local_result) {
+  return EnumTraits<OnlyShortValues>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     OnlyShortValues emboss_reserved_local_value) {
   return EnumTraits<OnlyShortValues>::TryToGetNameFromEnum(
@@ -868,12 +969,23 @@ class EnumTraits<OnlyShortSignedValues> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    OnlyShortSignedValues *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      OnlyShortSignedValues *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = OnlyShortSignedValues::ZERO;
       return true;
     }
 
-    if (!strcmp("NEGATIVE_ONE", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 12 &&
+        !memcmp("NEGATIVE_ONE", emboss_reserved_local_name, 12)) {
       *emboss_reserved_local_result = OnlyShortSignedValues::NEGATIVE_ONE;
       return true;
     }
@@ -925,6 +1037,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    OnlyShortSignedValues *emboss_reserved_local_result) {
+  return EnumTraits<OnlyShortSignedValues>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     OnlyShortSignedValues emboss_reserved_local_value) {
   return EnumTraits<OnlyShortSignedValues>::TryToGetNameFromEnum(
@@ -954,7 +1075,17 @@ class EnumTraits<ExplicitlySigned> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    ExplicitlySigned *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      ExplicitlySigned *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = ExplicitlySigned::ZERO;
       return true;
     }
@@ -1002,6 +1133,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    ExplicitlySigned *emboss_reserved_local_result) {
+  return EnumTraits<ExplicitlySigned>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     ExplicitlySigned emboss_reserved_local_value) {
   return EnumTraits<ExplicitlySigned>::TryToGetNameFromEnum(
@@ -1031,7 +1171,17 @@ class EnumTraits<ExplicitlySized64> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    ExplicitlySized64 *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      ExplicitlySized64 *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = ExplicitlySized64::ZERO;
       return true;
     }
@@ -1079,6 +1229,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    ExplicitlySized64 *emboss_reserved_local_result) {
+  return EnumTraits<ExplicitlySized64>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     ExplicitlySized64 emboss_reserved_local_value) {
   return EnumTraits<ExplicitlySized64>::TryToGetNameFromEnum(
@@ -1108,7 +1267,17 @@ class EnumTraits<ExplicitlySized32> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    ExplicitlySized32 *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      ExplicitlySized32 *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = ExplicitlySized32::ZERO;
       return true;
     }
@@ -1156,6 +1325,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    ExplicitlySized32 *emboss_reserved_local_result) {
+  return EnumTraits<ExplicitlySized32>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     ExplicitlySized32 emboss_reserved_local_value) {
   return EnumTraits<ExplicitlySized32>::TryToGetNameFromEnum(
@@ -1185,7 +1363,17 @@ class EnumTraits<ExplicitlySized16> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    ExplicitlySized16 *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      ExplicitlySized16 *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = ExplicitlySized16::ZERO;
       return true;
     }
@@ -1233,6 +1421,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    ExplicitlySized16 *emboss_reserved_local_result) {
+  return EnumTraits<ExplicitlySized16>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     ExplicitlySized16 emboss_reserved_local_value) {
   return EnumTraits<ExplicitlySized16>::TryToGetNameFromEnum(
@@ -1262,7 +1459,17 @@ class EnumTraits<ExplicitlySized8> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    ExplicitlySized8 *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      ExplicitlySized8 *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = ExplicitlySized8::ZERO;
       return true;
     }
@@ -1310,6 +1517,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    ExplicitlySized8 *emboss_reserved_local_result) {
+  return EnumTraits<ExplicitlySized8>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     ExplicitlySized8 emboss_reserved_local_value) {
   return EnumTraits<ExplicitlySized8>::TryToGetNameFromEnum(
@@ -1339,7 +1555,17 @@ class EnumTraits<ExplicitlySized12> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    ExplicitlySized12 *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      ExplicitlySized12 *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = ExplicitlySized12::ZERO;
       return true;
     }
@@ -1387,6 +1613,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    ExplicitlySized12 *emboss_reserved_local_result) {
+  return EnumTraits<ExplicitlySized12>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     ExplicitlySized12 emboss_reserved_local_value) {
   return EnumTraits<ExplicitlySized12>::TryToGetNameFromEnum(
@@ -1416,7 +1651,17 @@ class EnumTraits<ExplicitlySizedAndSigned> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    ExplicitlySizedAndSigned *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("ZERO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      ExplicitlySizedAndSigned *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 4 &&
+        !memcmp("ZERO", emboss_reserved_local_name, 4)) {
       *emboss_reserved_local_result = ExplicitlySizedAndSigned::ZERO;
       return true;
     }
@@ -1464,6 +1709,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    ExplicitlySizedAndSigned *emboss_reserved_local_result) {
+  return EnumTraits<ExplicitlySizedAndSigned>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     ExplicitlySizedAndSigned emboss_reserved_local_value) {
   return EnumTraits<ExplicitlySizedAndSigned>::TryToGetNameFromEnum(
@@ -1496,6 +1750,7 @@ namespace EmbossReservedAnonymousField1 {
 }  // namespace EmbossReservedAnonymousField1
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericEmbossReservedAnonymousField1View;
 
@@ -1644,13 +1899,13 @@ class GenericEmbossReservedAnonymousField1View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1659,17 +1914,32 @@ class GenericEmbossReservedAnonymousField1View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "wide_kind_in_bits") {
-        if (!wide_kind_in_bits().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 17:
+          switch (emboss_reserved_local_name[0]) {
+            case 'w':
+              if (emboss_reserved_local_name == "wide_kind_in_bits") {
+                if (!wide_kind_in_bits().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -1692,8 +1962,8 @@ class GenericEmbossReservedAnonymousField1View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           wide_kind_in_bits().IsAggregate() || wide_kind_in_bits().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1711,8 +1981,8 @@ class GenericEmbossReservedAnonymousField1View final {
                  emboss_reserved_local_field_options.comments() &&
                  !wide_kind_in_bits().IsAggregate() && !wide_kind_in_bits().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# wide_kind_in_bits: UNREADABLE\n");
       }
@@ -1720,8 +1990,8 @@ class GenericEmbossReservedAnonymousField1View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1730,6 +2000,32 @@ class GenericEmbossReservedAnonymousField1View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_wide_kind_in_bits().ValueOr(false)) {
+      emboss_reserved_local_visitor("wide_kind_in_bits", wide_kind_in_bits());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "wide_kind_in_bits", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1911,6 +2207,7 @@ MakeAlignedEmbossReservedAnonymousField1View(
 }  // namespace ManifestEntry
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericManifestEntryView;
 
@@ -2168,13 +2465,13 @@ class GenericManifestEntryView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2183,41 +2480,83 @@ class GenericManifestEntryView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "kind") {
-        if (!kind().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "count") {
-        if (!count().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "wide_kind") {
-        if (!wide_kind().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 'k':
+              if (emboss_reserved_local_name == "kind") {
+                if (!kind().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'c':
+              if (emboss_reserved_local_name == "count") {
+                if (!count().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 'w':
+              if (emboss_reserved_local_name == "wide_kind") {
+                if (!wide_kind().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 17:
+          switch (emboss_reserved_local_name[0]) {
+            case 'w':
+              if (emboss_reserved_local_name == "wide_kind_in_bits") {
+                if (!wide_kind_in_bits().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "wide_kind_in_bits") {
-        if (!wide_kind_in_bits().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -2240,8 +2579,8 @@ class GenericManifestEntryView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           kind().IsAggregate() || kind().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2259,8 +2598,8 @@ class GenericManifestEntryView final {
                  emboss_reserved_local_field_options.comments() &&
                  !kind().IsAggregate() && !kind().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# kind: UNREADABLE\n");
       }
@@ -2270,8 +2609,8 @@ class GenericManifestEntryView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           count().IsAggregate() || count().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2289,8 +2628,8 @@ class GenericManifestEntryView final {
                  emboss_reserved_local_field_options.comments() &&
                  !count().IsAggregate() && !count().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# count: UNREADABLE\n");
       }
@@ -2300,8 +2639,8 @@ class GenericManifestEntryView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           wide_kind().IsAggregate() || wide_kind().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2319,8 +2658,8 @@ class GenericManifestEntryView final {
                  emboss_reserved_local_field_options.comments() &&
                  !wide_kind().IsAggregate() && !wide_kind().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# wide_kind: UNREADABLE\n");
       }
@@ -2330,8 +2669,8 @@ class GenericManifestEntryView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           wide_kind_in_bits().IsAggregate() || wide_kind_in_bits().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2349,8 +2688,8 @@ class GenericManifestEntryView final {
                  emboss_reserved_local_field_options.comments() &&
                  !wide_kind_in_bits().IsAggregate() && !wide_kind_in_bits().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# wide_kind_in_bits: UNREADABLE\n");
       }
@@ -2358,8 +2697,8 @@ class GenericManifestEntryView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2368,6 +2707,50 @@ class GenericManifestEntryView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_kind().ValueOr(false)) {
+      emboss_reserved_local_visitor("kind", kind());
+    }
+
+    if (has_count().ValueOr(false)) {
+      emboss_reserved_local_visitor("count", count());
+    }
+
+    if (has_wide_kind().ValueOr(false)) {
+      emboss_reserved_local_visitor("wide_kind", wide_kind());
+    }
+
+    if (has_wide_kind_in_bits().ValueOr(false)) {
+      emboss_reserved_local_visitor("wide_kind_in_bits", wide_kind_in_bits());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 4; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "kind", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "count", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "wide_kind", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "wide_kind_in_bits", true, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -2593,12 +2976,23 @@ class EnumTraits<Status> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    Status *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("OK", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Status *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 2 &&
+        !memcmp("OK", emboss_reserved_local_name, 2)) {
       *emboss_reserved_local_result = Status::OK;
       return true;
     }
 
-    if (!strcmp("FAILURE", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 7 &&
+        !memcmp("FAILURE", emboss_reserved_local_name, 7)) {
       *emboss_reserved_local_result = Status::FAILURE;
       return true;
     }
@@ -2650,6 +3044,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Status *emboss_reserved_local_result) {
+  return EnumTraits<Status>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     Status emboss_reserved_local_value) {
   return EnumTraits<Status>::TryToGetNameFromEnum(
@@ -2670,6 +3073,18 @@ static inline ::std::ostream &operator<<(
 }  // namespace StructContainingEnum
 
 
+struct EMBOSS_MAY_ALIAS EmbossReservedNativeStructContainingEnum {
+  ::std::uint8_t bar;
+};
+static_assert(sizeof(EmbossReservedNativeStructContainingEnum) == 1,
+              "EmbossReservedNativeStructContainingEnum does not match the layout of "
+              "StructContainingEnum.");
+static_assert(offsetof(EmbossReservedNativeStructContainingEnum, bar) == 0,
+              "EmbossReservedNativeStructContainingEnum::bar is not at the same "
+              "offset as StructContainingEnum::bar.");
+
+
+
 template <class View>
 struct EmbossReservedInternalIsGenericStructContainingEnumView;
 
@@ -2818,13 +3233,13 @@ class GenericStructContainingEnumView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2833,17 +3248,32 @@ class GenericStructContainingEnumView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "bar") {
-        if (!bar().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 3:
+          switch (emboss_reserved_local_name[0]) {
+            case 'b':
+              if (emboss_reserved_local_name == "bar") {
+                if (!bar().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -2866,8 +3296,8 @@ class GenericStructContainingEnumView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           bar().IsAggregate() || bar().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2885,8 +3315,8 @@ class GenericStructContainingEnumView final {
                  emboss_reserved_local_field_options.comments() &&
                  !bar().IsAggregate() && !bar().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# bar: UNREADABLE\n");
       }
@@ -2894,8 +3324,8 @@ class GenericStructContainingEnumView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2904,6 +3334,50 @@ class GenericStructContainingEnumView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_bar().ValueOr(false)) {
+      emboss_reserved_local_visitor("bar", bar());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "bar", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  using Native = EmbossReservedNativeStructContainingEnum;
+
+  static constexpr bool HasNativeLayout() { return EMBOSS_HAS_MAY_ALIAS; }
+
+  template <class EmbossReservedStorage = Storage>
+  typename ::std::conditional<
+      ::std::is_const<typename ::std::remove_reference<decltype(
+          *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+      const Native *, Native *>::type
+  AsNative() const {
+    static_assert(HasNativeLayout() || sizeof(EmbossReservedStorage) == 0,
+                  "StructContainingEnum does not have a native layout on this system.");
+    EMBOSS_CHECK_GE(backing_.SizeInBytes(), sizeof(Native));
+    EMBOSS_CHECK_POINTER_ALIGNMENT(backing_.data(), alignof(Native), 0);
+    return reinterpret_cast<typename ::std::conditional<
+        ::std::is_const<typename ::std::remove_reference<decltype(
+            *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+        const Native *, Native *>::type>(backing_.data());
+  }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_ENUM_CASE_EMB_H_
 #define TESTDATA_ENUM_CASE_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -57,27 +59,41 @@ class EnumTraits<EnumShouty> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    EnumShouty *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("FIRST", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      EnumShouty *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("FIRST", emboss_reserved_local_name, 5)) {
       *emboss_reserved_local_result = EnumShouty::FIRST;
       return true;
     }
 
-    if (!strcmp("SECOND", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("SECOND", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = EnumShouty::SECOND;
       return true;
     }
 
-    if (!strcmp("TWO_WORD", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("TWO_WORD", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = EnumShouty::TWO_WORD;
       return true;
     }
 
-    if (!strcmp("THREE_WORD_ENUM", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 15 &&
+        !memcmp("THREE_WORD_ENUM", emboss_reserved_local_name, 15)) {
       *emboss_reserved_local_result = EnumShouty::THREE_WORD_ENUM;
       return true;
     }
 
-    if (!strcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 20 &&
+        !memcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name, 20)) {
       *emboss_reserved_local_result = EnumShouty::LONG_ENUM_VALUE_NAME;
       return true;
     }
@@ -141,6 +157,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    EnumShouty *emboss_reserved_local_result) {
+  return EnumTraits<EnumShouty>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     EnumShouty emboss_reserved_local_value) {
   return EnumTraits<EnumShouty>::TryToGetNameFromEnum(
@@ -174,27 +199,41 @@ class EnumTraits<EnumDefault> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    EnumDefault *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("FIRST", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      EnumDefault *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("FIRST", emboss_reserved_local_name, 5)) {
       *emboss_reserved_local_result = EnumDefault::kFirst;
       return true;
     }
 
-    if (!strcmp("SECOND", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("SECOND", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = EnumDefault::kSecond;
       return true;
     }
 
-    if (!strcmp("TWO_WORD", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("TWO_WORD", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = EnumDefault::kTwoWord;
       return true;
     }
 
-    if (!strcmp("THREE_WORD_ENUM", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 15 &&
+        !memcmp("THREE_WORD_ENUM", emboss_reserved_local_name, 15)) {
       *emboss_reserved_local_result = EnumDefault::kThreeWordEnum;
       return true;
     }
 
-    if (!strcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 20 &&
+        !memcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name, 20)) {
       *emboss_reserved_local_result = EnumDefault::kLongEnumValueName;
       return true;
     }
@@ -258,6 +297,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    EnumDefault *emboss_reserved_local_result) {
+  return EnumTraits<EnumDefault>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     EnumDefault emboss_reserved_local_value) {
   return EnumTraits<EnumDefault>::TryToGetNameFromEnum(
@@ -284,6 +332,7 @@ namespace UseKCamelEnumCase {
 }  // namespace UseKCamelEnumCase
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericUseKCamelEnumCaseView;
 
@@ -440,13 +489,13 @@ class GenericUseKCamelEnumCaseView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -455,17 +504,32 @@ class GenericUseKCamelEnumCaseView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "v") {
-        if (!v().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 1:
+          switch (emboss_reserved_local_name[0]) {
+            case 'v':
+              if (emboss_reserved_local_name == "v") {
+                if (!v().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -488,8 +552,8 @@ class GenericUseKCamelEnumCaseView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           v().IsAggregate() || v().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -507,8 +571,8 @@ class GenericUseKCamelEnumCaseView final {
                  emboss_reserved_local_field_options.comments() &&
                  !v().IsAggregate() && !v().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# v: UNREADABLE\n");
       }
@@ -518,16 +582,16 @@ class GenericUseKCamelEnumCaseView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           first().IsAggregate() || first().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# first: ");
         first().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# first: UNREADABLE\n");
       }
@@ -537,16 +601,16 @@ class GenericUseKCamelEnumCaseView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           v_is_first().IsAggregate() || v_is_first().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# v_is_first: ");
         v_is_first().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# v_is_first: UNREADABLE\n");
       }
@@ -554,8 +618,8 @@ class GenericUseKCamelEnumCaseView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -564,6 +628,44 @@ class GenericUseKCamelEnumCaseView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_v().ValueOr(false)) {
+      emboss_reserved_local_visitor("v", v());
+    }
+
+    if (has_first().ValueOr(false)) {
+      emboss_reserved_local_visitor("first", first());
+    }
+
+    if (has_v_is_first().ValueOr(false)) {
+      emboss_reserved_local_visitor("v_is_first", v_is_first());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "v", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "first", true, true} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "v_is_first", true, true} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -862,52 +964,71 @@ class EnumTraits<EnumShoutyAndKCamel> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    EnumShoutyAndKCamel *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("FIRST", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      EnumShoutyAndKCamel *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("FIRST", emboss_reserved_local_name, 5)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::FIRST;
       return true;
     }
 
-    if (!strcmp("FIRST", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("FIRST", emboss_reserved_local_name, 5)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::kFirst;
       return true;
     }
 
-    if (!strcmp("SECOND", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("SECOND", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::SECOND;
       return true;
     }
 
-    if (!strcmp("SECOND", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("SECOND", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::kSecond;
       return true;
     }
 
-    if (!strcmp("TWO_WORD", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("TWO_WORD", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::TWO_WORD;
       return true;
     }
 
-    if (!strcmp("TWO_WORD", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("TWO_WORD", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::kTwoWord;
       return true;
     }
 
-    if (!strcmp("THREE_WORD_ENUM", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 15 &&
+        !memcmp("THREE_WORD_ENUM", emboss_reserved_local_name, 15)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::THREE_WORD_ENUM;
       return true;
     }
 
-    if (!strcmp("THREE_WORD_ENUM", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 15 &&
+        !memcmp("THREE_WORD_ENUM", emboss_reserved_local_name, 15)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::kThreeWordEnum;
       return true;
     }
 
-    if (!strcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 20 &&
+        !memcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name, 20)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::LONG_ENUM_VALUE_NAME;
       return true;
     }
 
-    if (!strcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 20 &&
+        !memcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name, 20)) {
       *emboss_reserved_local_result = EnumShoutyAndKCamel::kLongEnumValueName;
       return true;
     }
@@ -971,6 +1092,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    EnumShoutyAndKCamel *emboss_reserved_local_result) {
+  return EnumTraits<EnumShoutyAndKCamel>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     EnumShoutyAndKCamel emboss_reserved_local_value) {
   return EnumTraits<EnumShoutyAndKCamel>::TryToGetNameFromEnum(
@@ -1006,37 +1136,53 @@ class EnumTraits<EnumMixed> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    EnumMixed *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("FIRST", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      EnumMixed *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("FIRST", emboss_reserved_local_name, 5)) {
       *emboss_reserved_local_result = EnumMixed::FIRST;
       return true;
     }
 
-    if (!strcmp("FIRST", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("FIRST", emboss_reserved_local_name, 5)) {
       *emboss_reserved_local_result = EnumMixed::kFirst;
       return true;
     }
 
-    if (!strcmp("SECOND", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("SECOND", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = EnumMixed::SECOND;
       return true;
     }
 
-    if (!strcmp("TWO_WORD", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("TWO_WORD", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = EnumMixed::kTwoWord;
       return true;
     }
 
-    if (!strcmp("THREE_WORD_ENUM", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 15 &&
+        !memcmp("THREE_WORD_ENUM", emboss_reserved_local_name, 15)) {
       *emboss_reserved_local_result = EnumMixed::kThreeWordEnum;
       return true;
     }
 
-    if (!strcmp("THREE_WORD_ENUM", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 15 &&
+        !memcmp("THREE_WORD_ENUM", emboss_reserved_local_name, 15)) {
       *emboss_reserved_local_result = EnumMixed::THREE_WORD_ENUM;
       return true;
     }
 
-    if (!strcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 20 &&
+        !memcmp("LONG_ENUM_VALUE_NAME", emboss_reserved_local_name, 20)) {
       *emboss_reserved_local_result = EnumMixed::kLongEnumValueName;
       return true;
     }
@@ -1100,6 +1246,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    EnumMixed *emboss_reserved_local_result) {
+  return EnumTraits<EnumMixed>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     EnumMixed emboss_reserved_local_value) {
   return EnumTraits<EnumMixed>::TryToGetNameFromEnum(
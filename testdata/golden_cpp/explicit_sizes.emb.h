@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_EXPLICIT_SIZES_EMB_H_
 #define TESTDATA_EXPLICIT_SIZES_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -68,6 +70,7 @@ namespace SizedUIntArrays {
 }  // namespace SizedUIntArrays
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericSizedUIntArraysView;
 
@@ -286,13 +289,13 @@ class GenericSizedUIntArraysView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -301,33 +304,59 @@ class GenericSizedUIntArraysView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "one_nibble") {
-        if (!one_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "two_nibble") {
-        if (!two_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'o':
+              if (emboss_reserved_local_name == "one_nibble") {
+                if (!one_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "two_nibble") {
+                if (!two_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_nibble") {
+                if (!four_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "four_nibble") {
-        if (!four_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -350,8 +379,8 @@ class GenericSizedUIntArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           one_nibble().IsAggregate() || one_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -369,8 +398,8 @@ class GenericSizedUIntArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !one_nibble().IsAggregate() && !one_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# one_nibble: UNREADABLE\n");
       }
@@ -380,8 +409,8 @@ class GenericSizedUIntArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_nibble().IsAggregate() || two_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -399,8 +428,8 @@ class GenericSizedUIntArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_nibble().IsAggregate() && !two_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_nibble: UNREADABLE\n");
       }
@@ -410,8 +439,8 @@ class GenericSizedUIntArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_nibble().IsAggregate() || four_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -429,8 +458,8 @@ class GenericSizedUIntArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_nibble().IsAggregate() && !four_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_nibble: UNREADABLE\n");
       }
@@ -438,8 +467,8 @@ class GenericSizedUIntArraysView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -448,6 +477,44 @@ class GenericSizedUIntArraysView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_one_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("one_nibble", one_nibble());
+    }
+
+    if (has_two_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_nibble", two_nibble());
+    }
+
+    if (has_four_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_nibble", four_nibble());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "one_nibble", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "two_nibble", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "four_nibble", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -662,6 +729,7 @@ namespace SizedIntArrays {
 }  // namespace SizedIntArrays
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericSizedIntArraysView;
 
@@ -880,13 +948,13 @@ class GenericSizedIntArraysView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -895,33 +963,59 @@ class GenericSizedIntArraysView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "one_nibble") {
-        if (!one_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "two_nibble") {
-        if (!two_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'o':
+              if (emboss_reserved_local_name == "one_nibble") {
+                if (!one_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "two_nibble") {
+                if (!two_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_nibble") {
+                if (!four_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "four_nibble") {
-        if (!four_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -944,8 +1038,8 @@ class GenericSizedIntArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           one_nibble().IsAggregate() || one_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -963,8 +1057,8 @@ class GenericSizedIntArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !one_nibble().IsAggregate() && !one_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# one_nibble: UNREADABLE\n");
       }
@@ -974,8 +1068,8 @@ class GenericSizedIntArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_nibble().IsAggregate() || two_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -993,8 +1087,8 @@ class GenericSizedIntArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_nibble().IsAggregate() && !two_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_nibble: UNREADABLE\n");
       }
@@ -1004,8 +1098,8 @@ class GenericSizedIntArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_nibble().IsAggregate() || four_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1023,8 +1117,8 @@ class GenericSizedIntArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_nibble().IsAggregate() && !four_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_nibble: UNREADABLE\n");
       }
@@ -1032,8 +1126,8 @@ class GenericSizedIntArraysView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1042,6 +1136,44 @@ class GenericSizedIntArraysView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_one_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("one_nibble", one_nibble());
+    }
+
+    if (has_two_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_nibble", two_nibble());
+    }
+
+    if (has_four_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_nibble", four_nibble());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "one_nibble", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "two_nibble", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "four_nibble", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1256,6 +1388,7 @@ namespace SizedEnumArrays {
 }  // namespace SizedEnumArrays
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericSizedEnumArraysView;
 
@@ -1474,13 +1607,13 @@ class GenericSizedEnumArraysView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1489,33 +1622,59 @@ class GenericSizedEnumArraysView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "one_nibble") {
-        if (!one_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "two_nibble") {
-        if (!two_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'o':
+              if (emboss_reserved_local_name == "one_nibble") {
+                if (!one_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 't':
+              if (emboss_reserved_local_name == "two_nibble") {
+                if (!two_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "four_nibble") {
+                if (!four_nibble().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "four_nibble") {
-        if (!four_nibble().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1538,8 +1697,8 @@ class GenericSizedEnumArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           one_nibble().IsAggregate() || one_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1557,8 +1716,8 @@ class GenericSizedEnumArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !one_nibble().IsAggregate() && !one_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# one_nibble: UNREADABLE\n");
       }
@@ -1568,8 +1727,8 @@ class GenericSizedEnumArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           two_nibble().IsAggregate() || two_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1587,8 +1746,8 @@ class GenericSizedEnumArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !two_nibble().IsAggregate() && !two_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# two_nibble: UNREADABLE\n");
       }
@@ -1598,8 +1757,8 @@ class GenericSizedEnumArraysView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           four_nibble().IsAggregate() || four_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1617,8 +1776,8 @@ class GenericSizedEnumArraysView final {
                  emboss_reserved_local_field_options.comments() &&
                  !four_nibble().IsAggregate() && !four_nibble().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# four_nibble: UNREADABLE\n");
       }
@@ -1626,8 +1785,8 @@ class GenericSizedEnumArraysView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1636,6 +1795,44 @@ class GenericSizedEnumArraysView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_one_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("one_nibble", one_nibble());
+    }
+
+    if (has_two_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("two_nibble", two_nibble());
+    }
+
+    if (has_four_nibble().ValueOr(false)) {
+      emboss_reserved_local_visitor("four_nibble", four_nibble());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "one_nibble", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "two_nibble", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "four_nibble", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1851,6 +2048,7 @@ namespace BitArrayContainer {
 }  // namespace BitArrayContainer
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericBitArrayContainerView;
 
@@ -1999,13 +2197,13 @@ class GenericBitArrayContainerView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2014,17 +2212,32 @@ class GenericBitArrayContainerView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "uint_arrays") {
-        if (!uint_arrays().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'u':
+              if (emboss_reserved_local_name == "uint_arrays") {
+                if (!uint_arrays().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -2047,8 +2260,8 @@ class GenericBitArrayContainerView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           uint_arrays().IsAggregate() || uint_arrays().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2066,8 +2279,8 @@ class GenericBitArrayContainerView final {
                  emboss_reserved_local_field_options.comments() &&
                  !uint_arrays().IsAggregate() && !uint_arrays().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# uint_arrays: UNREADABLE\n");
       }
@@ -2075,8 +2288,8 @@ class GenericBitArrayContainerView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2085,6 +2298,32 @@ class GenericBitArrayContainerView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_uint_arrays().ValueOr(false)) {
+      emboss_reserved_local_visitor("uint_arrays", uint_arrays());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "uint_arrays", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -2279,42 +2518,59 @@ class EnumTraits<Enum> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    Enum *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("VALUE1", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Enum *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("VALUE1", emboss_reserved_local_name, 6)) {
       *emboss_reserved_local_result = Enum::VALUE1;
       return true;
     }
 
-    if (!strcmp("VALUE10", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 7 &&
+        !memcmp("VALUE10", emboss_reserved_local_name, 7)) {
       *emboss_reserved_local_result = Enum::VALUE10;
       return true;
     }
 
-    if (!strcmp("VALUE100", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 8 &&
+        !memcmp("VALUE100", emboss_reserved_local_name, 8)) {
       *emboss_reserved_local_result = Enum::VALUE100;
       return true;
     }
 
-    if (!strcmp("VALUE1000", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 9 &&
+        !memcmp("VALUE1000", emboss_reserved_local_name, 9)) {
       *emboss_reserved_local_result = Enum::VALUE1000;
       return true;
     }
 
-    if (!strcmp("VALUE10000", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 10 &&
+        !memcmp("VALUE10000", emboss_reserved_local_name, 10)) {
       *emboss_reserved_local_result = Enum::VALUE10000;
       return true;
     }
 
-    if (!strcmp("VALUE100000", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 11 &&
+        !memcmp("VALUE100000", emboss_reserved_local_name, 11)) {
       *emboss_reserved_local_result = Enum::VALUE100000;
       return true;
     }
 
-    if (!strcmp("VALUE1000000", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 12 &&
+        !memcmp("VALUE1000000", emboss_reserved_local_name, 12)) {
       *emboss_reserved_local_result = Enum::VALUE1000000;
       return true;
     }
 
-    if (!strcmp("VALUE10000000", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 13 &&
+        !memcmp("VALUE10000000", emboss_reserved_local_name, 13)) {
       *emboss_reserved_local_result = Enum::VALUE10000000;
       return true;
     }
@@ -2390,6 +2646,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Enum *emboss_reserved_local_result) {
+  return EnumTraits<Enum>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     Enum emboss_reserved_local_value) {
   return EnumTraits<Enum>::TryToGetNameFromEnum(
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_INLINE_TYPE_EMB_H_
 #define TESTDATA_INLINE_TYPE_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -56,12 +58,23 @@ class EnumTraits<Status> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    Status *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("OK", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Status *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 2 &&
+        !memcmp("OK", emboss_reserved_local_name, 2)) {
       *emboss_reserved_local_result = Status::OK;
       return true;
     }
 
-    if (!strcmp("FAILURE", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 7 &&
+        !memcmp("FAILURE", emboss_reserved_local_name, 7)) {
       *emboss_reserved_local_result = Status::FAILURE;
       return true;
     }
@@ -113,6 +126,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Status *emboss_reserved_local_result) {
+  return EnumTraits<Status>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     Status emboss_reserved_local_value) {
   return EnumTraits<Status>::TryToGetNameFromEnum(
@@ -144,12 +166,23 @@ class EnumTraits<SecondaryStatus> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    SecondaryStatus *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("OK", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      SecondaryStatus *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 2 &&
+        !memcmp("OK", emboss_reserved_local_name, 2)) {
       *emboss_reserved_local_result = SecondaryStatus::OK;
       return true;
     }
 
-    if (!strcmp("FAILURE", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 7 &&
+        !memcmp("FAILURE", emboss_reserved_local_name, 7)) {
       *emboss_reserved_local_result = SecondaryStatus::FAILURE;
       return true;
     }
@@ -201,6 +234,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    SecondaryStatus *emboss_reserved_local_result) {
+  return EnumTraits<SecondaryStatus>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     SecondaryStatus emboss_reserved_local_value) {
   return EnumTraits<SecondaryStatus>::TryToGetNameFromEnum(
@@ -221,6 +263,7 @@ static inline ::std::ostream &operator<<(
 }  // namespace Foo
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericFooView;
 
@@ -405,13 +448,13 @@ class GenericFooView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -420,25 +463,49 @@ class GenericFooView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "status") {
-        if (!status().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 6:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "status") {
+                if (!status().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 16:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "secondary_status") {
+                if (!secondary_status().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "secondary_status") {
-        if (!secondary_status().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -461,8 +528,8 @@ class GenericFooView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           status().IsAggregate() || status().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -480,8 +547,8 @@ class GenericFooView final {
                  emboss_reserved_local_field_options.comments() &&
                  !status().IsAggregate() && !status().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# status: UNREADABLE\n");
       }
@@ -491,8 +558,8 @@ class GenericFooView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           secondary_status().IsAggregate() || secondary_status().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -510,8 +577,8 @@ class GenericFooView final {
                  emboss_reserved_local_field_options.comments() &&
                  !secondary_status().IsAggregate() && !secondary_status().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# secondary_status: UNREADABLE\n");
       }
@@ -519,8 +586,8 @@ class GenericFooView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -529,6 +596,38 @@ class GenericFooView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_status().ValueOr(false)) {
+      emboss_reserved_local_visitor("status", status());
+    }
+
+    if (has_secondary_status().ValueOr(false)) {
+      emboss_reserved_local_visitor("secondary_status", secondary_status());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "status", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "secondary_status", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_LARGE_ARRAY_EMB_H_
 #define TESTDATA_LARGE_ARRAY_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -31,6 +33,8 @@ namespace UIntArray {
 template <class Storage>
 class GenericUIntArrayView;
 
+class EmbossReservedBuilderUIntArray;
+
 
 
 
@@ -41,6 +45,7 @@ namespace UIntArray {
 }  // namespace UIntArray
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericUIntArrayView;
 
@@ -223,13 +228,13 @@ class GenericUIntArrayView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -238,25 +243,49 @@ class GenericUIntArrayView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "element_count") {
-        if (!element_count().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 'e':
+              if (emboss_reserved_local_name == "elements") {
+                if (!elements().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 13:
+          switch (emboss_reserved_local_name[0]) {
+            case 'e':
+              if (emboss_reserved_local_name == "element_count") {
+                if (!element_count().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "elements") {
-        if (!elements().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -279,8 +308,8 @@ class GenericUIntArrayView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           element_count().IsAggregate() || element_count().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -298,8 +327,8 @@ class GenericUIntArrayView final {
                  emboss_reserved_local_field_options.comments() &&
                  !element_count().IsAggregate() && !element_count().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# element_count: UNREADABLE\n");
       }
@@ -309,8 +338,8 @@ class GenericUIntArrayView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           elements().IsAggregate() || elements().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -328,8 +357,8 @@ class GenericUIntArrayView final {
                  emboss_reserved_local_field_options.comments() &&
                  !elements().IsAggregate() && !elements().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# elements: UNREADABLE\n");
       }
@@ -337,8 +366,8 @@ class GenericUIntArrayView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -347,6 +376,39 @@ class GenericUIntArrayView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_element_count().ValueOr(false)) {
+      emboss_reserved_local_visitor("element_count", element_count());
+    }
+
+    if (has_elements().ValueOr(false)) {
+      emboss_reserved_local_visitor("elements", elements());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "element_count", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "elements", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+  using Builder = EmbossReservedBuilderUIntArray;
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -568,6 +630,52 @@ MakeAlignedUIntArrayView(
       emboss_reserved_local_size);
 }
 
+class EmbossReservedBuilderUIntArray final {
+ public:
+  explicit EmbossReservedBuilderUIntArray(
+      ::std::vector</**/ ::std::uint8_t> *emboss_reserved_local_output)
+      : output_(emboss_reserved_local_output),
+        start_(emboss_reserved_local_output->size()) {
+    output_->resize(start_ + 4);
+  }
+  EmbossReservedBuilderUIntArray(const EmbossReservedBuilderUIntArray &) = delete;
+  EmbossReservedBuilderUIntArray &operator=(
+      const EmbossReservedBuilderUIntArray &) = delete;
+
+  decltype(::std::declval<UIntArrayWriter>().elements()) append_elements(
+      ::std::size_t emboss_reserved_local_element_count) {
+    EMBOSS_CHECK_EQ(next_field_, 0);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    elements_size_in_bytes_ = emboss_reserved_local_element_count * 4;
+    output_->resize(emboss_reserved_local_offset +
+                    elements_size_in_bytes_);
+    return decltype(::std::declval<UIntArrayWriter>().elements())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset,
+            elements_size_in_bytes_});
+  }
+
+  ::std::size_t Finish() {
+    EMBOSS_CHECK_EQ(next_field_, 1);
+    if (!decltype(::std::declval<UIntArrayWriter>().element_count())(
+             ::emboss::support::ReadWriteContiguousBuffer{
+                 output_->data() + start_ + 0, 4})
+             .TryToWrite(static_cast</**/ ::std::int64_t>(elements_size_in_bytes_) / 4)) {
+      return 0;
+    }
+
+    return output_->size() - start_;
+  }
+
+ private:
+  ::std::vector</**/ ::std::uint8_t> *output_;
+  ::std::size_t start_;
+  int next_field_ = 0;
+  ::std::size_t elements_size_in_bytes_ = 0;
+};
+
+
 namespace UIntArray {
 
 }  // namespace UIntArray
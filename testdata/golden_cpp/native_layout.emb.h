@@ -0,0 +1,4975 @@
+/**
+ * Generated by the Emboss compiler.  DO NOT EDIT!
+ */
+#ifndef TESTDATA_NATIVE_LAYOUT_EMB_H_
+#define TESTDATA_NATIVE_LAYOUT_EMB_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "runtime/cpp/emboss_cpp_util.h"
+
+#include "runtime/cpp/emboss_prelude.h"
+
+#include "runtime/cpp/emboss_enum_view.h"
+
+#include "runtime/cpp/emboss_text_util.h"
+
+
+
+/* NOLINTBEGIN */
+namespace emboss {
+namespace test {
+namespace NativeRecord {
+
+}  // namespace NativeRecord
+
+
+template <class Storage>
+class GenericNativeRecordView;
+
+namespace BigEndianNativeRecord {
+
+}  // namespace BigEndianNativeRecord
+
+
+template <class Storage>
+class GenericBigEndianNativeRecordView;
+
+namespace MisalignedRecord {
+
+}  // namespace MisalignedRecord
+
+
+template <class Storage>
+class GenericMisalignedRecordView;
+
+namespace MixedEndianRecord {
+
+}  // namespace MixedEndianRecord
+
+
+template <class Storage>
+class GenericMixedEndianRecordView;
+
+namespace OverlappingRecord {
+
+}  // namespace OverlappingRecord
+
+
+template <class Storage>
+class GenericOverlappingRecordView;
+
+enum class Kind : ::std::uint8_t;
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+namespace NativeRecord {
+
+}  // namespace NativeRecord
+
+
+struct EMBOSS_MAY_ALIAS EmbossReservedNativeNativeRecord {
+  ::std::uint32_t id;
+  ::std::int16_t delta;
+  ::emboss::test::Kind kind;
+  ::std::uint8_t emboss_reserved_padding_7[1];
+  double value;
+  ::std::uint8_t tag[4];
+  ::std::uint16_t flags;
+  ::std::uint8_t emboss_reserved_padding_22[2];
+  ::std::uint16_t samples[4];
+  ::std::uint8_t emboss_reserved_padding_32[8];
+  ::std::uint32_t timestamp;
+  ::std::uint32_t sequence;
+};
+static_assert(sizeof(EmbossReservedNativeNativeRecord) == 48,
+              "EmbossReservedNativeNativeRecord does not match the layout of "
+              "NativeRecord.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, id) == 0,
+              "EmbossReservedNativeNativeRecord::id is not at the same "
+              "offset as NativeRecord::id.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, delta) == 4,
+              "EmbossReservedNativeNativeRecord::delta is not at the same "
+              "offset as NativeRecord::delta.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, kind) == 6,
+              "EmbossReservedNativeNativeRecord::kind is not at the same "
+              "offset as NativeRecord::kind.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, value) == 8,
+              "EmbossReservedNativeNativeRecord::value is not at the same "
+              "offset as NativeRecord::value.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, tag) == 16,
+              "EmbossReservedNativeNativeRecord::tag is not at the same "
+              "offset as NativeRecord::tag.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, flags) == 20,
+              "EmbossReservedNativeNativeRecord::flags is not at the same "
+              "offset as NativeRecord::flags.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, samples) == 24,
+              "EmbossReservedNativeNativeRecord::samples is not at the same "
+              "offset as NativeRecord::samples.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, timestamp) == 40,
+              "EmbossReservedNativeNativeRecord::timestamp is not at the same "
+              "offset as NativeRecord::timestamp.");
+static_assert(offsetof(EmbossReservedNativeNativeRecord, sequence) == 44,
+              "EmbossReservedNativeNativeRecord::sequence is not at the same "
+              "offset as NativeRecord::sequence.");
+
+
+
+template <class View>
+struct EmbossReservedInternalIsGenericNativeRecordView;
+
+template <class Storage>
+class GenericNativeRecordView final {
+ public:
+  GenericNativeRecordView() : backing_() {}
+  explicit GenericNativeRecordView(
+       Storage emboss_reserved_local_bytes)
+      : backing_(emboss_reserved_local_bytes) 
+         {}
+
+  template <typename OtherStorage>
+  GenericNativeRecordView(
+      const GenericNativeRecordView<OtherStorage> &emboss_reserved_local_other)
+      : backing_{emboss_reserved_local_other.BackingStorage()}
+         {}
+
+  template <typename Arg,
+            typename = typename ::std::enable_if<
+                !EmbossReservedInternalIsGenericNativeRecordView<
+                    typename ::std::remove_cv<typename ::std::remove_reference<
+                        Arg>::type>::type>::value>::type>
+  explicit GenericNativeRecordView(
+       Arg &&emboss_reserved_local_arg)
+      : backing_(::std::forward<Arg>(
+            emboss_reserved_local_arg)) 
+         {}
+  template <typename Arg0, typename Arg1, typename... Args>
+  explicit GenericNativeRecordView(
+       Arg0 &&emboss_reserved_local_arg0,
+      Arg1 &&emboss_reserved_local_arg1, Args &&... emboss_reserved_local_args)
+      : backing_(::std::forward<Arg0>(emboss_reserved_local_arg0),
+                 ::std::forward<Arg1>(emboss_reserved_local_arg1),
+                 ::std::forward<Args>(
+                     emboss_reserved_local_args)...) 
+         {}
+
+  template <typename OtherStorage>
+  GenericNativeRecordView<Storage> &operator=(
+      const GenericNativeRecordView<OtherStorage> &emboss_reserved_local_other) {
+    backing_ = emboss_reserved_local_other.BackingStorage();
+    return *this;
+  }
+
+  
+
+  bool Ok() const {
+    if (!IsComplete()) return false;
+
+    if (!has_id().Known()) return false;
+    if (has_id().ValueOrDefault() && !id().Ok()) return false;
+
+
+    if (!has_delta().Known()) return false;
+    if (has_delta().ValueOrDefault() && !delta().Ok()) return false;
+
+
+    if (!has_kind().Known()) return false;
+    if (has_kind().ValueOrDefault() && !kind().Ok()) return false;
+
+
+    if (!has_value().Known()) return false;
+    if (has_value().ValueOrDefault() && !value().Ok()) return false;
+
+
+    if (!has_tag().Known()) return false;
+    if (has_tag().ValueOrDefault() && !tag().Ok()) return false;
+
+
+    if (!has_flags().Known()) return false;
+    if (has_flags().ValueOrDefault() && !flags().Ok()) return false;
+
+
+    if (!has_samples().Known()) return false;
+    if (has_samples().ValueOrDefault() && !samples().Ok()) return false;
+
+
+    if (!has_timestamp().Known()) return false;
+    if (has_timestamp().ValueOrDefault() && !timestamp().Ok()) return false;
+
+
+    if (!has_sequence().Known()) return false;
+    if (has_sequence().ValueOrDefault() && !sequence().Ok()) return false;
+
+
+    if (!has_timestamp_plus_one().Known()) return false;
+    if (has_timestamp_plus_one().ValueOrDefault() && !timestamp_plus_one().Ok()) return false;
+
+
+    if (!has_IntrinsicSizeInBytes().Known()) return false;
+    if (has_IntrinsicSizeInBytes().ValueOrDefault() && !IntrinsicSizeInBytes().Ok()) return false;
+
+
+    if (!has_MaxSizeInBytes().Known()) return false;
+    if (has_MaxSizeInBytes().ValueOrDefault() && !MaxSizeInBytes().Ok()) return false;
+
+
+    if (!has_MinSizeInBytes().Known()) return false;
+    if (has_MinSizeInBytes().ValueOrDefault() && !MinSizeInBytes().Ok()) return false;
+
+
+
+    return true;
+  }
+  Storage BackingStorage() const { return backing_; }
+  bool IsComplete() const {
+    return backing_.Ok() && IntrinsicSizeInBytes().Ok() &&
+           backing_.SizeInBytes() >=
+               static_cast</**/ ::std::size_t>(
+                   IntrinsicSizeInBytes().UncheckedRead());
+  }
+  static constexpr ::std::size_t SizeInBytes() {
+    return static_cast</**/ ::std::size_t>(IntrinsicSizeInBytes().Read());
+  }
+  static constexpr bool SizeIsKnown() {
+    return IntrinsicSizeInBytes().Ok();
+  }
+
+
+  template <typename OtherStorage>
+  bool Equals(
+      GenericNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (!has_id().Known()) return false;
+    if (!emboss_reserved_local_other.has_id().Known()) return false;
+
+    if (emboss_reserved_local_other.has_id().ValueOrDefault() &&
+        !has_id().ValueOrDefault())
+      return false;
+    if (has_id().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_id().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_id().ValueOrDefault() &&
+        has_id().ValueOrDefault() &&
+        !id().Equals(emboss_reserved_local_other.id()))
+      return false;
+
+
+
+    if (!has_delta().Known()) return false;
+    if (!emboss_reserved_local_other.has_delta().Known()) return false;
+
+    if (emboss_reserved_local_other.has_delta().ValueOrDefault() &&
+        !has_delta().ValueOrDefault())
+      return false;
+    if (has_delta().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_delta().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_delta().ValueOrDefault() &&
+        has_delta().ValueOrDefault() &&
+        !delta().Equals(emboss_reserved_local_other.delta()))
+      return false;
+
+
+
+    if (!has_kind().Known()) return false;
+    if (!emboss_reserved_local_other.has_kind().Known()) return false;
+
+    if (emboss_reserved_local_other.has_kind().ValueOrDefault() &&
+        !has_kind().ValueOrDefault())
+      return false;
+    if (has_kind().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_kind().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_kind().ValueOrDefault() &&
+        has_kind().ValueOrDefault() &&
+        !kind().Equals(emboss_reserved_local_other.kind()))
+      return false;
+
+
+
+    if (!has_value().Known()) return false;
+    if (!emboss_reserved_local_other.has_value().Known()) return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOrDefault() &&
+        !has_value().ValueOrDefault())
+      return false;
+    if (has_value().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_value().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOrDefault() &&
+        has_value().ValueOrDefault() &&
+        !value().Equals(emboss_reserved_local_other.value()))
+      return false;
+
+
+
+    if (!has_tag().Known()) return false;
+    if (!emboss_reserved_local_other.has_tag().Known()) return false;
+
+    if (emboss_reserved_local_other.has_tag().ValueOrDefault() &&
+        !has_tag().ValueOrDefault())
+      return false;
+    if (has_tag().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_tag().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_tag().ValueOrDefault() &&
+        has_tag().ValueOrDefault() &&
+        !tag().Equals(emboss_reserved_local_other.tag()))
+      return false;
+
+
+
+    if (!has_flags().Known()) return false;
+    if (!emboss_reserved_local_other.has_flags().Known()) return false;
+
+    if (emboss_reserved_local_other.has_flags().ValueOrDefault() &&
+        !has_flags().ValueOrDefault())
+      return false;
+    if (has_flags().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_flags().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_flags().ValueOrDefault() &&
+        has_flags().ValueOrDefault() &&
+        !flags().Equals(emboss_reserved_local_other.flags()))
+      return false;
+
+
+
+    if (!has_samples().Known()) return false;
+    if (!emboss_reserved_local_other.has_samples().Known()) return false;
+
+    if (emboss_reserved_local_other.has_samples().ValueOrDefault() &&
+        !has_samples().ValueOrDefault())
+      return false;
+    if (has_samples().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_samples().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_samples().ValueOrDefault() &&
+        has_samples().ValueOrDefault() &&
+        !samples().Equals(emboss_reserved_local_other.samples()))
+      return false;
+
+
+
+    if (!has_timestamp().Known()) return false;
+    if (!emboss_reserved_local_other.has_timestamp().Known()) return false;
+
+    if (emboss_reserved_local_other.has_timestamp().ValueOrDefault() &&
+        !has_timestamp().ValueOrDefault())
+      return false;
+    if (has_timestamp().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_timestamp().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_timestamp().ValueOrDefault() &&
+        has_timestamp().ValueOrDefault() &&
+        !timestamp().Equals(emboss_reserved_local_other.timestamp()))
+      return false;
+
+
+
+    if (!has_sequence().Known()) return false;
+    if (!emboss_reserved_local_other.has_sequence().Known()) return false;
+
+    if (emboss_reserved_local_other.has_sequence().ValueOrDefault() &&
+        !has_sequence().ValueOrDefault())
+      return false;
+    if (has_sequence().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_sequence().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_sequence().ValueOrDefault() &&
+        has_sequence().ValueOrDefault() &&
+        !sequence().Equals(emboss_reserved_local_other.sequence()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  bool UncheckedEquals(
+      GenericNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (emboss_reserved_local_other.has_id().ValueOr(false) &&
+        !has_id().ValueOr(false))
+      return false;
+    if (has_id().ValueOr(false) &&
+        !emboss_reserved_local_other.has_id().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_id().ValueOr(false) &&
+        has_id().ValueOr(false) &&
+        !id().UncheckedEquals(emboss_reserved_local_other.id()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_delta().ValueOr(false) &&
+        !has_delta().ValueOr(false))
+      return false;
+    if (has_delta().ValueOr(false) &&
+        !emboss_reserved_local_other.has_delta().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_delta().ValueOr(false) &&
+        has_delta().ValueOr(false) &&
+        !delta().UncheckedEquals(emboss_reserved_local_other.delta()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_kind().ValueOr(false) &&
+        !has_kind().ValueOr(false))
+      return false;
+    if (has_kind().ValueOr(false) &&
+        !emboss_reserved_local_other.has_kind().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_kind().ValueOr(false) &&
+        has_kind().ValueOr(false) &&
+        !kind().UncheckedEquals(emboss_reserved_local_other.kind()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_value().ValueOr(false) &&
+        !has_value().ValueOr(false))
+      return false;
+    if (has_value().ValueOr(false) &&
+        !emboss_reserved_local_other.has_value().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOr(false) &&
+        has_value().ValueOr(false) &&
+        !value().UncheckedEquals(emboss_reserved_local_other.value()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_tag().ValueOr(false) &&
+        !has_tag().ValueOr(false))
+      return false;
+    if (has_tag().ValueOr(false) &&
+        !emboss_reserved_local_other.has_tag().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_tag().ValueOr(false) &&
+        has_tag().ValueOr(false) &&
+        !tag().UncheckedEquals(emboss_reserved_local_other.tag()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_flags().ValueOr(false) &&
+        !has_flags().ValueOr(false))
+      return false;
+    if (has_flags().ValueOr(false) &&
+        !emboss_reserved_local_other.has_flags().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_flags().ValueOr(false) &&
+        has_flags().ValueOr(false) &&
+        !flags().UncheckedEquals(emboss_reserved_local_other.flags()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_samples().ValueOr(false) &&
+        !has_samples().ValueOr(false))
+      return false;
+    if (has_samples().ValueOr(false) &&
+        !emboss_reserved_local_other.has_samples().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_samples().ValueOr(false) &&
+        has_samples().ValueOr(false) &&
+        !samples().UncheckedEquals(emboss_reserved_local_other.samples()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_timestamp().ValueOr(false) &&
+        !has_timestamp().ValueOr(false))
+      return false;
+    if (has_timestamp().ValueOr(false) &&
+        !emboss_reserved_local_other.has_timestamp().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_timestamp().ValueOr(false) &&
+        has_timestamp().ValueOr(false) &&
+        !timestamp().UncheckedEquals(emboss_reserved_local_other.timestamp()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_sequence().ValueOr(false) &&
+        !has_sequence().ValueOr(false))
+      return false;
+    if (has_sequence().ValueOr(false) &&
+        !emboss_reserved_local_other.has_sequence().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_sequence().ValueOr(false) &&
+        has_sequence().ValueOr(false) &&
+        !sequence().UncheckedEquals(emboss_reserved_local_other.sequence()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  void UncheckedCopyFrom(
+      GenericNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.UncheckedCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().UncheckedRead());
+  }
+
+  template <typename OtherStorage>
+  void CopyFrom(
+      GenericNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.CopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+  template <typename OtherStorage>
+  bool TryToCopyFrom(
+      GenericNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+      return emboss_reserved_local_other.Ok() && backing_.TryToCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+
+  template <class Stream>
+  bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
+    ::emboss::support::TextToken emboss_reserved_local_brace;
+    if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                      &emboss_reserved_local_brace))
+      return false;
+    if (emboss_reserved_local_brace != "{") return false;
+    for (;;) {
+      ::emboss::support::TextToken emboss_reserved_local_name;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_name))
+        return false;
+      if (emboss_reserved_local_name == ",")
+        if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                          &emboss_reserved_local_name))
+          return false;
+      if (emboss_reserved_local_name == "}") return true;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_colon))
+        return false;
+      if (emboss_reserved_local_colon != ":") return false;
+      switch (emboss_reserved_local_name.size()) {
+        case 2:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "id") {
+                if (!id().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 3:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "tag") {
+                if (!tag().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 'k':
+              if (emboss_reserved_local_name == "kind") {
+                if (!kind().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'd':
+              if (emboss_reserved_local_name == "delta") {
+                if (!delta().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'f':
+              if (emboss_reserved_local_name == "flags") {
+                if (!flags().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'v':
+              if (emboss_reserved_local_name == "value") {
+                if (!value().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "samples") {
+                if (!samples().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 8:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "sequence") {
+                if (!sequence().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 9:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "timestamp") {
+                if (!timestamp().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 18:
+          switch (emboss_reserved_local_name[0]) {
+            case 't':
+              if (emboss_reserved_local_name == "timestamp_plus_one") {
+                if (!timestamp_plus_one().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+  }
+
+  template <class Stream>
+  void WriteToTextStream(
+      Stream *emboss_reserved_local_stream,
+      ::emboss::TextOutputOptions emboss_reserved_local_options) const {
+    ::emboss::TextOutputOptions emboss_reserved_local_field_options =
+        emboss_reserved_local_options.PlusOneIndent();
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_stream->Write("{\n");
+    } else {
+      emboss_reserved_local_stream->Write("{");
+    }
+    bool emboss_reserved_local_wrote_field = false;
+    if (has_id().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          id().IsAggregate() || id().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("id: ");
+        id().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !id().IsAggregate() && !id().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# id: UNREADABLE\n");
+      }
+    }
+
+    if (has_delta().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          delta().IsAggregate() || delta().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("delta: ");
+        delta().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !delta().IsAggregate() && !delta().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# delta: UNREADABLE\n");
+      }
+    }
+
+    if (has_kind().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          kind().IsAggregate() || kind().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("kind: ");
+        kind().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !kind().IsAggregate() && !kind().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# kind: UNREADABLE\n");
+      }
+    }
+
+    if (has_value().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          value().IsAggregate() || value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("value: ");
+        value().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !value().IsAggregate() && !value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# value: UNREADABLE\n");
+      }
+    }
+
+    if (has_tag().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          tag().IsAggregate() || tag().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("tag: ");
+        tag().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !tag().IsAggregate() && !tag().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# tag: UNREADABLE\n");
+      }
+    }
+
+    if (has_flags().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          flags().IsAggregate() || flags().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("flags: ");
+        flags().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !flags().IsAggregate() && !flags().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# flags: UNREADABLE\n");
+      }
+    }
+
+    if (has_samples().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          samples().IsAggregate() || samples().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("samples: ");
+        samples().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !samples().IsAggregate() && !samples().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# samples: UNREADABLE\n");
+      }
+    }
+
+    if (has_timestamp().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          timestamp().IsAggregate() || timestamp().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("timestamp: ");
+        timestamp().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !timestamp().IsAggregate() && !timestamp().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# timestamp: UNREADABLE\n");
+      }
+    }
+
+    if (has_sequence().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          sequence().IsAggregate() || sequence().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("sequence: ");
+        sequence().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !sequence().IsAggregate() && !sequence().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# sequence: UNREADABLE\n");
+      }
+    }
+
+    if (has_timestamp_plus_one().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          timestamp_plus_one().IsAggregate() || timestamp_plus_one().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("timestamp_plus_one: ");
+        timestamp_plus_one().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !timestamp_plus_one().IsAggregate() && !timestamp_plus_one().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# timestamp_plus_one: UNREADABLE\n");
+      }
+    }
+
+    (void)emboss_reserved_local_wrote_field;
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
+      emboss_reserved_local_stream->Write("}");
+    } else {
+      emboss_reserved_local_stream->Write(" }");
+    }
+  }
+
+
+
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_id().ValueOr(false)) {
+      emboss_reserved_local_visitor("id", id());
+    }
+
+    if (has_delta().ValueOr(false)) {
+      emboss_reserved_local_visitor("delta", delta());
+    }
+
+    if (has_kind().ValueOr(false)) {
+      emboss_reserved_local_visitor("kind", kind());
+    }
+
+    if (has_value().ValueOr(false)) {
+      emboss_reserved_local_visitor("value", value());
+    }
+
+    if (has_tag().ValueOr(false)) {
+      emboss_reserved_local_visitor("tag", tag());
+    }
+
+    if (has_flags().ValueOr(false)) {
+      emboss_reserved_local_visitor("flags", flags());
+    }
+
+    if (has_samples().ValueOr(false)) {
+      emboss_reserved_local_visitor("samples", samples());
+    }
+
+    if (has_timestamp().ValueOr(false)) {
+      emboss_reserved_local_visitor("timestamp", timestamp());
+    }
+
+    if (has_sequence().ValueOr(false)) {
+      emboss_reserved_local_visitor("sequence", sequence());
+    }
+
+    if (has_timestamp_plus_one().ValueOr(false)) {
+      emboss_reserved_local_visitor("timestamp_plus_one", timestamp_plus_one());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 10; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "id", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "delta", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "kind", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "value", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "tag", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "flags", false, false} :
+           emboss_reserved_local_index == 6 ? ::emboss::support::FieldDescriptor{
+               "samples", false, false} :
+           emboss_reserved_local_index == 7 ? ::emboss::support::FieldDescriptor{
+               "timestamp", false, false} :
+           emboss_reserved_local_index == 8 ? ::emboss::support::FieldDescriptor{
+               "sequence", false, false} :
+           emboss_reserved_local_index == 9 ? ::emboss::support::FieldDescriptor{
+               "timestamp_plus_one", true, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  using Native = EmbossReservedNativeNativeRecord;
+
+  static constexpr bool HasNativeLayout() { return EMBOSS_HAS_MAY_ALIAS && EMBOSS_SYSTEM_IS_LITTLE_ENDIAN && EMBOSS_SYSTEM_IS_TWOS_COMPLEMENT; }
+
+  template <class EmbossReservedStorage = Storage>
+  typename ::std::conditional<
+      ::std::is_const<typename ::std::remove_reference<decltype(
+          *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+      const Native *, Native *>::type
+  AsNative() const {
+    static_assert(HasNativeLayout() || sizeof(EmbossReservedStorage) == 0,
+                  "NativeRecord does not have a native layout on this system.");
+    EMBOSS_CHECK_GE(backing_.SizeInBytes(), sizeof(Native));
+    EMBOSS_CHECK_POINTER_ALIGNMENT(backing_.data(), alignof(Native), 0);
+    return reinterpret_cast<typename ::std::conditional<
+        ::std::is_const<typename ::std::remove_reference<decltype(
+            *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+        const Native *, Native *>::type>(backing_.data());
+  }
+
+
+
+  static constexpr bool IsAggregate() { return true; }
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ id() const;
+  ::emboss::support::Maybe<bool> has_id() const;
+
+ public:
+  typename ::emboss::prelude::IntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 16>>
+
+ delta() const;
+  ::emboss::support::Maybe<bool> has_delta() const;
+
+ public:
+  typename ::emboss::support::EnumView<
+    /**/ ::emboss::test::Kind,
+    ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 6>>, 8>>
+
+ kind() const;
+  ::emboss::support::Maybe<bool> has_kind() const;
+
+ public:
+  typename ::emboss::prelude::FloatView<
+    /**/ ::emboss::support::FixedSizeViewParameters<64, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 8>>, 64>>
+
+ value() const;
+  ::emboss::support::Maybe<bool> has_value() const;
+
+ public:
+  typename ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 16>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 16>, 1,
+    8 >
+
+ tag() const;
+  ::emboss::support::Maybe<bool> has_tag() const;
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 20>>, 16>>
+
+ flags() const;
+  ::emboss::support::Maybe<bool> has_flags() const;
+
+ public:
+  typename ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 24>::template OffsetStorageType</**/2, 0>>, 16>>
+
+, typename Storage::template OffsetStorageType</**/0, 24>, 2,
+    8 >
+
+ samples() const;
+  ::emboss::support::Maybe<bool> has_samples() const;
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 40>>, 32>>
+
+ timestamp() const;
+  ::emboss::support::Maybe<bool> has_timestamp() const;
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 44>>, 32>>
+
+ sequence() const;
+  ::emboss::support::Maybe<bool> has_sequence() const;
+
+ public:
+  class EmbossReservedVirtualTimestampPlusOneView final {
+   public:
+    using ValueType = ::std::int64_t;
+
+    explicit EmbossReservedVirtualTimestampPlusOneView(
+        const GenericNativeRecordView &emboss_reserved_local_view)
+        : view_(emboss_reserved_local_view) {}
+    EmbossReservedVirtualTimestampPlusOneView() = delete;
+    EmbossReservedVirtualTimestampPlusOneView(const EmbossReservedVirtualTimestampPlusOneView &) = default;
+    EmbossReservedVirtualTimestampPlusOneView(EmbossReservedVirtualTimestampPlusOneView &&) = default;
+    EmbossReservedVirtualTimestampPlusOneView &operator=(const EmbossReservedVirtualTimestampPlusOneView &) =
+        default;
+    EmbossReservedVirtualTimestampPlusOneView &operator=(EmbossReservedVirtualTimestampPlusOneView &&) =
+        default;
+    ~EmbossReservedVirtualTimestampPlusOneView() = default;
+
+    ::std::int64_t Read() const {
+      EMBOSS_CHECK(view_.has_timestamp_plus_one().ValueOr(false));
+      auto emboss_reserved_local_value = MaybeRead();
+      EMBOSS_CHECK(emboss_reserved_local_value.Known());
+      EMBOSS_CHECK(ValueIsOk(emboss_reserved_local_value.ValueOrDefault()));
+      return emboss_reserved_local_value.ValueOrDefault();
+    }
+    ::std::int64_t UncheckedRead() const {
+      return MaybeRead().ValueOrDefault();
+    }
+    bool Ok() const {
+      auto emboss_reserved_local_value = MaybeRead();
+      return emboss_reserved_local_value.Known() &&
+             ValueIsOk(emboss_reserved_local_value.ValueOrDefault());
+    }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+
+    bool TryToWrite(::std::int64_t emboss_reserved_local_value) {
+      const auto emboss_reserved_local_maybe_new_value = ::emboss::support::Difference</**/::std::int64_t, ::std::uint32_t, ::std::int64_t, ::std::int32_t>(::emboss::support::Maybe</**/decltype(emboss_reserved_local_value)>(emboss_reserved_local_value), ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(1LL)));
+      if (!CouldWriteValue(emboss_reserved_local_value)) return false;
+      return view_.timestamp().TryToWrite(
+          emboss_reserved_local_maybe_new_value.ValueOrDefault());
+    }
+    void Write(::std::int64_t emboss_reserved_local_value) {
+      const bool result = TryToWrite(emboss_reserved_local_value);
+      (void)result;
+      EMBOSS_CHECK(result);
+    }
+    void UncheckedWrite(::std::int64_t emboss_reserved_local_value) {
+      view_.timestamp().UncheckedWrite((::emboss::support::Difference</**/::std::int64_t, ::std::uint32_t, ::std::int64_t, ::std::int32_t>(::emboss::support::Maybe</**/decltype(emboss_reserved_local_value)>(emboss_reserved_local_value), ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(1LL)))).ValueOrDefault());
+    }
+    bool CouldWriteValue(::std::int64_t emboss_reserved_local_value) {
+      if (!ValueIsOk(emboss_reserved_local_value)) return false;
+      const auto emboss_reserved_local_maybe_new_value = ::emboss::support::Difference</**/::std::int64_t, ::std::uint32_t, ::std::int64_t, ::std::int32_t>(::emboss::support::Maybe</**/decltype(emboss_reserved_local_value)>(emboss_reserved_local_value), ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(1LL)));
+      if (!emboss_reserved_local_maybe_new_value.Known()) return false;
+      return view_.timestamp().CouldWriteValue(
+          emboss_reserved_local_maybe_new_value.ValueOrDefault());
+    }
+    template <class Stream>
+    bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) {
+      return ::emboss::support::ReadIntegerFromTextStream(
+          this, emboss_reserved_local_stream);
+    }
+
+
+
+   private:
+    ::emboss::support::Maybe</**/ ::std::int64_t> MaybeRead() const {
+      const auto emboss_reserved_local_subexpr_1 = view_.timestamp();
+      const auto emboss_reserved_local_subexpr_2 = (emboss_reserved_local_subexpr_1.Ok()    ? ::emboss::support::Maybe</**/::std::uint32_t>(static_cast</**/::std::uint32_t>(emboss_reserved_local_subexpr_1.UncheckedRead()))    : ::emboss::support::Maybe</**/::std::uint32_t>());
+      const auto emboss_reserved_local_subexpr_3 = ::emboss::support::Sum</**/::std::int64_t, ::std::int64_t, ::std::uint32_t, ::std::int32_t>(emboss_reserved_local_subexpr_2, ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(1LL)));
+
+      return emboss_reserved_local_subexpr_3;
+    }
+
+    static constexpr bool ValueIsOk(
+        ::std::int64_t emboss_reserved_local_value) {
+      return (void)emboss_reserved_local_value,  // Silence -Wunused-parameter
+             ::emboss::support::Maybe<bool>(true).ValueOr(false);
+    }
+
+    const GenericNativeRecordView view_;
+  };
+  EmbossReservedVirtualTimestampPlusOneView timestamp_plus_one() const;
+  ::emboss::support::Maybe<bool> has_timestamp_plus_one() const;
+
+ public:
+  class EmbossReservedDollarVirtualIntrinsicSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView() {}
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualIntrinsicSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView IntrinsicSizeInBytes() {
+    return EmbossReservedDollarVirtualIntrinsicSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_IntrinsicSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMaxSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMaxSizeInBytesView() {}
+    EmbossReservedDollarVirtualMaxSizeInBytesView(const EmbossReservedDollarVirtualMaxSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView(EmbossReservedDollarVirtualMaxSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(const EmbossReservedDollarVirtualMaxSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(EmbossReservedDollarVirtualMaxSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMaxSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMaxSizeInBytesView MaxSizeInBytes() {
+    return EmbossReservedDollarVirtualMaxSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MaxSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMinSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMinSizeInBytesView() {}
+    EmbossReservedDollarVirtualMinSizeInBytesView(const EmbossReservedDollarVirtualMinSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView(EmbossReservedDollarVirtualMinSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(const EmbossReservedDollarVirtualMinSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(EmbossReservedDollarVirtualMinSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMinSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMinSizeInBytesView MinSizeInBytes() {
+    return EmbossReservedDollarVirtualMinSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MinSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+
+
+ private:
+  Storage backing_;
+  
+  
+
+  template <class OtherStorage>
+  friend class GenericNativeRecordView;
+};
+using NativeRecordView =
+    GenericNativeRecordView</**/ ::emboss::support::ReadOnlyContiguousBuffer>;
+using NativeRecordWriter =
+    GenericNativeRecordView</**/ ::emboss::support::ReadWriteContiguousBuffer>;
+
+template <class View>
+struct EmbossReservedInternalIsGenericNativeRecordView {
+  static constexpr const bool value = false;
+};
+
+template <class Storage>
+struct EmbossReservedInternalIsGenericNativeRecordView<
+    GenericNativeRecordView<Storage>> {
+  static constexpr const bool value = true;
+};
+
+template <typename T>
+inline GenericNativeRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<
+        typename ::std::remove_reference<
+            decltype(*::std::declval<T>()->data())>::type,
+        1, 0>>
+MakeNativeRecordView( T &&emboss_reserved_local_arg) {
+  return GenericNativeRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<
+          typename ::std::remove_reference<decltype(
+              *::std::declval<T>()->data())>::type,
+          1, 0>>(
+       ::std::forward<T>(emboss_reserved_local_arg));
+}
+
+template <typename T>
+inline GenericNativeRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>
+MakeNativeRecordView( T *emboss_reserved_local_data,
+                 ::std::size_t emboss_reserved_local_size) {
+  return GenericNativeRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+template <typename T, ::std::size_t kAlignment>
+inline GenericNativeRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>
+MakeAlignedNativeRecordView(
+     T *emboss_reserved_local_data,
+    ::std::size_t emboss_reserved_local_size) {
+  return GenericNativeRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+
+
+
+namespace BigEndianNativeRecord {
+
+}  // namespace BigEndianNativeRecord
+
+
+struct EMBOSS_MAY_ALIAS EmbossReservedNativeBigEndianNativeRecord {
+  ::std::uint32_t id;
+  ::std::uint32_t value;
+};
+static_assert(sizeof(EmbossReservedNativeBigEndianNativeRecord) == 8,
+              "EmbossReservedNativeBigEndianNativeRecord does not match the layout of "
+              "BigEndianNativeRecord.");
+static_assert(offsetof(EmbossReservedNativeBigEndianNativeRecord, id) == 0,
+              "EmbossReservedNativeBigEndianNativeRecord::id is not at the same "
+              "offset as BigEndianNativeRecord::id.");
+static_assert(offsetof(EmbossReservedNativeBigEndianNativeRecord, value) == 4,
+              "EmbossReservedNativeBigEndianNativeRecord::value is not at the same "
+              "offset as BigEndianNativeRecord::value.");
+
+
+
+template <class View>
+struct EmbossReservedInternalIsGenericBigEndianNativeRecordView;
+
+template <class Storage>
+class GenericBigEndianNativeRecordView final {
+ public:
+  GenericBigEndianNativeRecordView() : backing_() {}
+  explicit GenericBigEndianNativeRecordView(
+       Storage emboss_reserved_local_bytes)
+      : backing_(emboss_reserved_local_bytes) 
+         {}
+
+  template <typename OtherStorage>
+  GenericBigEndianNativeRecordView(
+      const GenericBigEndianNativeRecordView<OtherStorage> &emboss_reserved_local_other)
+      : backing_{emboss_reserved_local_other.BackingStorage()}
+         {}
+
+  template <typename Arg,
+            typename = typename ::std::enable_if<
+                !EmbossReservedInternalIsGenericBigEndianNativeRecordView<
+                    typename ::std::remove_cv<typename ::std::remove_reference<
+                        Arg>::type>::type>::value>::type>
+  explicit GenericBigEndianNativeRecordView(
+       Arg &&emboss_reserved_local_arg)
+      : backing_(::std::forward<Arg>(
+            emboss_reserved_local_arg)) 
+         {}
+  template <typename Arg0, typename Arg1, typename... Args>
+  explicit GenericBigEndianNativeRecordView(
+       Arg0 &&emboss_reserved_local_arg0,
+      Arg1 &&emboss_reserved_local_arg1, Args &&... emboss_reserved_local_args)
+      : backing_(::std::forward<Arg0>(emboss_reserved_local_arg0),
+                 ::std::forward<Arg1>(emboss_reserved_local_arg1),
+                 ::std::forward<Args>(
+                     emboss_reserved_local_args)...) 
+         {}
+
+  template <typename OtherStorage>
+  GenericBigEndianNativeRecordView<Storage> &operator=(
+      const GenericBigEndianNativeRecordView<OtherStorage> &emboss_reserved_local_other) {
+    backing_ = emboss_reserved_local_other.BackingStorage();
+    return *this;
+  }
+
+  
+
+  bool Ok() const {
+    if (!IsComplete()) return false;
+
+    if (!has_id().Known()) return false;
+    if (has_id().ValueOrDefault() && !id().Ok()) return false;
+
+
+    if (!has_value().Known()) return false;
+    if (has_value().ValueOrDefault() && !value().Ok()) return false;
+
+
+    if (!has_IntrinsicSizeInBytes().Known()) return false;
+    if (has_IntrinsicSizeInBytes().ValueOrDefault() && !IntrinsicSizeInBytes().Ok()) return false;
+
+
+    if (!has_MaxSizeInBytes().Known()) return false;
+    if (has_MaxSizeInBytes().ValueOrDefault() && !MaxSizeInBytes().Ok()) return false;
+
+
+    if (!has_MinSizeInBytes().Known()) return false;
+    if (has_MinSizeInBytes().ValueOrDefault() && !MinSizeInBytes().Ok()) return false;
+
+
+
+    return true;
+  }
+  Storage BackingStorage() const { return backing_; }
+  bool IsComplete() const {
+    return backing_.Ok() && IntrinsicSizeInBytes().Ok() &&
+           backing_.SizeInBytes() >=
+               static_cast</**/ ::std::size_t>(
+                   IntrinsicSizeInBytes().UncheckedRead());
+  }
+  static constexpr ::std::size_t SizeInBytes() {
+    return static_cast</**/ ::std::size_t>(IntrinsicSizeInBytes().Read());
+  }
+  static constexpr bool SizeIsKnown() {
+    return IntrinsicSizeInBytes().Ok();
+  }
+
+
+  template <typename OtherStorage>
+  bool Equals(
+      GenericBigEndianNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (!has_id().Known()) return false;
+    if (!emboss_reserved_local_other.has_id().Known()) return false;
+
+    if (emboss_reserved_local_other.has_id().ValueOrDefault() &&
+        !has_id().ValueOrDefault())
+      return false;
+    if (has_id().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_id().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_id().ValueOrDefault() &&
+        has_id().ValueOrDefault() &&
+        !id().Equals(emboss_reserved_local_other.id()))
+      return false;
+
+
+
+    if (!has_value().Known()) return false;
+    if (!emboss_reserved_local_other.has_value().Known()) return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOrDefault() &&
+        !has_value().ValueOrDefault())
+      return false;
+    if (has_value().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_value().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOrDefault() &&
+        has_value().ValueOrDefault() &&
+        !value().Equals(emboss_reserved_local_other.value()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  bool UncheckedEquals(
+      GenericBigEndianNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (emboss_reserved_local_other.has_id().ValueOr(false) &&
+        !has_id().ValueOr(false))
+      return false;
+    if (has_id().ValueOr(false) &&
+        !emboss_reserved_local_other.has_id().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_id().ValueOr(false) &&
+        has_id().ValueOr(false) &&
+        !id().UncheckedEquals(emboss_reserved_local_other.id()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_value().ValueOr(false) &&
+        !has_value().ValueOr(false))
+      return false;
+    if (has_value().ValueOr(false) &&
+        !emboss_reserved_local_other.has_value().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOr(false) &&
+        has_value().ValueOr(false) &&
+        !value().UncheckedEquals(emboss_reserved_local_other.value()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  void UncheckedCopyFrom(
+      GenericBigEndianNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.UncheckedCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().UncheckedRead());
+  }
+
+  template <typename OtherStorage>
+  void CopyFrom(
+      GenericBigEndianNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.CopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+  template <typename OtherStorage>
+  bool TryToCopyFrom(
+      GenericBigEndianNativeRecordView<OtherStorage> emboss_reserved_local_other) const {
+      return emboss_reserved_local_other.Ok() && backing_.TryToCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+
+  template <class Stream>
+  bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
+    ::emboss::support::TextToken emboss_reserved_local_brace;
+    if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                      &emboss_reserved_local_brace))
+      return false;
+    if (emboss_reserved_local_brace != "{") return false;
+    for (;;) {
+      ::emboss::support::TextToken emboss_reserved_local_name;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_name))
+        return false;
+      if (emboss_reserved_local_name == ",")
+        if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                          &emboss_reserved_local_name))
+          return false;
+      if (emboss_reserved_local_name == "}") return true;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_colon))
+        return false;
+      if (emboss_reserved_local_colon != ":") return false;
+      switch (emboss_reserved_local_name.size()) {
+        case 2:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "id") {
+                if (!id().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'v':
+              if (emboss_reserved_local_name == "value") {
+                if (!value().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+  }
+
+  template <class Stream>
+  void WriteToTextStream(
+      Stream *emboss_reserved_local_stream,
+      ::emboss::TextOutputOptions emboss_reserved_local_options) const {
+    ::emboss::TextOutputOptions emboss_reserved_local_field_options =
+        emboss_reserved_local_options.PlusOneIndent();
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_stream->Write("{\n");
+    } else {
+      emboss_reserved_local_stream->Write("{");
+    }
+    bool emboss_reserved_local_wrote_field = false;
+    if (has_id().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          id().IsAggregate() || id().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("id: ");
+        id().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !id().IsAggregate() && !id().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# id: UNREADABLE\n");
+      }
+    }
+
+    if (has_value().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          value().IsAggregate() || value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("value: ");
+        value().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !value().IsAggregate() && !value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# value: UNREADABLE\n");
+      }
+    }
+
+    (void)emboss_reserved_local_wrote_field;
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
+      emboss_reserved_local_stream->Write("}");
+    } else {
+      emboss_reserved_local_stream->Write(" }");
+    }
+  }
+
+
+
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_id().ValueOr(false)) {
+      emboss_reserved_local_visitor("id", id());
+    }
+
+    if (has_value().ValueOr(false)) {
+      emboss_reserved_local_visitor("value", value());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "id", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "value", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  using Native = EmbossReservedNativeBigEndianNativeRecord;
+
+  static constexpr bool HasNativeLayout() { return EMBOSS_HAS_MAY_ALIAS && EMBOSS_SYSTEM_IS_BIG_ENDIAN; }
+
+  template <class EmbossReservedStorage = Storage>
+  typename ::std::conditional<
+      ::std::is_const<typename ::std::remove_reference<decltype(
+          *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+      const Native *, Native *>::type
+  AsNative() const {
+    static_assert(HasNativeLayout() || sizeof(EmbossReservedStorage) == 0,
+                  "BigEndianNativeRecord does not have a native layout on this system.");
+    EMBOSS_CHECK_GE(backing_.SizeInBytes(), sizeof(Native));
+    EMBOSS_CHECK_POINTER_ALIGNMENT(backing_.data(), alignof(Native), 0);
+    return reinterpret_cast<typename ::std::conditional<
+        ::std::is_const<typename ::std::remove_reference<decltype(
+            *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+        const Native *, Native *>::type>(backing_.data());
+  }
+
+
+
+  static constexpr bool IsAggregate() { return true; }
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ id() const;
+  ::emboss::support::Maybe<bool> has_id() const;
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+ value() const;
+  ::emboss::support::Maybe<bool> has_value() const;
+
+ public:
+  class EmbossReservedDollarVirtualIntrinsicSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView() {}
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualIntrinsicSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView IntrinsicSizeInBytes() {
+    return EmbossReservedDollarVirtualIntrinsicSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_IntrinsicSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMaxSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMaxSizeInBytesView() {}
+    EmbossReservedDollarVirtualMaxSizeInBytesView(const EmbossReservedDollarVirtualMaxSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView(EmbossReservedDollarVirtualMaxSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(const EmbossReservedDollarVirtualMaxSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(EmbossReservedDollarVirtualMaxSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMaxSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMaxSizeInBytesView MaxSizeInBytes() {
+    return EmbossReservedDollarVirtualMaxSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MaxSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMinSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMinSizeInBytesView() {}
+    EmbossReservedDollarVirtualMinSizeInBytesView(const EmbossReservedDollarVirtualMinSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView(EmbossReservedDollarVirtualMinSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(const EmbossReservedDollarVirtualMinSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(EmbossReservedDollarVirtualMinSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMinSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMinSizeInBytesView MinSizeInBytes() {
+    return EmbossReservedDollarVirtualMinSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MinSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+
+
+ private:
+  Storage backing_;
+  
+  
+
+  template <class OtherStorage>
+  friend class GenericBigEndianNativeRecordView;
+};
+using BigEndianNativeRecordView =
+    GenericBigEndianNativeRecordView</**/ ::emboss::support::ReadOnlyContiguousBuffer>;
+using BigEndianNativeRecordWriter =
+    GenericBigEndianNativeRecordView</**/ ::emboss::support::ReadWriteContiguousBuffer>;
+
+template <class View>
+struct EmbossReservedInternalIsGenericBigEndianNativeRecordView {
+  static constexpr const bool value = false;
+};
+
+template <class Storage>
+struct EmbossReservedInternalIsGenericBigEndianNativeRecordView<
+    GenericBigEndianNativeRecordView<Storage>> {
+  static constexpr const bool value = true;
+};
+
+template <typename T>
+inline GenericBigEndianNativeRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<
+        typename ::std::remove_reference<
+            decltype(*::std::declval<T>()->data())>::type,
+        1, 0>>
+MakeBigEndianNativeRecordView( T &&emboss_reserved_local_arg) {
+  return GenericBigEndianNativeRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<
+          typename ::std::remove_reference<decltype(
+              *::std::declval<T>()->data())>::type,
+          1, 0>>(
+       ::std::forward<T>(emboss_reserved_local_arg));
+}
+
+template <typename T>
+inline GenericBigEndianNativeRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>
+MakeBigEndianNativeRecordView( T *emboss_reserved_local_data,
+                 ::std::size_t emboss_reserved_local_size) {
+  return GenericBigEndianNativeRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+template <typename T, ::std::size_t kAlignment>
+inline GenericBigEndianNativeRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>
+MakeAlignedBigEndianNativeRecordView(
+     T *emboss_reserved_local_data,
+    ::std::size_t emboss_reserved_local_size) {
+  return GenericBigEndianNativeRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+
+
+
+namespace MisalignedRecord {
+
+}  // namespace MisalignedRecord
+
+
+
+template <class View>
+struct EmbossReservedInternalIsGenericMisalignedRecordView;
+
+template <class Storage>
+class GenericMisalignedRecordView final {
+ public:
+  GenericMisalignedRecordView() : backing_() {}
+  explicit GenericMisalignedRecordView(
+       Storage emboss_reserved_local_bytes)
+      : backing_(emboss_reserved_local_bytes) 
+         {}
+
+  template <typename OtherStorage>
+  GenericMisalignedRecordView(
+      const GenericMisalignedRecordView<OtherStorage> &emboss_reserved_local_other)
+      : backing_{emboss_reserved_local_other.BackingStorage()}
+         {}
+
+  template <typename Arg,
+            typename = typename ::std::enable_if<
+                !EmbossReservedInternalIsGenericMisalignedRecordView<
+                    typename ::std::remove_cv<typename ::std::remove_reference<
+                        Arg>::type>::type>::value>::type>
+  explicit GenericMisalignedRecordView(
+       Arg &&emboss_reserved_local_arg)
+      : backing_(::std::forward<Arg>(
+            emboss_reserved_local_arg)) 
+         {}
+  template <typename Arg0, typename Arg1, typename... Args>
+  explicit GenericMisalignedRecordView(
+       Arg0 &&emboss_reserved_local_arg0,
+      Arg1 &&emboss_reserved_local_arg1, Args &&... emboss_reserved_local_args)
+      : backing_(::std::forward<Arg0>(emboss_reserved_local_arg0),
+                 ::std::forward<Arg1>(emboss_reserved_local_arg1),
+                 ::std::forward<Args>(
+                     emboss_reserved_local_args)...) 
+         {}
+
+  template <typename OtherStorage>
+  GenericMisalignedRecordView<Storage> &operator=(
+      const GenericMisalignedRecordView<OtherStorage> &emboss_reserved_local_other) {
+    backing_ = emboss_reserved_local_other.BackingStorage();
+    return *this;
+  }
+
+  
+
+  bool Ok() const {
+    if (!IsComplete()) return false;
+
+    if (!has_short_value().Known()) return false;
+    if (has_short_value().ValueOrDefault() && !short_value().Ok()) return false;
+
+
+    if (!has_long_value().Known()) return false;
+    if (has_long_value().ValueOrDefault() && !long_value().Ok()) return false;
+
+
+    if (!has_IntrinsicSizeInBytes().Known()) return false;
+    if (has_IntrinsicSizeInBytes().ValueOrDefault() && !IntrinsicSizeInBytes().Ok()) return false;
+
+
+    if (!has_MaxSizeInBytes().Known()) return false;
+    if (has_MaxSizeInBytes().ValueOrDefault() && !MaxSizeInBytes().Ok()) return false;
+
+
+    if (!has_MinSizeInBytes().Known()) return false;
+    if (has_MinSizeInBytes().ValueOrDefault() && !MinSizeInBytes().Ok()) return false;
+
+
+
+    return true;
+  }
+  Storage BackingStorage() const { return backing_; }
+  bool IsComplete() const {
+    return backing_.Ok() && IntrinsicSizeInBytes().Ok() &&
+           backing_.SizeInBytes() >=
+               static_cast</**/ ::std::size_t>(
+                   IntrinsicSizeInBytes().UncheckedRead());
+  }
+  static constexpr ::std::size_t SizeInBytes() {
+    return static_cast</**/ ::std::size_t>(IntrinsicSizeInBytes().Read());
+  }
+  static constexpr bool SizeIsKnown() {
+    return IntrinsicSizeInBytes().Ok();
+  }
+
+
+  template <typename OtherStorage>
+  bool Equals(
+      GenericMisalignedRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (!has_short_value().Known()) return false;
+    if (!emboss_reserved_local_other.has_short_value().Known()) return false;
+
+    if (emboss_reserved_local_other.has_short_value().ValueOrDefault() &&
+        !has_short_value().ValueOrDefault())
+      return false;
+    if (has_short_value().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_short_value().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_short_value().ValueOrDefault() &&
+        has_short_value().ValueOrDefault() &&
+        !short_value().Equals(emboss_reserved_local_other.short_value()))
+      return false;
+
+
+
+    if (!has_long_value().Known()) return false;
+    if (!emboss_reserved_local_other.has_long_value().Known()) return false;
+
+    if (emboss_reserved_local_other.has_long_value().ValueOrDefault() &&
+        !has_long_value().ValueOrDefault())
+      return false;
+    if (has_long_value().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_long_value().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_long_value().ValueOrDefault() &&
+        has_long_value().ValueOrDefault() &&
+        !long_value().Equals(emboss_reserved_local_other.long_value()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  bool UncheckedEquals(
+      GenericMisalignedRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (emboss_reserved_local_other.has_short_value().ValueOr(false) &&
+        !has_short_value().ValueOr(false))
+      return false;
+    if (has_short_value().ValueOr(false) &&
+        !emboss_reserved_local_other.has_short_value().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_short_value().ValueOr(false) &&
+        has_short_value().ValueOr(false) &&
+        !short_value().UncheckedEquals(emboss_reserved_local_other.short_value()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_long_value().ValueOr(false) &&
+        !has_long_value().ValueOr(false))
+      return false;
+    if (has_long_value().ValueOr(false) &&
+        !emboss_reserved_local_other.has_long_value().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_long_value().ValueOr(false) &&
+        has_long_value().ValueOr(false) &&
+        !long_value().UncheckedEquals(emboss_reserved_local_other.long_value()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  void UncheckedCopyFrom(
+      GenericMisalignedRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.UncheckedCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().UncheckedRead());
+  }
+
+  template <typename OtherStorage>
+  void CopyFrom(
+      GenericMisalignedRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.CopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+  template <typename OtherStorage>
+  bool TryToCopyFrom(
+      GenericMisalignedRecordView<OtherStorage> emboss_reserved_local_other) const {
+      return emboss_reserved_local_other.Ok() && backing_.TryToCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+
+  template <class Stream>
+  bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
+    ::emboss::support::TextToken emboss_reserved_local_brace;
+    if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                      &emboss_reserved_local_brace))
+      return false;
+    if (emboss_reserved_local_brace != "{") return false;
+    for (;;) {
+      ::emboss::support::TextToken emboss_reserved_local_name;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_name))
+        return false;
+      if (emboss_reserved_local_name == ",")
+        if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                          &emboss_reserved_local_name))
+          return false;
+      if (emboss_reserved_local_name == "}") return true;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_colon))
+        return false;
+      if (emboss_reserved_local_colon != ":") return false;
+      switch (emboss_reserved_local_name.size()) {
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "long_value") {
+                if (!long_value().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "short_value") {
+                if (!short_value().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+  }
+
+  template <class Stream>
+  void WriteToTextStream(
+      Stream *emboss_reserved_local_stream,
+      ::emboss::TextOutputOptions emboss_reserved_local_options) const {
+    ::emboss::TextOutputOptions emboss_reserved_local_field_options =
+        emboss_reserved_local_options.PlusOneIndent();
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_stream->Write("{\n");
+    } else {
+      emboss_reserved_local_stream->Write("{");
+    }
+    bool emboss_reserved_local_wrote_field = false;
+    if (has_short_value().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          short_value().IsAggregate() || short_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("short_value: ");
+        short_value().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !short_value().IsAggregate() && !short_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# short_value: UNREADABLE\n");
+      }
+    }
+
+    if (has_long_value().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          long_value().IsAggregate() || long_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("long_value: ");
+        long_value().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !long_value().IsAggregate() && !long_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# long_value: UNREADABLE\n");
+      }
+    }
+
+    (void)emboss_reserved_local_wrote_field;
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
+      emboss_reserved_local_stream->Write("}");
+    } else {
+      emboss_reserved_local_stream->Write(" }");
+    }
+  }
+
+
+
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_short_value().ValueOr(false)) {
+      emboss_reserved_local_visitor("short_value", short_value());
+    }
+
+    if (has_long_value().ValueOr(false)) {
+      emboss_reserved_local_visitor("long_value", long_value());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "short_value", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "long_value", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
+  static constexpr bool IsAggregate() { return true; }
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 16>>
+
+ short_value() const;
+  ::emboss::support::Maybe<bool> has_short_value() const;
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 2>>, 32>>
+
+ long_value() const;
+  ::emboss::support::Maybe<bool> has_long_value() const;
+
+ public:
+  class EmbossReservedDollarVirtualIntrinsicSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView() {}
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualIntrinsicSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView IntrinsicSizeInBytes() {
+    return EmbossReservedDollarVirtualIntrinsicSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_IntrinsicSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMaxSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMaxSizeInBytesView() {}
+    EmbossReservedDollarVirtualMaxSizeInBytesView(const EmbossReservedDollarVirtualMaxSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView(EmbossReservedDollarVirtualMaxSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(const EmbossReservedDollarVirtualMaxSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(EmbossReservedDollarVirtualMaxSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMaxSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMaxSizeInBytesView MaxSizeInBytes() {
+    return EmbossReservedDollarVirtualMaxSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MaxSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMinSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMinSizeInBytesView() {}
+    EmbossReservedDollarVirtualMinSizeInBytesView(const EmbossReservedDollarVirtualMinSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView(EmbossReservedDollarVirtualMinSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(const EmbossReservedDollarVirtualMinSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(EmbossReservedDollarVirtualMinSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMinSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMinSizeInBytesView MinSizeInBytes() {
+    return EmbossReservedDollarVirtualMinSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MinSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+
+
+ private:
+  Storage backing_;
+  
+  
+
+  template <class OtherStorage>
+  friend class GenericMisalignedRecordView;
+};
+using MisalignedRecordView =
+    GenericMisalignedRecordView</**/ ::emboss::support::ReadOnlyContiguousBuffer>;
+using MisalignedRecordWriter =
+    GenericMisalignedRecordView</**/ ::emboss::support::ReadWriteContiguousBuffer>;
+
+template <class View>
+struct EmbossReservedInternalIsGenericMisalignedRecordView {
+  static constexpr const bool value = false;
+};
+
+template <class Storage>
+struct EmbossReservedInternalIsGenericMisalignedRecordView<
+    GenericMisalignedRecordView<Storage>> {
+  static constexpr const bool value = true;
+};
+
+template <typename T>
+inline GenericMisalignedRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<
+        typename ::std::remove_reference<
+            decltype(*::std::declval<T>()->data())>::type,
+        1, 0>>
+MakeMisalignedRecordView( T &&emboss_reserved_local_arg) {
+  return GenericMisalignedRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<
+          typename ::std::remove_reference<decltype(
+              *::std::declval<T>()->data())>::type,
+          1, 0>>(
+       ::std::forward<T>(emboss_reserved_local_arg));
+}
+
+template <typename T>
+inline GenericMisalignedRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>
+MakeMisalignedRecordView( T *emboss_reserved_local_data,
+                 ::std::size_t emboss_reserved_local_size) {
+  return GenericMisalignedRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+template <typename T, ::std::size_t kAlignment>
+inline GenericMisalignedRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>
+MakeAlignedMisalignedRecordView(
+     T *emboss_reserved_local_data,
+    ::std::size_t emboss_reserved_local_size) {
+  return GenericMisalignedRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+
+
+
+namespace MixedEndianRecord {
+
+}  // namespace MixedEndianRecord
+
+
+
+template <class View>
+struct EmbossReservedInternalIsGenericMixedEndianRecordView;
+
+template <class Storage>
+class GenericMixedEndianRecordView final {
+ public:
+  GenericMixedEndianRecordView() : backing_() {}
+  explicit GenericMixedEndianRecordView(
+       Storage emboss_reserved_local_bytes)
+      : backing_(emboss_reserved_local_bytes) 
+         {}
+
+  template <typename OtherStorage>
+  GenericMixedEndianRecordView(
+      const GenericMixedEndianRecordView<OtherStorage> &emboss_reserved_local_other)
+      : backing_{emboss_reserved_local_other.BackingStorage()}
+         {}
+
+  template <typename Arg,
+            typename = typename ::std::enable_if<
+                !EmbossReservedInternalIsGenericMixedEndianRecordView<
+                    typename ::std::remove_cv<typename ::std::remove_reference<
+                        Arg>::type>::type>::value>::type>
+  explicit GenericMixedEndianRecordView(
+       Arg &&emboss_reserved_local_arg)
+      : backing_(::std::forward<Arg>(
+            emboss_reserved_local_arg)) 
+         {}
+  template <typename Arg0, typename Arg1, typename... Args>
+  explicit GenericMixedEndianRecordView(
+       Arg0 &&emboss_reserved_local_arg0,
+      Arg1 &&emboss_reserved_local_arg1, Args &&... emboss_reserved_local_args)
+      : backing_(::std::forward<Arg0>(emboss_reserved_local_arg0),
+                 ::std::forward<Arg1>(emboss_reserved_local_arg1),
+                 ::std::forward<Args>(
+                     emboss_reserved_local_args)...) 
+         {}
+
+  template <typename OtherStorage>
+  GenericMixedEndianRecordView<Storage> &operator=(
+      const GenericMixedEndianRecordView<OtherStorage> &emboss_reserved_local_other) {
+    backing_ = emboss_reserved_local_other.BackingStorage();
+    return *this;
+  }
+
+  
+
+  bool Ok() const {
+    if (!IsComplete()) return false;
+
+    if (!has_little_endian_value().Known()) return false;
+    if (has_little_endian_value().ValueOrDefault() && !little_endian_value().Ok()) return false;
+
+
+    if (!has_big_endian_value().Known()) return false;
+    if (has_big_endian_value().ValueOrDefault() && !big_endian_value().Ok()) return false;
+
+
+    if (!has_IntrinsicSizeInBytes().Known()) return false;
+    if (has_IntrinsicSizeInBytes().ValueOrDefault() && !IntrinsicSizeInBytes().Ok()) return false;
+
+
+    if (!has_MaxSizeInBytes().Known()) return false;
+    if (has_MaxSizeInBytes().ValueOrDefault() && !MaxSizeInBytes().Ok()) return false;
+
+
+    if (!has_MinSizeInBytes().Known()) return false;
+    if (has_MinSizeInBytes().ValueOrDefault() && !MinSizeInBytes().Ok()) return false;
+
+
+
+    return true;
+  }
+  Storage BackingStorage() const { return backing_; }
+  bool IsComplete() const {
+    return backing_.Ok() && IntrinsicSizeInBytes().Ok() &&
+           backing_.SizeInBytes() >=
+               static_cast</**/ ::std::size_t>(
+                   IntrinsicSizeInBytes().UncheckedRead());
+  }
+  static constexpr ::std::size_t SizeInBytes() {
+    return static_cast</**/ ::std::size_t>(IntrinsicSizeInBytes().Read());
+  }
+  static constexpr bool SizeIsKnown() {
+    return IntrinsicSizeInBytes().Ok();
+  }
+
+
+  template <typename OtherStorage>
+  bool Equals(
+      GenericMixedEndianRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (!has_little_endian_value().Known()) return false;
+    if (!emboss_reserved_local_other.has_little_endian_value().Known()) return false;
+
+    if (emboss_reserved_local_other.has_little_endian_value().ValueOrDefault() &&
+        !has_little_endian_value().ValueOrDefault())
+      return false;
+    if (has_little_endian_value().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_little_endian_value().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_little_endian_value().ValueOrDefault() &&
+        has_little_endian_value().ValueOrDefault() &&
+        !little_endian_value().Equals(emboss_reserved_local_other.little_endian_value()))
+      return false;
+
+
+
+    if (!has_big_endian_value().Known()) return false;
+    if (!emboss_reserved_local_other.has_big_endian_value().Known()) return false;
+
+    if (emboss_reserved_local_other.has_big_endian_value().ValueOrDefault() &&
+        !has_big_endian_value().ValueOrDefault())
+      return false;
+    if (has_big_endian_value().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_big_endian_value().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_big_endian_value().ValueOrDefault() &&
+        has_big_endian_value().ValueOrDefault() &&
+        !big_endian_value().Equals(emboss_reserved_local_other.big_endian_value()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  bool UncheckedEquals(
+      GenericMixedEndianRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (emboss_reserved_local_other.has_little_endian_value().ValueOr(false) &&
+        !has_little_endian_value().ValueOr(false))
+      return false;
+    if (has_little_endian_value().ValueOr(false) &&
+        !emboss_reserved_local_other.has_little_endian_value().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_little_endian_value().ValueOr(false) &&
+        has_little_endian_value().ValueOr(false) &&
+        !little_endian_value().UncheckedEquals(emboss_reserved_local_other.little_endian_value()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_big_endian_value().ValueOr(false) &&
+        !has_big_endian_value().ValueOr(false))
+      return false;
+    if (has_big_endian_value().ValueOr(false) &&
+        !emboss_reserved_local_other.has_big_endian_value().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_big_endian_value().ValueOr(false) &&
+        has_big_endian_value().ValueOr(false) &&
+        !big_endian_value().UncheckedEquals(emboss_reserved_local_other.big_endian_value()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  void UncheckedCopyFrom(
+      GenericMixedEndianRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.UncheckedCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().UncheckedRead());
+  }
+
+  template <typename OtherStorage>
+  void CopyFrom(
+      GenericMixedEndianRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.CopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+  template <typename OtherStorage>
+  bool TryToCopyFrom(
+      GenericMixedEndianRecordView<OtherStorage> emboss_reserved_local_other) const {
+      return emboss_reserved_local_other.Ok() && backing_.TryToCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+
+  template <class Stream>
+  bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
+    ::emboss::support::TextToken emboss_reserved_local_brace;
+    if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                      &emboss_reserved_local_brace))
+      return false;
+    if (emboss_reserved_local_brace != "{") return false;
+    for (;;) {
+      ::emboss::support::TextToken emboss_reserved_local_name;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_name))
+        return false;
+      if (emboss_reserved_local_name == ",")
+        if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                          &emboss_reserved_local_name))
+          return false;
+      if (emboss_reserved_local_name == "}") return true;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_colon))
+        return false;
+      if (emboss_reserved_local_colon != ":") return false;
+      switch (emboss_reserved_local_name.size()) {
+        case 16:
+          switch (emboss_reserved_local_name[0]) {
+            case 'b':
+              if (emboss_reserved_local_name == "big_endian_value") {
+                if (!big_endian_value().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 19:
+          switch (emboss_reserved_local_name[0]) {
+            case 'l':
+              if (emboss_reserved_local_name == "little_endian_value") {
+                if (!little_endian_value().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+  }
+
+  template <class Stream>
+  void WriteToTextStream(
+      Stream *emboss_reserved_local_stream,
+      ::emboss::TextOutputOptions emboss_reserved_local_options) const {
+    ::emboss::TextOutputOptions emboss_reserved_local_field_options =
+        emboss_reserved_local_options.PlusOneIndent();
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_stream->Write("{\n");
+    } else {
+      emboss_reserved_local_stream->Write("{");
+    }
+    bool emboss_reserved_local_wrote_field = false;
+    if (has_little_endian_value().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          little_endian_value().IsAggregate() || little_endian_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("little_endian_value: ");
+        little_endian_value().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !little_endian_value().IsAggregate() && !little_endian_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# little_endian_value: UNREADABLE\n");
+      }
+    }
+
+    if (has_big_endian_value().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          big_endian_value().IsAggregate() || big_endian_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("big_endian_value: ");
+        big_endian_value().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !big_endian_value().IsAggregate() && !big_endian_value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# big_endian_value: UNREADABLE\n");
+      }
+    }
+
+    (void)emboss_reserved_local_wrote_field;
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
+      emboss_reserved_local_stream->Write("}");
+    } else {
+      emboss_reserved_local_stream->Write(" }");
+    }
+  }
+
+
+
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_little_endian_value().ValueOr(false)) {
+      emboss_reserved_local_visitor("little_endian_value", little_endian_value());
+    }
+
+    if (has_big_endian_value().ValueOr(false)) {
+      emboss_reserved_local_visitor("big_endian_value", big_endian_value());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "little_endian_value", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "big_endian_value", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
+  static constexpr bool IsAggregate() { return true; }
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ little_endian_value() const;
+  ::emboss::support::Maybe<bool> has_little_endian_value() const;
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+ big_endian_value() const;
+  ::emboss::support::Maybe<bool> has_big_endian_value() const;
+
+ public:
+  class EmbossReservedDollarVirtualIntrinsicSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView() {}
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualIntrinsicSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView IntrinsicSizeInBytes() {
+    return EmbossReservedDollarVirtualIntrinsicSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_IntrinsicSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMaxSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMaxSizeInBytesView() {}
+    EmbossReservedDollarVirtualMaxSizeInBytesView(const EmbossReservedDollarVirtualMaxSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView(EmbossReservedDollarVirtualMaxSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(const EmbossReservedDollarVirtualMaxSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(EmbossReservedDollarVirtualMaxSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMaxSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMaxSizeInBytesView MaxSizeInBytes() {
+    return EmbossReservedDollarVirtualMaxSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MaxSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMinSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMinSizeInBytesView() {}
+    EmbossReservedDollarVirtualMinSizeInBytesView(const EmbossReservedDollarVirtualMinSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView(EmbossReservedDollarVirtualMinSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(const EmbossReservedDollarVirtualMinSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(EmbossReservedDollarVirtualMinSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMinSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMinSizeInBytesView MinSizeInBytes() {
+    return EmbossReservedDollarVirtualMinSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MinSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+
+
+ private:
+  Storage backing_;
+  
+  
+
+  template <class OtherStorage>
+  friend class GenericMixedEndianRecordView;
+};
+using MixedEndianRecordView =
+    GenericMixedEndianRecordView</**/ ::emboss::support::ReadOnlyContiguousBuffer>;
+using MixedEndianRecordWriter =
+    GenericMixedEndianRecordView</**/ ::emboss::support::ReadWriteContiguousBuffer>;
+
+template <class View>
+struct EmbossReservedInternalIsGenericMixedEndianRecordView {
+  static constexpr const bool value = false;
+};
+
+template <class Storage>
+struct EmbossReservedInternalIsGenericMixedEndianRecordView<
+    GenericMixedEndianRecordView<Storage>> {
+  static constexpr const bool value = true;
+};
+
+template <typename T>
+inline GenericMixedEndianRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<
+        typename ::std::remove_reference<
+            decltype(*::std::declval<T>()->data())>::type,
+        1, 0>>
+MakeMixedEndianRecordView( T &&emboss_reserved_local_arg) {
+  return GenericMixedEndianRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<
+          typename ::std::remove_reference<decltype(
+              *::std::declval<T>()->data())>::type,
+          1, 0>>(
+       ::std::forward<T>(emboss_reserved_local_arg));
+}
+
+template <typename T>
+inline GenericMixedEndianRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>
+MakeMixedEndianRecordView( T *emboss_reserved_local_data,
+                 ::std::size_t emboss_reserved_local_size) {
+  return GenericMixedEndianRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+template <typename T, ::std::size_t kAlignment>
+inline GenericMixedEndianRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>
+MakeAlignedMixedEndianRecordView(
+     T *emboss_reserved_local_data,
+    ::std::size_t emboss_reserved_local_size) {
+  return GenericMixedEndianRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+
+
+
+namespace OverlappingRecord {
+
+}  // namespace OverlappingRecord
+
+
+
+template <class View>
+struct EmbossReservedInternalIsGenericOverlappingRecordView;
+
+template <class Storage>
+class GenericOverlappingRecordView final {
+ public:
+  GenericOverlappingRecordView() : backing_() {}
+  explicit GenericOverlappingRecordView(
+       Storage emboss_reserved_local_bytes)
+      : backing_(emboss_reserved_local_bytes) 
+         {}
+
+  template <typename OtherStorage>
+  GenericOverlappingRecordView(
+      const GenericOverlappingRecordView<OtherStorage> &emboss_reserved_local_other)
+      : backing_{emboss_reserved_local_other.BackingStorage()}
+         {}
+
+  template <typename Arg,
+            typename = typename ::std::enable_if<
+                !EmbossReservedInternalIsGenericOverlappingRecordView<
+                    typename ::std::remove_cv<typename ::std::remove_reference<
+                        Arg>::type>::type>::value>::type>
+  explicit GenericOverlappingRecordView(
+       Arg &&emboss_reserved_local_arg)
+      : backing_(::std::forward<Arg>(
+            emboss_reserved_local_arg)) 
+         {}
+  template <typename Arg0, typename Arg1, typename... Args>
+  explicit GenericOverlappingRecordView(
+       Arg0 &&emboss_reserved_local_arg0,
+      Arg1 &&emboss_reserved_local_arg1, Args &&... emboss_reserved_local_args)
+      : backing_(::std::forward<Arg0>(emboss_reserved_local_arg0),
+                 ::std::forward<Arg1>(emboss_reserved_local_arg1),
+                 ::std::forward<Args>(
+                     emboss_reserved_local_args)...) 
+         {}
+
+  template <typename OtherStorage>
+  GenericOverlappingRecordView<Storage> &operator=(
+      const GenericOverlappingRecordView<OtherStorage> &emboss_reserved_local_other) {
+    backing_ = emboss_reserved_local_other.BackingStorage();
+    return *this;
+  }
+
+  
+
+  bool Ok() const {
+    if (!IsComplete()) return false;
+
+    if (!has_value().Known()) return false;
+    if (has_value().ValueOrDefault() && !value().Ok()) return false;
+
+
+    if (!has_value_bytes().Known()) return false;
+    if (has_value_bytes().ValueOrDefault() && !value_bytes().Ok()) return false;
+
+
+    if (!has_IntrinsicSizeInBytes().Known()) return false;
+    if (has_IntrinsicSizeInBytes().ValueOrDefault() && !IntrinsicSizeInBytes().Ok()) return false;
+
+
+    if (!has_MaxSizeInBytes().Known()) return false;
+    if (has_MaxSizeInBytes().ValueOrDefault() && !MaxSizeInBytes().Ok()) return false;
+
+
+    if (!has_MinSizeInBytes().Known()) return false;
+    if (has_MinSizeInBytes().ValueOrDefault() && !MinSizeInBytes().Ok()) return false;
+
+
+
+    return true;
+  }
+  Storage BackingStorage() const { return backing_; }
+  bool IsComplete() const {
+    return backing_.Ok() && IntrinsicSizeInBytes().Ok() &&
+           backing_.SizeInBytes() >=
+               static_cast</**/ ::std::size_t>(
+                   IntrinsicSizeInBytes().UncheckedRead());
+  }
+  static constexpr ::std::size_t SizeInBytes() {
+    return static_cast</**/ ::std::size_t>(IntrinsicSizeInBytes().Read());
+  }
+  static constexpr bool SizeIsKnown() {
+    return IntrinsicSizeInBytes().Ok();
+  }
+
+
+  template <typename OtherStorage>
+  bool Equals(
+      GenericOverlappingRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (!has_value().Known()) return false;
+    if (!emboss_reserved_local_other.has_value().Known()) return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOrDefault() &&
+        !has_value().ValueOrDefault())
+      return false;
+    if (has_value().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_value().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOrDefault() &&
+        has_value().ValueOrDefault() &&
+        !value().Equals(emboss_reserved_local_other.value()))
+      return false;
+
+
+
+    if (!has_value_bytes().Known()) return false;
+    if (!emboss_reserved_local_other.has_value_bytes().Known()) return false;
+
+    if (emboss_reserved_local_other.has_value_bytes().ValueOrDefault() &&
+        !has_value_bytes().ValueOrDefault())
+      return false;
+    if (has_value_bytes().ValueOrDefault() &&
+        !emboss_reserved_local_other.has_value_bytes().ValueOrDefault())
+      return false;
+
+    if (emboss_reserved_local_other.has_value_bytes().ValueOrDefault() &&
+        has_value_bytes().ValueOrDefault() &&
+        !value_bytes().Equals(emboss_reserved_local_other.value_bytes()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  bool UncheckedEquals(
+      GenericOverlappingRecordView<OtherStorage> emboss_reserved_local_other) const {
+    
+    if (emboss_reserved_local_other.has_value().ValueOr(false) &&
+        !has_value().ValueOr(false))
+      return false;
+    if (has_value().ValueOr(false) &&
+        !emboss_reserved_local_other.has_value().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_value().ValueOr(false) &&
+        has_value().ValueOr(false) &&
+        !value().UncheckedEquals(emboss_reserved_local_other.value()))
+      return false;
+
+
+
+    if (emboss_reserved_local_other.has_value_bytes().ValueOr(false) &&
+        !has_value_bytes().ValueOr(false))
+      return false;
+    if (has_value_bytes().ValueOr(false) &&
+        !emboss_reserved_local_other.has_value_bytes().ValueOr(false))
+      return false;
+
+    if (emboss_reserved_local_other.has_value_bytes().ValueOr(false) &&
+        has_value_bytes().ValueOr(false) &&
+        !value_bytes().UncheckedEquals(emboss_reserved_local_other.value_bytes()))
+      return false;
+
+ return true;
+  }
+  template <typename OtherStorage>
+  void UncheckedCopyFrom(
+      GenericOverlappingRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.UncheckedCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().UncheckedRead());
+  }
+
+  template <typename OtherStorage>
+  void CopyFrom(
+      GenericOverlappingRecordView<OtherStorage> emboss_reserved_local_other) const {
+    backing_.CopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+  template <typename OtherStorage>
+  bool TryToCopyFrom(
+      GenericOverlappingRecordView<OtherStorage> emboss_reserved_local_other) const {
+      return emboss_reserved_local_other.Ok() && backing_.TryToCopyFrom(
+        emboss_reserved_local_other.BackingStorage(),
+        emboss_reserved_local_other.IntrinsicSizeInBytes().Read());
+  }
+
+  template <class Stream>
+  bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
+    ::emboss::support::TextToken emboss_reserved_local_brace;
+    if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                      &emboss_reserved_local_brace))
+      return false;
+    if (emboss_reserved_local_brace != "{") return false;
+    for (;;) {
+      ::emboss::support::TextToken emboss_reserved_local_name;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_name))
+        return false;
+      if (emboss_reserved_local_name == ",")
+        if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                          &emboss_reserved_local_name))
+          return false;
+      if (emboss_reserved_local_name == "}") return true;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
+      if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
+                                        &emboss_reserved_local_colon))
+        return false;
+      if (emboss_reserved_local_colon != ":") return false;
+      switch (emboss_reserved_local_name.size()) {
+        case 5:
+          switch (emboss_reserved_local_name[0]) {
+            case 'v':
+              if (emboss_reserved_local_name == "value") {
+                if (!value().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 11:
+          switch (emboss_reserved_local_name[0]) {
+            case 'v':
+              if (emboss_reserved_local_name == "value_bytes") {
+                if (!value_bytes().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+  }
+
+  template <class Stream>
+  void WriteToTextStream(
+      Stream *emboss_reserved_local_stream,
+      ::emboss::TextOutputOptions emboss_reserved_local_options) const {
+    ::emboss::TextOutputOptions emboss_reserved_local_field_options =
+        emboss_reserved_local_options.PlusOneIndent();
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_stream->Write("{\n");
+    } else {
+      emboss_reserved_local_stream->Write("{");
+    }
+    bool emboss_reserved_local_wrote_field = false;
+    if (has_value().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          value().IsAggregate() || value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("value: ");
+        value().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !value().IsAggregate() && !value().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# value: UNREADABLE\n");
+      }
+    }
+
+    if (has_value_bytes().ValueOr(false)) {
+      if (!emboss_reserved_local_field_options.allow_partial_output() ||
+          value_bytes().IsAggregate() || value_bytes().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        } else {
+          if (emboss_reserved_local_wrote_field) {
+            emboss_reserved_local_stream->Write(",");
+          }
+          emboss_reserved_local_stream->Write(" ");
+        }
+        emboss_reserved_local_stream->Write("value_bytes: ");
+        value_bytes().WriteToTextStream(emboss_reserved_local_stream,
+                                           emboss_reserved_local_field_options);
+        emboss_reserved_local_wrote_field = true;
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_stream->Write("\n");
+        }
+      } else if (emboss_reserved_local_field_options.allow_partial_output() &&
+                 emboss_reserved_local_field_options.comments() &&
+                 !value_bytes().IsAggregate() && !value_bytes().Ok()) {
+        if (emboss_reserved_local_field_options.multiline()) {
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
+        }
+        emboss_reserved_local_stream->Write("# value_bytes: UNREADABLE\n");
+      }
+    }
+
+    (void)emboss_reserved_local_wrote_field;
+    if (emboss_reserved_local_options.multiline()) {
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
+      emboss_reserved_local_stream->Write("}");
+    } else {
+      emboss_reserved_local_stream->Write(" }");
+    }
+  }
+
+
+
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_value().ValueOr(false)) {
+      emboss_reserved_local_visitor("value", value());
+    }
+
+    if (has_value_bytes().ValueOr(false)) {
+      emboss_reserved_local_visitor("value_bytes", value_bytes());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 2; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "value", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "value_bytes", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
+  static constexpr bool IsAggregate() { return true; }
+
+ public:
+  typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ value() const;
+  ::emboss::support::Maybe<bool> has_value() const;
+
+ public:
+  typename ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 0>, 1,
+    8 >
+
+ value_bytes() const;
+  ::emboss::support::Maybe<bool> has_value_bytes() const;
+
+ public:
+  class EmbossReservedDollarVirtualIntrinsicSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView() {}
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(const EmbossReservedDollarVirtualIntrinsicSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualIntrinsicSizeInBytesView &operator=(EmbossReservedDollarVirtualIntrinsicSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualIntrinsicSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualIntrinsicSizeInBytesView IntrinsicSizeInBytes() {
+    return EmbossReservedDollarVirtualIntrinsicSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_IntrinsicSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMaxSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMaxSizeInBytesView() {}
+    EmbossReservedDollarVirtualMaxSizeInBytesView(const EmbossReservedDollarVirtualMaxSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView(EmbossReservedDollarVirtualMaxSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(const EmbossReservedDollarVirtualMaxSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMaxSizeInBytesView &operator=(EmbossReservedDollarVirtualMaxSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMaxSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMaxSizeInBytesView MaxSizeInBytes() {
+    return EmbossReservedDollarVirtualMaxSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MaxSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+ public:
+  class EmbossReservedDollarVirtualMinSizeInBytesView final {
+   public:
+    using ValueType = ::std::int32_t;
+
+    constexpr EmbossReservedDollarVirtualMinSizeInBytesView() {}
+    EmbossReservedDollarVirtualMinSizeInBytesView(const EmbossReservedDollarVirtualMinSizeInBytesView &) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView(EmbossReservedDollarVirtualMinSizeInBytesView &&) = default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(const EmbossReservedDollarVirtualMinSizeInBytesView &) =
+        default;
+    EmbossReservedDollarVirtualMinSizeInBytesView &operator=(EmbossReservedDollarVirtualMinSizeInBytesView &&) =
+        default;
+    ~EmbossReservedDollarVirtualMinSizeInBytesView() = default;
+
+    static constexpr ::std::int32_t Read();
+    static constexpr ::std::int32_t UncheckedRead();
+    static constexpr bool Ok() { return true; }
+    template <class Stream>
+    void WriteToTextStream(Stream *emboss_reserved_local_stream,
+                           const ::emboss::TextOutputOptions
+                               &emboss_reserved_local_options) const {
+      ::emboss::support::WriteIntegerViewToTextStream(
+          this, emboss_reserved_local_stream, emboss_reserved_local_options);
+    }
+
+    static constexpr bool IsAggregate() { return false; }
+  };
+
+  static constexpr EmbossReservedDollarVirtualMinSizeInBytesView MinSizeInBytes() {
+    return EmbossReservedDollarVirtualMinSizeInBytesView();
+  }
+  static constexpr ::emboss::support::Maybe<bool> has_MinSizeInBytes() {
+    return ::emboss::support::Maybe<bool>(true);
+  }
+
+
+
+ private:
+  Storage backing_;
+  
+  
+
+  template <class OtherStorage>
+  friend class GenericOverlappingRecordView;
+};
+using OverlappingRecordView =
+    GenericOverlappingRecordView</**/ ::emboss::support::ReadOnlyContiguousBuffer>;
+using OverlappingRecordWriter =
+    GenericOverlappingRecordView</**/ ::emboss::support::ReadWriteContiguousBuffer>;
+
+template <class View>
+struct EmbossReservedInternalIsGenericOverlappingRecordView {
+  static constexpr const bool value = false;
+};
+
+template <class Storage>
+struct EmbossReservedInternalIsGenericOverlappingRecordView<
+    GenericOverlappingRecordView<Storage>> {
+  static constexpr const bool value = true;
+};
+
+template <typename T>
+inline GenericOverlappingRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<
+        typename ::std::remove_reference<
+            decltype(*::std::declval<T>()->data())>::type,
+        1, 0>>
+MakeOverlappingRecordView( T &&emboss_reserved_local_arg) {
+  return GenericOverlappingRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<
+          typename ::std::remove_reference<decltype(
+              *::std::declval<T>()->data())>::type,
+          1, 0>>(
+       ::std::forward<T>(emboss_reserved_local_arg));
+}
+
+template <typename T>
+inline GenericOverlappingRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>
+MakeOverlappingRecordView( T *emboss_reserved_local_data,
+                 ::std::size_t emboss_reserved_local_size) {
+  return GenericOverlappingRecordView</**/ ::emboss::support::ContiguousBuffer<T, 1, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+
+template <typename T, ::std::size_t kAlignment>
+inline GenericOverlappingRecordView<
+    /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>
+MakeAlignedOverlappingRecordView(
+     T *emboss_reserved_local_data,
+    ::std::size_t emboss_reserved_local_size) {
+  return GenericOverlappingRecordView<
+      /**/ ::emboss::support::ContiguousBuffer<T, kAlignment, 0>>(
+       emboss_reserved_local_data,
+      emboss_reserved_local_size);
+}
+enum class Kind : ::std::uint8_t {
+  APPLE = static_cast</**/::std::int32_t>(1LL),
+  BANANA = static_cast</**/::std::int32_t>(2LL),
+
+};
+template <class Enum>
+class EnumTraits;
+
+template <>
+class EnumTraits<Kind> final {
+ public:
+  static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
+                                   Kind *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name == nullptr) return false;
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      Kind *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 5 &&
+        !memcmp("APPLE", emboss_reserved_local_name, 5)) {
+      *emboss_reserved_local_result = Kind::APPLE;
+      return true;
+    }
+
+    if (emboss_reserved_local_name_size == 6 &&
+        !memcmp("BANANA", emboss_reserved_local_name, 6)) {
+      *emboss_reserved_local_result = Kind::BANANA;
+      return true;
+    }
+
+    return false;
+  }
+
+  static const char *TryToGetNameFromEnum(
+      Kind emboss_reserved_local_value) {
+    switch (emboss_reserved_local_value) {
+      case Kind::APPLE: return "APPLE";
+
+      case Kind::BANANA: return "BANANA";
+
+      default: return nullptr;
+    }
+  }
+
+  static bool EnumIsKnown(Kind emboss_reserved_local_value) {
+    switch (emboss_reserved_local_value) {
+      case Kind::APPLE: return true;
+
+      case Kind::BANANA: return true;
+
+      default:
+        return false;
+    }
+  }
+
+  static ::std::ostream &SendToOstream(::std::ostream &emboss_reserved_local_os,
+                                       Kind emboss_reserved_local_value) {
+    const char *emboss_reserved_local_name =
+        TryToGetNameFromEnum(emboss_reserved_local_value);
+    if (emboss_reserved_local_name == nullptr) {
+      emboss_reserved_local_os
+          << static_cast</**/ ::std::underlying_type<Kind>::type>(
+                 emboss_reserved_local_value);
+    } else {
+      emboss_reserved_local_os << emboss_reserved_local_name;
+    }
+    return emboss_reserved_local_os;
+  }
+};
+
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    Kind *emboss_reserved_local_result) {
+  return EnumTraits<Kind>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_result);
+}
+
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    Kind *emboss_reserved_local_result) {
+  return EnumTraits<Kind>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
+static inline const char *TryToGetNameFromEnum(
+    Kind emboss_reserved_local_value) {
+  return EnumTraits<Kind>::TryToGetNameFromEnum(
+      emboss_reserved_local_value);
+}
+
+static inline bool EnumIsKnown(Kind emboss_reserved_local_value) {
+  return EnumTraits<Kind>::EnumIsKnown(emboss_reserved_local_value);
+}
+
+static inline ::std::ostream &operator<<(
+    ::std::ostream &emboss_reserved_local_os,
+    Kind emboss_reserved_local_value) {
+  return EnumTraits<Kind>::SendToOstream(emboss_reserved_local_os,
+                                             emboss_reserved_local_value);
+}
+
+namespace NativeRecord {
+
+}  // namespace NativeRecord
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ GenericNativeRecordView<Storage>::id()
+    const {
+
+  if ( has_id().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(0LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   0>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_id() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::IntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 16>>
+
+ GenericNativeRecordView<Storage>::delta()
+    const {
+
+  if ( has_delta().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(2LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::IntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 16>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   4>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::IntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 16>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_delta() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::support::EnumView<
+    /**/ ::emboss::test::Kind,
+    ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 6>>, 8>>
+
+ GenericNativeRecordView<Storage>::kind()
+    const {
+
+  if ( has_kind().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(1LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(6LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::support::EnumView<
+    /**/ ::emboss::test::Kind,
+    ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 6>>, 8>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   6>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::support::EnumView<
+    /**/ ::emboss::test::Kind,
+    ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 6>>, 8>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_kind() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::FloatView<
+    /**/ ::emboss::support::FixedSizeViewParameters<64, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 8>>, 64>>
+
+ GenericNativeRecordView<Storage>::value()
+    const {
+
+  if ( has_value().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::FloatView<
+    /**/ ::emboss::support::FixedSizeViewParameters<64, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 8>>, 64>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   8>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::FloatView<
+    /**/ ::emboss::support::FixedSizeViewParameters<64, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 8>>, 64>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_value() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 16>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 16>, 1,
+    8 >
+
+ GenericNativeRecordView<Storage>::tag()
+    const {
+
+  if ( has_tag().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(16LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 16>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 16>, 1,
+    8 >
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   16>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 16>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 16>, 1,
+    8 >
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_tag() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 20>>, 16>>
+
+ GenericNativeRecordView<Storage>::flags()
+    const {
+
+  if ( has_flags().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(2LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(20LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 20>>, 16>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   20>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 20>>, 16>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_flags() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 24>::template OffsetStorageType</**/2, 0>>, 16>>
+
+, typename Storage::template OffsetStorageType</**/0, 24>, 2,
+    8 >
+
+ GenericNativeRecordView<Storage>::samples()
+    const {
+
+  if ( has_samples().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(24LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 24>::template OffsetStorageType</**/2, 0>>, 16>>
+
+, typename Storage::template OffsetStorageType</**/0, 24>, 2,
+    8 >
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   24>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 24>::template OffsetStorageType</**/2, 0>>, 16>>
+
+, typename Storage::template OffsetStorageType</**/0, 24>, 2,
+    8 >
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_samples() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 40>>, 32>>
+
+ GenericNativeRecordView<Storage>::timestamp()
+    const {
+
+  if ( has_timestamp().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(40LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 40>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   40>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 40>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_timestamp() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 44>>, 32>>
+
+ GenericNativeRecordView<Storage>::sequence()
+    const {
+
+  if ( has_sequence().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(44LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 44>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   44>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 44>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_sequence() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename GenericNativeRecordView<Storage>::EmbossReservedVirtualTimestampPlusOneView
+GenericNativeRecordView<Storage>::timestamp_plus_one() const {
+  return
+      typename GenericNativeRecordView<Storage>::EmbossReservedVirtualTimestampPlusOneView(
+          *this);
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericNativeRecordView<Storage>::has_timestamp_plus_one() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+namespace NativeRecord {
+inline constexpr ::std::int32_t IntrinsicSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(48LL)).ValueOrDefault();
+}
+}  // namespace NativeRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericNativeRecordView<Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::Read() {
+  return NativeRecord::IntrinsicSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericNativeRecordView<
+    Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::UncheckedRead() {
+  return NativeRecord::IntrinsicSizeInBytes();
+}
+
+namespace NativeRecord {
+inline constexpr ::std::int32_t MaxSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(48LL)).ValueOrDefault();
+}
+}  // namespace NativeRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericNativeRecordView<Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::Read() {
+  return NativeRecord::MaxSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericNativeRecordView<
+    Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::UncheckedRead() {
+  return NativeRecord::MaxSizeInBytes();
+}
+
+namespace NativeRecord {
+inline constexpr ::std::int32_t MinSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(48LL)).ValueOrDefault();
+}
+}  // namespace NativeRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericNativeRecordView<Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::Read() {
+  return NativeRecord::MinSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericNativeRecordView<
+    Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::UncheckedRead() {
+  return NativeRecord::MinSizeInBytes();
+}
+namespace BigEndianNativeRecord {
+
+}  // namespace BigEndianNativeRecord
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ GenericBigEndianNativeRecordView<Storage>::id()
+    const {
+
+  if ( has_id().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(0LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   0>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericBigEndianNativeRecordView<Storage>::has_id() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+ GenericBigEndianNativeRecordView<Storage>::value()
+    const {
+
+  if ( has_value().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   4>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericBigEndianNativeRecordView<Storage>::has_value() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+namespace BigEndianNativeRecord {
+inline constexpr ::std::int32_t IntrinsicSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL)).ValueOrDefault();
+}
+}  // namespace BigEndianNativeRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericBigEndianNativeRecordView<Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::Read() {
+  return BigEndianNativeRecord::IntrinsicSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericBigEndianNativeRecordView<
+    Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::UncheckedRead() {
+  return BigEndianNativeRecord::IntrinsicSizeInBytes();
+}
+
+namespace BigEndianNativeRecord {
+inline constexpr ::std::int32_t MaxSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL)).ValueOrDefault();
+}
+}  // namespace BigEndianNativeRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericBigEndianNativeRecordView<Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::Read() {
+  return BigEndianNativeRecord::MaxSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericBigEndianNativeRecordView<
+    Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::UncheckedRead() {
+  return BigEndianNativeRecord::MaxSizeInBytes();
+}
+
+namespace BigEndianNativeRecord {
+inline constexpr ::std::int32_t MinSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL)).ValueOrDefault();
+}
+}  // namespace BigEndianNativeRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericBigEndianNativeRecordView<Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::Read() {
+  return BigEndianNativeRecord::MinSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericBigEndianNativeRecordView<
+    Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::UncheckedRead() {
+  return BigEndianNativeRecord::MinSizeInBytes();
+}
+namespace MisalignedRecord {
+
+}  // namespace MisalignedRecord
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 16>>
+
+ GenericMisalignedRecordView<Storage>::short_value()
+    const {
+
+  if ( has_short_value().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(2LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(0LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 16>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   0>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<16, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 16>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericMisalignedRecordView<Storage>::has_short_value() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 2>>, 32>>
+
+ GenericMisalignedRecordView<Storage>::long_value()
+    const {
+
+  if ( has_long_value().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(2LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 2>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   2>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 2>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericMisalignedRecordView<Storage>::has_long_value() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+namespace MisalignedRecord {
+inline constexpr ::std::int32_t IntrinsicSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(6LL)).ValueOrDefault();
+}
+}  // namespace MisalignedRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMisalignedRecordView<Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::Read() {
+  return MisalignedRecord::IntrinsicSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMisalignedRecordView<
+    Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::UncheckedRead() {
+  return MisalignedRecord::IntrinsicSizeInBytes();
+}
+
+namespace MisalignedRecord {
+inline constexpr ::std::int32_t MaxSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(6LL)).ValueOrDefault();
+}
+}  // namespace MisalignedRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMisalignedRecordView<Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::Read() {
+  return MisalignedRecord::MaxSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMisalignedRecordView<
+    Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::UncheckedRead() {
+  return MisalignedRecord::MaxSizeInBytes();
+}
+
+namespace MisalignedRecord {
+inline constexpr ::std::int32_t MinSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(6LL)).ValueOrDefault();
+}
+}  // namespace MisalignedRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMisalignedRecordView<Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::Read() {
+  return MisalignedRecord::MinSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMisalignedRecordView<
+    Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::UncheckedRead() {
+  return MisalignedRecord::MinSizeInBytes();
+}
+namespace MixedEndianRecord {
+
+}  // namespace MixedEndianRecord
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ GenericMixedEndianRecordView<Storage>::little_endian_value()
+    const {
+
+  if ( has_little_endian_value().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(0LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   0>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericMixedEndianRecordView<Storage>::has_little_endian_value() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+ GenericMixedEndianRecordView<Storage>::big_endian_value()
+    const {
+
+  if ( has_big_endian_value().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   4>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::BigEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 4>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericMixedEndianRecordView<Storage>::has_big_endian_value() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+namespace MixedEndianRecord {
+inline constexpr ::std::int32_t IntrinsicSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL)).ValueOrDefault();
+}
+}  // namespace MixedEndianRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMixedEndianRecordView<Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::Read() {
+  return MixedEndianRecord::IntrinsicSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMixedEndianRecordView<
+    Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::UncheckedRead() {
+  return MixedEndianRecord::IntrinsicSizeInBytes();
+}
+
+namespace MixedEndianRecord {
+inline constexpr ::std::int32_t MaxSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL)).ValueOrDefault();
+}
+}  // namespace MixedEndianRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMixedEndianRecordView<Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::Read() {
+  return MixedEndianRecord::MaxSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMixedEndianRecordView<
+    Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::UncheckedRead() {
+  return MixedEndianRecord::MaxSizeInBytes();
+}
+
+namespace MixedEndianRecord {
+inline constexpr ::std::int32_t MinSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(8LL)).ValueOrDefault();
+}
+}  // namespace MixedEndianRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMixedEndianRecordView<Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::Read() {
+  return MixedEndianRecord::MinSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericMixedEndianRecordView<
+    Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::UncheckedRead() {
+  return MixedEndianRecord::MinSizeInBytes();
+}
+namespace OverlappingRecord {
+
+}  // namespace OverlappingRecord
+
+
+template <class Storage>
+inline typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+ GenericOverlappingRecordView<Storage>::value()
+    const {
+
+  if ( has_value().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(0LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   0>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<32, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>>, 32>>
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericOverlappingRecordView<Storage>::has_value() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+template <class Storage>
+inline typename ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 0>, 1,
+    8 >
+
+ GenericOverlappingRecordView<Storage>::value_bytes()
+    const {
+
+  if ( has_value_bytes().ValueOr(false)) {
+
+    auto emboss_reserved_local_size = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL));
+    auto emboss_reserved_local_offset = ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(0LL));
+    if (emboss_reserved_local_size.Known() &&
+        emboss_reserved_local_size.ValueOr(0) >= 0 &&
+        emboss_reserved_local_offset.Known() &&
+        emboss_reserved_local_offset.ValueOr(0) >= 0) {
+        return ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 0>, 1,
+    8 >
+
+(
+                 backing_
+                        .template GetOffsetStorage<0,
+                                                   0>(
+                                emboss_reserved_local_offset.ValueOrDefault(),
+                                emboss_reserved_local_size.ValueOrDefault()));
+    }
+  }
+  return ::emboss::support::GenericArrayView<
+    typename ::emboss::prelude::UIntView<
+    /**/ ::emboss::support::FixedSizeViewParameters<8, ::emboss::support::AllValuesAreOk>,
+    typename ::emboss::support::BitBlock</**/::emboss::support::LittleEndianByteOrderer<typename Storage::template OffsetStorageType</**/0, 0>::template OffsetStorageType</**/1, 0>>, 8>>
+
+, typename Storage::template OffsetStorageType</**/0, 0>, 1,
+    8 >
+
+();
+}
+
+template <class Storage>
+inline ::emboss::support::Maybe<bool>
+GenericOverlappingRecordView<Storage>::has_value_bytes() const {
+  return ::emboss::support::Maybe</**/bool>(true);
+}
+
+
+namespace OverlappingRecord {
+inline constexpr ::std::int32_t IntrinsicSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL)).ValueOrDefault();
+}
+}  // namespace OverlappingRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericOverlappingRecordView<Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::Read() {
+  return OverlappingRecord::IntrinsicSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericOverlappingRecordView<
+    Storage>::EmbossReservedDollarVirtualIntrinsicSizeInBytesView::UncheckedRead() {
+  return OverlappingRecord::IntrinsicSizeInBytes();
+}
+
+namespace OverlappingRecord {
+inline constexpr ::std::int32_t MaxSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL)).ValueOrDefault();
+}
+}  // namespace OverlappingRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericOverlappingRecordView<Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::Read() {
+  return OverlappingRecord::MaxSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericOverlappingRecordView<
+    Storage>::EmbossReservedDollarVirtualMaxSizeInBytesView::UncheckedRead() {
+  return OverlappingRecord::MaxSizeInBytes();
+}
+
+namespace OverlappingRecord {
+inline constexpr ::std::int32_t MinSizeInBytes() {
+  return ::emboss::support::Maybe</**/::std::int32_t>(static_cast</**/::std::int32_t>(4LL)).ValueOrDefault();
+}
+}  // namespace OverlappingRecord
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericOverlappingRecordView<Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::Read() {
+  return OverlappingRecord::MinSizeInBytes();
+}
+
+template <class Storage>
+inline constexpr ::std::int32_t
+GenericOverlappingRecordView<
+    Storage>::EmbossReservedDollarVirtualMinSizeInBytesView::UncheckedRead() {
+  return OverlappingRecord::MinSizeInBytes();
+}
+
+
+
+}  // namespace test
+
+
+
+}  // namespace emboss
+
+
+
+/* NOLINTEND */
+
+#endif  // TESTDATA_NATIVE_LAYOUT_EMB_H_
+
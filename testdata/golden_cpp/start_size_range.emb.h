@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_START_SIZE_RANGE_EMB_H_
 #define TESTDATA_START_SIZE_RANGE_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -31,6 +33,8 @@ namespace StartSize {
 template <class Storage>
 class GenericStartSizeView;
 
+class EmbossReservedBuilderStartSize;
+
 
 
 
@@ -43,6 +47,7 @@ namespace StartSize {
 }  // namespace StartSize
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericStartSizeView;
 
@@ -295,13 +300,13 @@ class GenericStartSizeView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -310,41 +315,76 @@ class GenericStartSizeView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "size") {
-        if (!size().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "start_size_constants") {
-        if (!start_size_constants().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "payload") {
-        if (!payload().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "size") {
+                if (!size().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'c':
+              if (emboss_reserved_local_name == "counter") {
+                if (!counter().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+            case 'p':
+              if (emboss_reserved_local_name == "payload") {
+                if (!payload().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 20:
+          switch (emboss_reserved_local_name[0]) {
+            case 's':
+              if (emboss_reserved_local_name == "start_size_constants") {
+                if (!start_size_constants().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "counter") {
-        if (!counter().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -367,8 +407,8 @@ class GenericStartSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           size().IsAggregate() || size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -386,8 +426,8 @@ class GenericStartSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !size().IsAggregate() && !size().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# size: UNREADABLE\n");
       }
@@ -397,8 +437,8 @@ class GenericStartSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           start_size_constants().IsAggregate() || start_size_constants().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -416,8 +456,8 @@ class GenericStartSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !start_size_constants().IsAggregate() && !start_size_constants().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# start_size_constants: UNREADABLE\n");
       }
@@ -427,8 +467,8 @@ class GenericStartSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           payload().IsAggregate() || payload().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -446,8 +486,8 @@ class GenericStartSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !payload().IsAggregate() && !payload().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# payload: UNREADABLE\n");
       }
@@ -457,8 +497,8 @@ class GenericStartSizeView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           counter().IsAggregate() || counter().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -476,8 +516,8 @@ class GenericStartSizeView final {
                  emboss_reserved_local_field_options.comments() &&
                  !counter().IsAggregate() && !counter().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# counter: UNREADABLE\n");
       }
@@ -485,8 +525,8 @@ class GenericStartSizeView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -495,6 +535,51 @@ class GenericStartSizeView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_size().ValueOr(false)) {
+      emboss_reserved_local_visitor("size", size());
+    }
+
+    if (has_start_size_constants().ValueOr(false)) {
+      emboss_reserved_local_visitor("start_size_constants", start_size_constants());
+    }
+
+    if (has_payload().ValueOr(false)) {
+      emboss_reserved_local_visitor("payload", payload());
+    }
+
+    if (has_counter().ValueOr(false)) {
+      emboss_reserved_local_visitor("counter", counter());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 4; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "size", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "start_size_constants", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "payload", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "counter", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+  using Builder = EmbossReservedBuilderStartSize;
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -733,6 +818,72 @@ MakeAlignedStartSizeView(
       emboss_reserved_local_size);
 }
 
+class EmbossReservedBuilderStartSize final {
+ public:
+  explicit EmbossReservedBuilderStartSize(
+      ::std::vector</**/ ::std::uint8_t> *emboss_reserved_local_output)
+      : output_(emboss_reserved_local_output),
+        start_(emboss_reserved_local_output->size()) {
+    output_->resize(start_ + 1);
+  }
+  EmbossReservedBuilderStartSize(const EmbossReservedBuilderStartSize &) = delete;
+  EmbossReservedBuilderStartSize &operator=(
+      const EmbossReservedBuilderStartSize &) = delete;
+
+  decltype(::std::declval<StartSizeWriter>().start_size_constants()) append_start_size_constants() {
+    EMBOSS_CHECK_EQ(next_field_, 0);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    output_->resize(emboss_reserved_local_offset + 2);
+    return decltype(::std::declval<StartSizeWriter>().start_size_constants())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset, 2});
+  }
+
+  decltype(::std::declval<StartSizeWriter>().payload()) append_payload(
+      ::std::size_t emboss_reserved_local_element_count) {
+    EMBOSS_CHECK_EQ(next_field_, 1);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    payload_size_in_bytes_ = emboss_reserved_local_element_count * 1;
+    output_->resize(emboss_reserved_local_offset +
+                    payload_size_in_bytes_);
+    return decltype(::std::declval<StartSizeWriter>().payload())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset,
+            payload_size_in_bytes_});
+  }
+
+  decltype(::std::declval<StartSizeWriter>().counter()) append_counter() {
+    EMBOSS_CHECK_EQ(next_field_, 2);
+    ++next_field_;
+    const ::std::size_t emboss_reserved_local_offset = output_->size();
+    output_->resize(emboss_reserved_local_offset + 4);
+    return decltype(::std::declval<StartSizeWriter>().counter())(
+        ::emboss::support::ReadWriteContiguousBuffer{
+            output_->data() + emboss_reserved_local_offset, 4});
+  }
+
+  ::std::size_t Finish() {
+    EMBOSS_CHECK_EQ(next_field_, 3);
+    if (!decltype(::std::declval<StartSizeWriter>().size())(
+             ::emboss::support::ReadWriteContiguousBuffer{
+                 output_->data() + start_ + 0, 1})
+             .TryToWrite(static_cast</**/ ::std::int64_t>(payload_size_in_bytes_))) {
+      return 0;
+    }
+
+    return output_->size() - start_;
+  }
+
+ private:
+  ::std::vector</**/ ::std::uint8_t> *output_;
+  ::std::size_t start_;
+  int next_field_ = 0;
+  ::std::size_t payload_size_in_bytes_ = 0;
+};
+
+
 namespace StartSize {
 
 }  // namespace StartSize
@@ -3,12 +3,14 @@
  */
 #ifndef TESTDATA_SUBTYPES_EMB_H_
 #define TESTDATA_SUBTYPES_EMB_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "runtime/cpp/emboss_cpp_util.h"
 
@@ -99,12 +101,23 @@ class EnumTraits<InInIn> final {
   static bool TryToGetEnumFromName(const char *emboss_reserved_local_name,
                                    InInIn *emboss_reserved_local_result) {
     if (emboss_reserved_local_name == nullptr) return false;
-    if (!strcmp("NO", emboss_reserved_local_name)) {
+    return TryToGetEnumFromName(emboss_reserved_local_name,
+                                strlen(emboss_reserved_local_name),
+                                emboss_reserved_local_result);
+  }
+
+  static bool TryToGetEnumFromName(
+      const char *emboss_reserved_local_name,
+      ::std::size_t emboss_reserved_local_name_size,
+      InInIn *emboss_reserved_local_result) {
+    if (emboss_reserved_local_name_size == 2 &&
+        !memcmp("NO", emboss_reserved_local_name, 2)) {
       *emboss_reserved_local_result = InInIn::NO;
       return true;
     }
 
-    if (!strcmp("YES", emboss_reserved_local_name)) {
+    if (emboss_reserved_local_name_size == 3 &&
+        !memcmp("YES", emboss_reserved_local_name, 3)) {
       *emboss_reserved_local_result = InInIn::YES;
       return true;
     }
@@ -156,6 +169,15 @@ static inline bool TryToGetEnumFromName(
       emboss_reserved_local_name, emboss_reserved_local_result);
 }
 
+static inline bool TryToGetEnumFromName(
+    const char *emboss_reserved_local_name,
+    ::std::size_t emboss_reserved_local_name_size,
+    InInIn *emboss_reserved_local_result) {
+  return EnumTraits<InInIn>::TryToGetEnumFromName(
+      emboss_reserved_local_name, emboss_reserved_local_name_size,
+      emboss_reserved_local_result);
+}
+
 static inline const char *TryToGetNameFromEnum(
     InInIn emboss_reserved_local_value) {
   return EnumTraits<InInIn>::TryToGetNameFromEnum(
@@ -176,6 +198,7 @@ static inline ::std::ostream &operator<<(
 }  // namespace InIn
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericInInView;
 
@@ -363,13 +386,13 @@ class GenericInInView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -378,25 +401,49 @@ class GenericInInView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "field_enum") {
-        if (!field_enum().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "in_2") {
+                if (!in_2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "field_enum") {
+                if (!field_enum().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "in_2") {
-        if (!in_2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -419,16 +466,16 @@ class GenericInInView final {
         emboss_reserved_local_field_options.comments()) {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           outer_offset().IsAggregate() || outer_offset().Ok()) {
-        emboss_reserved_local_stream->Write(
-            emboss_reserved_local_field_options.current_indent());
+        emboss_reserved_local_field_options.WriteCurrentIndent(
+            emboss_reserved_local_stream);
         emboss_reserved_local_stream->Write("# outer_offset: ");
         outer_offset().WriteToTextStream(emboss_reserved_local_stream,
                                            emboss_reserved_local_field_options);
         emboss_reserved_local_stream->Write("\n");
       } else {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# outer_offset: UNREADABLE\n");
       }
@@ -438,8 +485,8 @@ class GenericInInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           field_enum().IsAggregate() || field_enum().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -457,8 +504,8 @@ class GenericInInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !field_enum().IsAggregate() && !field_enum().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# field_enum: UNREADABLE\n");
       }
@@ -468,8 +515,8 @@ class GenericInInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_2().IsAggregate() || in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -487,8 +534,8 @@ class GenericInInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_2().IsAggregate() && !in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_2: UNREADABLE\n");
       }
@@ -496,8 +543,8 @@ class GenericInInView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -506,6 +553,44 @@ class GenericInInView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_outer_offset().ValueOr(false)) {
+      emboss_reserved_local_visitor("outer_offset", outer_offset());
+    }
+
+    if (has_field_enum().ValueOr(false)) {
+      emboss_reserved_local_visitor("field_enum", field_enum());
+    }
+
+    if (has_in_2().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_2", in_2());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 3; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "outer_offset", true, true} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "field_enum", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "in_2", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -728,6 +813,7 @@ MakeAlignedInInView(
 }  // namespace In
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericInView;
 
@@ -1050,13 +1136,13 @@ class GenericInView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1065,57 +1151,107 @@ class GenericInView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "in_in_1") {
-        if (!in_in_1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_in_2") {
-        if (!in_in_2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_in_in_1") {
-        if (!in_in_in_1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_2") {
-        if (!in_2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "name_collision") {
-        if (!name_collision().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "in_2") {
+                if (!in_2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "in_in_1") {
+                if (!in_in_1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "in_in_2") {
+                if (!in_in_2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "in_in_in_1") {
+                if (!in_in_in_1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 14:
+          switch (emboss_reserved_local_name[0]) {
+            case 'n':
+              if (emboss_reserved_local_name == "name_collision") {
+                if (!name_collision().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 20:
+          switch (emboss_reserved_local_name[0]) {
+            case 'n':
+              if (emboss_reserved_local_name == "name_collision_check") {
+                if (!name_collision_check().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "name_collision_check") {
-        if (!name_collision_check().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -1138,8 +1274,8 @@ class GenericInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_in_1().IsAggregate() || in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1157,8 +1293,8 @@ class GenericInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_in_1().IsAggregate() && !in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_in_1: UNREADABLE\n");
       }
@@ -1168,8 +1304,8 @@ class GenericInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_in_2().IsAggregate() || in_in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1187,8 +1323,8 @@ class GenericInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_in_2().IsAggregate() && !in_in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_in_2: UNREADABLE\n");
       }
@@ -1198,8 +1334,8 @@ class GenericInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_in_in_1().IsAggregate() || in_in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1217,8 +1353,8 @@ class GenericInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_in_in_1().IsAggregate() && !in_in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_in_in_1: UNREADABLE\n");
       }
@@ -1228,8 +1364,8 @@ class GenericInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_2().IsAggregate() || in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1247,8 +1383,8 @@ class GenericInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_2().IsAggregate() && !in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_2: UNREADABLE\n");
       }
@@ -1258,8 +1394,8 @@ class GenericInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           name_collision().IsAggregate() || name_collision().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1277,8 +1413,8 @@ class GenericInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !name_collision().IsAggregate() && !name_collision().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# name_collision: UNREADABLE\n");
       }
@@ -1288,8 +1424,8 @@ class GenericInView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           name_collision_check().IsAggregate() || name_collision_check().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1307,8 +1443,8 @@ class GenericInView final {
                  emboss_reserved_local_field_options.comments() &&
                  !name_collision_check().IsAggregate() && !name_collision_check().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# name_collision_check: UNREADABLE\n");
       }
@@ -1316,8 +1452,8 @@ class GenericInView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1326,6 +1462,62 @@ class GenericInView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_in_in_1().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_in_1", in_in_1());
+    }
+
+    if (has_in_in_2().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_in_2", in_in_2());
+    }
+
+    if (has_in_in_in_1().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_in_in_1", in_in_in_1());
+    }
+
+    if (has_in_2().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_2", in_2());
+    }
+
+    if (has_name_collision().ValueOr(false)) {
+      emboss_reserved_local_visitor("name_collision", name_collision());
+    }
+
+    if (has_name_collision_check().ValueOr(false)) {
+      emboss_reserved_local_visitor("name_collision_check", name_collision_check());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 6; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "in_in_1", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "in_in_2", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "in_in_in_1", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "in_2", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "name_collision", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "name_collision_check", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1577,6 +1769,18 @@ namespace In2 {
 }  // namespace In2
 
 
+struct EMBOSS_MAY_ALIAS EmbossReservedNativeIn2 {
+  ::std::uint8_t field_byte;
+};
+static_assert(sizeof(EmbossReservedNativeIn2) == 1,
+              "EmbossReservedNativeIn2 does not match the layout of "
+              "In2.");
+static_assert(offsetof(EmbossReservedNativeIn2, field_byte) == 0,
+              "EmbossReservedNativeIn2::field_byte is not at the same "
+              "offset as In2::field_byte.");
+
+
+
 template <class View>
 struct EmbossReservedInternalIsGenericIn2View;
 
@@ -1725,13 +1929,13 @@ class GenericIn2View final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -1740,17 +1944,32 @@ class GenericIn2View final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "field_byte") {
-        if (!field_byte().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+      switch (emboss_reserved_local_name.size()) {
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'f':
+              if (emboss_reserved_local_name == "field_byte") {
+                if (!field_byte().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+
+        default:
+          break;
       }
 
       return false;
@@ -1773,8 +1992,8 @@ class GenericIn2View final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           field_byte().IsAggregate() || field_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -1792,8 +2011,8 @@ class GenericIn2View final {
                  emboss_reserved_local_field_options.comments() &&
                  !field_byte().IsAggregate() && !field_byte().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# field_byte: UNREADABLE\n");
       }
@@ -1801,8 +2020,8 @@ class GenericIn2View final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -1811,6 +2030,50 @@ class GenericIn2View final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_field_byte().ValueOr(false)) {
+      emboss_reserved_local_visitor("field_byte", field_byte());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 1; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "field_byte", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  using Native = EmbossReservedNativeIn2;
+
+  static constexpr bool HasNativeLayout() { return EMBOSS_HAS_MAY_ALIAS; }
+
+  template <class EmbossReservedStorage = Storage>
+  typename ::std::conditional<
+      ::std::is_const<typename ::std::remove_reference<decltype(
+          *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+      const Native *, Native *>::type
+  AsNative() const {
+    static_assert(HasNativeLayout() || sizeof(EmbossReservedStorage) == 0,
+                  "In2 does not have a native layout on this system.");
+    EMBOSS_CHECK_GE(backing_.SizeInBytes(), sizeof(Native));
+    EMBOSS_CHECK_POINTER_ALIGNMENT(backing_.data(), alignof(Native), 0);
+    return reinterpret_cast<typename ::std::conditional<
+        ::std::is_const<typename ::std::remove_reference<decltype(
+            *::std::declval<EmbossReservedStorage>().data())>::type>::value,
+        const Native *, Native *>::type>(backing_.data());
+  }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public:
@@ -1991,6 +2254,7 @@ MakeAlignedIn2View(
 }  // namespace Out
 
 
+
 template <class View>
 struct EmbossReservedInternalIsGenericOutView;
 
@@ -2384,13 +2648,13 @@ class GenericOutView final {
 
   template <class Stream>
   bool UpdateFromTextStream(Stream *emboss_reserved_local_stream) const {
-    ::std::string emboss_reserved_local_brace;
+    ::emboss::support::TextToken emboss_reserved_local_brace;
     if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                       &emboss_reserved_local_brace))
       return false;
     if (emboss_reserved_local_brace != "{") return false;
     for (;;) {
-      ::std::string emboss_reserved_local_name;
+      ::emboss::support::TextToken emboss_reserved_local_name;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_name))
         return false;
@@ -2399,73 +2663,121 @@ class GenericOutView final {
                                           &emboss_reserved_local_name))
           return false;
       if (emboss_reserved_local_name == "}") return true;
-      ::std::string emboss_reserved_local_colon;
+      ::emboss::support::TextToken emboss_reserved_local_colon;
       if (!::emboss::support::ReadToken(emboss_reserved_local_stream,
                                         &emboss_reserved_local_colon))
         return false;
       if (emboss_reserved_local_colon != ":") return false;
-      if (emboss_reserved_local_name == "in_1") {
-        if (!in_1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_2") {
-        if (!in_2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_in_1") {
-        if (!in_in_1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_in_2") {
-        if (!in_in_2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_in_in_1") {
-        if (!in_in_in_1().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "in_in_in_2") {
-        if (!in_in_in_2().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
-
-      if (emboss_reserved_local_name == "name_collision") {
-        if (!name_collision().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
-      }
+      switch (emboss_reserved_local_name.size()) {
+        case 4:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "in_1") {
+                if (!in_1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "in_2") {
+                if (!in_2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 7:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "in_in_1") {
+                if (!in_in_1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "in_in_2") {
+                if (!in_in_2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 10:
+          switch (emboss_reserved_local_name[0]) {
+            case 'i':
+              if (emboss_reserved_local_name == "in_in_in_1") {
+                if (!in_in_in_1().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+              if (emboss_reserved_local_name == "in_in_in_2") {
+                if (!in_in_in_2().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 14:
+          switch (emboss_reserved_local_name[0]) {
+            case 'n':
+              if (emboss_reserved_local_name == "name_collision") {
+                if (!name_collision().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
+        case 21:
+          switch (emboss_reserved_local_name[0]) {
+            case 'n':
+              if (emboss_reserved_local_name == "nested_constant_check") {
+                if (!nested_constant_check().UpdateFromTextStream(
+                        emboss_reserved_local_stream)) {
+                  return false;
+                }
+                continue;
+              }
+
+              break;
+
+            default:
+              break;
+          }
+          break;
 
-      if (emboss_reserved_local_name == "nested_constant_check") {
-        if (!nested_constant_check().UpdateFromTextStream(
-                emboss_reserved_local_stream)) {
-          return false;
-        }
-        continue;
+        default:
+          break;
       }
 
       return false;
@@ -2488,8 +2800,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_1().IsAggregate() || in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2507,8 +2819,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_1().IsAggregate() && !in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_1: UNREADABLE\n");
       }
@@ -2518,8 +2830,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_2().IsAggregate() || in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2537,8 +2849,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_2().IsAggregate() && !in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_2: UNREADABLE\n");
       }
@@ -2548,8 +2860,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_in_1().IsAggregate() || in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2567,8 +2879,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_in_1().IsAggregate() && !in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_in_1: UNREADABLE\n");
       }
@@ -2578,8 +2890,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_in_2().IsAggregate() || in_in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2597,8 +2909,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_in_2().IsAggregate() && !in_in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_in_2: UNREADABLE\n");
       }
@@ -2608,8 +2920,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_in_in_1().IsAggregate() || in_in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2627,8 +2939,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_in_in_1().IsAggregate() && !in_in_in_1().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_in_in_1: UNREADABLE\n");
       }
@@ -2638,8 +2950,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           in_in_in_2().IsAggregate() || in_in_in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2657,8 +2969,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !in_in_in_2().IsAggregate() && !in_in_in_2().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# in_in_in_2: UNREADABLE\n");
       }
@@ -2668,8 +2980,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           name_collision().IsAggregate() || name_collision().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2687,8 +2999,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !name_collision().IsAggregate() && !name_collision().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# name_collision: UNREADABLE\n");
       }
@@ -2698,8 +3010,8 @@ class GenericOutView final {
       if (!emboss_reserved_local_field_options.allow_partial_output() ||
           nested_constant_check().IsAggregate() || nested_constant_check().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         } else {
           if (emboss_reserved_local_wrote_field) {
             emboss_reserved_local_stream->Write(",");
@@ -2717,8 +3029,8 @@ class GenericOutView final {
                  emboss_reserved_local_field_options.comments() &&
                  !nested_constant_check().IsAggregate() && !nested_constant_check().Ok()) {
         if (emboss_reserved_local_field_options.multiline()) {
-          emboss_reserved_local_stream->Write(
-              emboss_reserved_local_field_options.current_indent());
+          emboss_reserved_local_field_options.WriteCurrentIndent(
+              emboss_reserved_local_stream);
         }
         emboss_reserved_local_stream->Write("# nested_constant_check: UNREADABLE\n");
       }
@@ -2726,8 +3038,8 @@ class GenericOutView final {
 
     (void)emboss_reserved_local_wrote_field;
     if (emboss_reserved_local_options.multiline()) {
-      emboss_reserved_local_stream->Write(
-          emboss_reserved_local_options.current_indent());
+      emboss_reserved_local_options.WriteCurrentIndent(
+          emboss_reserved_local_stream);
       emboss_reserved_local_stream->Write("}");
     } else {
       emboss_reserved_local_stream->Write(" }");
@@ -2736,6 +3048,74 @@ class GenericOutView final {
 
 
 
+  template <class Visitor>
+  void VisitFields(Visitor &&emboss_reserved_local_visitor) const {
+    if (has_in_1().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_1", in_1());
+    }
+
+    if (has_in_2().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_2", in_2());
+    }
+
+    if (has_in_in_1().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_in_1", in_in_1());
+    }
+
+    if (has_in_in_2().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_in_2", in_in_2());
+    }
+
+    if (has_in_in_in_1().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_in_in_1", in_in_in_1());
+    }
+
+    if (has_in_in_in_2().ValueOr(false)) {
+      emboss_reserved_local_visitor("in_in_in_2", in_in_in_2());
+    }
+
+    if (has_name_collision().ValueOr(false)) {
+      emboss_reserved_local_visitor("name_collision", name_collision());
+    }
+
+    if (has_nested_constant_check().ValueOr(false)) {
+      emboss_reserved_local_visitor("nested_constant_check", nested_constant_check());
+    }
+
+
+    (void)emboss_reserved_local_visitor;
+  }
+
+  static constexpr ::std::size_t FieldCount() { return 8; }
+  static constexpr ::emboss::support::FieldDescriptor FieldDescriptorAt(
+      ::std::size_t emboss_reserved_local_index) {
+    return (void)emboss_reserved_local_index,  // Silence -Wunused-parameter
+           emboss_reserved_local_index == 0 ? ::emboss::support::FieldDescriptor{
+               "in_1", false, false} :
+           emboss_reserved_local_index == 1 ? ::emboss::support::FieldDescriptor{
+               "in_2", false, false} :
+           emboss_reserved_local_index == 2 ? ::emboss::support::FieldDescriptor{
+               "in_in_1", false, false} :
+           emboss_reserved_local_index == 3 ? ::emboss::support::FieldDescriptor{
+               "in_in_2", false, false} :
+           emboss_reserved_local_index == 4 ? ::emboss::support::FieldDescriptor{
+               "in_in_in_1", false, false} :
+           emboss_reserved_local_index == 5 ? ::emboss::support::FieldDescriptor{
+               "in_in_in_2", false, false} :
+           emboss_reserved_local_index == 6 ? ::emboss::support::FieldDescriptor{
+               "name_collision", false, false} :
+           emboss_reserved_local_index == 7 ? ::emboss::support::FieldDescriptor{
+               "nested_constant_check", false, false} :
+
+           ::emboss::support::FieldDescriptor{nullptr, false, false};
+  }
+
+
+
+  static constexpr bool HasNativeLayout() { return false; }
+
+
+
   static constexpr bool IsAggregate() { return true; }
 
  public: